@@ -0,0 +1,129 @@
+#include "BBE/AllocatorTelemetry.h"
+#include "BBE/List.h"
+#include <cstring>
+#include <mutex>
+
+//Function local statics so that allocators in other static objects can
+//register themselves regardless of the initialization order.
+static std::mutex& getRegistryMutex()
+{
+	static std::mutex registryMutex;
+	return registryMutex;
+}
+
+static bbe::List<bbe::AllocatorTelemetry*>& getRegistry()
+{
+	static bbe::List<bbe::AllocatorTelemetry*> registry;
+	return registry;
+}
+
+bbe::AllocatorTelemetry::AllocatorTelemetry(const char* name)
+{
+	setName(name);
+	std::lock_guard<std::mutex> lock(getRegistryMutex());
+	getRegistry().add(this);
+}
+
+bbe::AllocatorTelemetry::~AllocatorTelemetry()
+{
+	std::lock_guard<std::mutex> lock(getRegistryMutex());
+	List<AllocatorTelemetry*>& registry = getRegistry();
+	for (std::size_t i = 0; i < registry.getLength(); i++)
+	{
+		if (registry[i] == this)
+		{
+			registry.removeIndexUnordered(i);
+			break;
+		}
+	}
+}
+
+void bbe::AllocatorTelemetry::setName(const char* name)
+{
+	if (name == nullptr)
+	{
+		name = "";
+	}
+	std::strncpy(m_name, name, MAX_NAME_LENGTH - 1);
+	m_name[MAX_NAME_LENGTH - 1] = '\0';
+}
+
+const char* bbe::AllocatorTelemetry::getName() const
+{
+	return m_name;
+}
+
+void bbe::AllocatorTelemetry::setRefresher(Refresher refresher, const void* owner)
+{
+	std::lock_guard<std::mutex> lock(getRegistryMutex());
+	m_refresher = refresher;
+	m_refresherOwner = owner;
+}
+
+void bbe::AllocatorTelemetry::setCounters(std::size_t liveBytes, std::size_t amountOfAllocations, std::size_t amountOfDeallocations)
+{
+	m_liveBytes.store(liveBytes, std::memory_order_relaxed);
+	m_amountOfAllocations.store(amountOfAllocations, std::memory_order_relaxed);
+	m_amountOfDeallocations.store(amountOfDeallocations, std::memory_order_relaxed);
+	if (liveBytes > m_peakBytes.load(std::memory_order_relaxed))
+	{
+		m_peakBytes.store(liveBytes, std::memory_order_relaxed);
+	}
+}
+
+std::size_t bbe::AllocatorTelemetry::getLiveBytes() const
+{
+	return m_liveBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getPeakBytes() const
+{
+	return m_peakBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getCapacityBytes() const
+{
+	return m_capacityBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getAmountOfAllocations() const
+{
+	return m_amountOfAllocations.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getAmountOfDeallocations() const
+{
+	return m_amountOfDeallocations.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getAmountOfFailedAllocations() const
+{
+	return m_amountOfFailedAllocations.load(std::memory_order_relaxed);
+}
+
+std::size_t bbe::AllocatorTelemetry::getAmountOfAllocationsLastFrame() const
+{
+	return m_amountOfAllocationsLastFrame;
+}
+
+void bbe::INTERNAL::forEachAllocatorTelemetry(void (*callback)(const AllocatorTelemetry& telemetry, void* userData), void* userData)
+{
+	std::lock_guard<std::mutex> lock(getRegistryMutex());
+	for (AllocatorTelemetry* telemetry : getRegistry())
+	{
+		telemetry->refresh();
+		callback(*telemetry, userData);
+	}
+}
+
+void bbe::INTERNAL::endAllocatorTelemetryFrame()
+{
+	std::lock_guard<std::mutex> lock(getRegistryMutex());
+	for (AllocatorTelemetry* telemetry : getRegistry())
+	{
+		telemetry->refresh();
+		const std::size_t amountOfAllocations = telemetry->getAmountOfAllocations();
+		telemetry->m_amountOfAllocationsLastFrame = amountOfAllocations - telemetry->m_amountOfAllocationsAtFrameStart;
+		telemetry->m_amountOfAllocationsAtFrameStart = amountOfAllocations;
+	}
+}
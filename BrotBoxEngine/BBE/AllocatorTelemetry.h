@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace bbe
+{
+	class AllocatorTelemetry;
+
+	namespace INTERNAL
+	{
+		//Calls the callback for every living allocator while the registry is locked.
+		//Refreshers are run before their telemetry is handed out.
+		void forEachAllocatorTelemetry(void (*callback)(const AllocatorTelemetry& telemetry, void* userData), void* userData);
+		void endAllocatorTelemetryFrame();
+	}
+
+	//Every allocator owns one of these. It registers itself in a global registry
+	//that bbe::Profiler reads. The counters are only written by the thread that
+	//uses the allocator, so relaxed loads and stores are enough. They compile to
+	//plain moves, the atomics only make concurrent reads by the profiler legal.
+	class AllocatorTelemetry
+	{
+	public:
+		//Allocators that can't afford to update the counters on every allocation
+		//(e.g. thread safe ones) update them in here whenever the profiler reads them.
+		typedef void (*Refresher)(const void* owner, AllocatorTelemetry& telemetry);
+
+		static constexpr std::size_t MAX_NAME_LENGTH = 64;
+
+	private:
+		char m_name[MAX_NAME_LENGTH] = {};
+		std::atomic<std::size_t> m_liveBytes{ 0 };
+		std::atomic<std::size_t> m_peakBytes{ 0 };
+		std::atomic<std::size_t> m_capacityBytes{ 0 };
+		std::atomic<std::size_t> m_amountOfAllocations{ 0 };
+		std::atomic<std::size_t> m_amountOfDeallocations{ 0 };
+		std::atomic<std::size_t> m_amountOfFailedAllocations{ 0 };
+
+		//Only touched while the registry is locked.
+		std::size_t m_amountOfAllocationsAtFrameStart = 0;
+		std::size_t m_amountOfAllocationsLastFrame = 0;
+		Refresher m_refresher = nullptr;
+		const void* m_refresherOwner = nullptr;
+
+		static void add(std::atomic<std::size_t>& counter, std::size_t value)
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+
+		void refresh()
+		{
+			if (m_refresher != nullptr)
+			{
+				m_refresher(m_refresherOwner, *this);
+			}
+		}
+
+		friend void INTERNAL::forEachAllocatorTelemetry(void (*callback)(const AllocatorTelemetry& telemetry, void* userData), void* userData);
+		friend void INTERNAL::endAllocatorTelemetryFrame();
+
+	public:
+		explicit AllocatorTelemetry(const char* name);
+		~AllocatorTelemetry();
+
+		AllocatorTelemetry(const AllocatorTelemetry&  other) = delete; //Copy Constructor
+		AllocatorTelemetry(AllocatorTelemetry&& other) = delete; //Move Constructor
+		AllocatorTelemetry& operator=(const AllocatorTelemetry&  other) = delete; //Copy Assignment
+		AllocatorTelemetry& operator=(AllocatorTelemetry&& other) = delete; //Move Assignment
+
+		void setName(const char* name);
+		const char* getName() const;
+		void setRefresher(Refresher refresher, const void* owner);
+
+		void onAllocation(std::size_t amountOfBytes)
+		{
+			add(m_amountOfAllocations, 1);
+			add(m_liveBytes, amountOfBytes);
+			const std::size_t liveBytes = m_liveBytes.load(std::memory_order_relaxed);
+			if (liveBytes > m_peakBytes.load(std::memory_order_relaxed))
+			{
+				m_peakBytes.store(liveBytes, std::memory_order_relaxed);
+			}
+		}
+
+		void onDeallocation(std::size_t amountOfBytes)
+		{
+			add(m_amountOfDeallocations, 1);
+			m_liveBytes.store(m_liveBytes.load(std::memory_order_relaxed) - amountOfBytes, std::memory_order_relaxed);
+		}
+
+		void onFailedAllocation()
+		{
+			add(m_amountOfFailedAllocations, 1);
+		}
+
+		void setCapacityBytes(std::size_t capacityBytes)
+		{
+			m_capacityBytes.store(capacityBytes, std::memory_order_relaxed);
+		}
+
+		//Used by refreshers that keep their own counters.
+		void setCounters(std::size_t liveBytes, std::size_t amountOfAllocations, std::size_t amountOfDeallocations);
+
+		std::size_t getLiveBytes() const;
+		std::size_t getPeakBytes() const;
+		std::size_t getCapacityBytes() const;
+		std::size_t getAmountOfAllocations() const;
+		std::size_t getAmountOfDeallocations() const;
+		std::size_t getAmountOfFailedAllocations() const;
+		std::size_t getAmountOfAllocationsLastFrame() const;
+	};
+}
@@ -133,7 +133,7 @@ namespace bbe
 
 		for (std::size_t i = 0; i < length; i++)
 		{
-			_hash += hash(t[i]);
+			_hash = hashCombine(_hash, hash(t[i]));
 		}
 
 		return _hash;
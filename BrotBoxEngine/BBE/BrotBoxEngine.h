@@ -4,9 +4,18 @@
 #include "../BBE/DynamicArray.h"
 #include "../BBE/Hash.h"
 #include "../BBE/HashMap.h"
+#include "../BBE/SortedMap.h"
+#include "../BBE/SortedSet.h"
 #include "../BBE/List.h"
+#include "../BBE/SmallList.h"
+#include "../BBE/SoAList.h"
+#include "../BBE/Grid2D.h"
+#include "../BBE/Span.h"
 #include "../BBE/RingArray.h"
 #include "../BBE/Stack.h"
+#include "../BBE/SPSCRing.h"
+#include "../BBE/MPMCQueue.h"
+#include "../BBE/EntityRegistry.h"
 
 #include "../BBE/ExceptionHelper.h"
 #include "../BBE/Exceptions.h"
@@ -16,6 +25,8 @@
 #include "../BBE/EngineSettings.h"
 #include "../BBE/Profiler.h"
 #include "../BBE/String.h"
+#include "../BBE/StringBuilder.h"
+#include "../BBE/StringId.h"
 
 #include "../BBE/Color.h"
 #include "../BBE/PixelObserver.h"
@@ -53,25 +64,32 @@
 
 #include "../BBE/Math.h"
 #include "../BBE/Matrix4.h"
+#include "../BBE/Simd.h"
 #include "../BBE/ValueNoise2D.h"
 #include "../BBE/Vector2.h"
 #include "../BBE/Vector3.h"
 #include "../BBE/Vector4.h"
+#include "../BBE/VectorBatch.h"
 #include "../BBE/BezierCurve2.h"
 #include "../BBE/Line2.h"
 
 #include "../BBE/DefaultDestroyer.h"
+#include "../BBE/AllocatorTelemetry.h"
 #include "../BBE/DefragmentationAllocator.h"
 #include "../BBE/GeneralPurposeAllocator.h"
 #include "../BBE/NewDeleteAllocator.h"
 #include "../BBE/PoolAllocator.h"
 #include "../BBE/StackAllocator.h"
+#include "../BBE/FrameArena.h"
+#include "../BBE/MemoryResource.h"
 #include "../BBE/STLAllocator.h"
 #include "../BBE/UniquePointer.h"
 
 #include "../BBE/LinearCongruentialGenerator.h"
 #include "../BBE/MersenneTwister.h"
+#include "../BBE/Xoshiro256.h"
 #include "../BBE/Random.h"
+#include "../BBE/Philox.h"
 
 #include "../BBE/Circle.h"
 #include "../BBE/Cube.h"
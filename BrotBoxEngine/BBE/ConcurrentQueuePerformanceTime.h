@@ -0,0 +1,127 @@
+#pragma once
+
+#include "../BBE/SPSCRing.h"
+#include "../BBE/MPMCQueue.h"
+#include "../BBE/StopWatch.h"
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bbe {
+	namespace test {
+		//What SoundManager and friends do today: a std::mutex around a std container.
+		template <typename T>
+		class MutexQueue
+		{
+		private:
+			std::mutex m_mutex;
+			std::deque<T> m_data;
+
+		public:
+			bool tryPush(const T& value)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_data.push_back(value);
+				return true;
+			}
+
+			std::size_t tryPushBatch(const T* values, std::size_t amountOfValues)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_data.insert(m_data.end(), values, values + amountOfValues);
+				return amountOfValues;
+			}
+
+			std::size_t tryPopBatch(T* out, std::size_t maxAmountOfValues)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				std::size_t amount = 0;
+				while (amount < maxAmountOfValues && !m_data.empty())
+				{
+					out[amount] = m_data.front();
+					m_data.pop_front();
+					amount++;
+				}
+				return amount;
+			}
+		};
+
+		//Returns the throughput in millions of values per second.
+		template <typename Queue>
+		double concurrentQueueThroughput(Queue& queue, std::size_t amountOfProducers, std::size_t amountOfConsumers, std::size_t batchSize, std::size_t valuesPerProducer)
+		{
+			const std::size_t amountOfValues = amountOfProducers * valuesPerProducer;
+			std::atomic<std::size_t> amountOfPoppedValues{ 0 };
+			std::vector<std::thread> threads;
+
+			//Wall clock time, CPUWatch would add up the time of all threads.
+			StopWatch watch;
+			for (std::size_t t = 0; t < amountOfProducers; t++)
+			{
+				threads.emplace_back([&]()
+				{
+					std::vector<std::size_t> batch(batchSize);
+					std::size_t pushed = 0;
+					while (pushed < valuesPerProducer)
+					{
+						const std::size_t amount = valuesPerProducer - pushed < batchSize ? valuesPerProducer - pushed : batchSize;
+						for (std::size_t i = 0; i < amount; i++)
+						{
+							batch[i] = pushed + i;
+						}
+						const std::size_t amountPushed = batchSize == 1 ? (queue.tryPush(batch[0]) ? 1 : 0) : queue.tryPushBatch(batch.data(), amount);
+						if (amountPushed == 0)
+						{
+							std::this_thread::yield();
+						}
+						pushed += amountPushed;
+					}
+				});
+			}
+			for (std::size_t t = 0; t < amountOfConsumers; t++)
+			{
+				threads.emplace_back([&]()
+				{
+					std::vector<std::size_t> out(batchSize);
+					while (amountOfPoppedValues.load(std::memory_order_relaxed) < amountOfValues)
+					{
+						const std::size_t amount = queue.tryPopBatch(out.data(), batchSize);
+						if (amount == 0)
+						{
+							std::this_thread::yield();
+						}
+						amountOfPoppedValues.fetch_add(amount, std::memory_order_relaxed);
+					}
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			return amountOfValues / (watch.getTimeExpiredMicroseconds() / 1000000.0) / 1000000.0;
+		}
+
+		void concurrentQueuePrintThroughput()
+		{
+			constexpr std::size_t valuesPerProducer = 1000000;
+			for (std::size_t batchSize : { 1, 16 })
+			{
+				std::cout << "Batch size " << batchSize << " (million values per second)" << std::endl;
+				{
+					SPSCRing<std::size_t> ring(1024);
+					MutexQueue<std::size_t> mutexQueue;
+					std::cout << "  1 producer,  1 consumer:  SPSCRing " << concurrentQueueThroughput(ring, 1, 1, batchSize, valuesPerProducer);
+					std::cout << ", mutex " << concurrentQueueThroughput(mutexQueue, 1, 1, batchSize, valuesPerProducer) << std::endl;
+				}
+				{
+					MPMCQueue<std::size_t> queue(1024);
+					MutexQueue<std::size_t> mutexQueue;
+					std::cout << "  4 producers, 4 consumers: MPMCQueue " << concurrentQueueThroughput(queue, 4, 4, batchSize, valuesPerProducer / 4);
+					std::cout << ", mutex " << concurrentQueueThroughput(mutexQueue, 4, 4, batchSize, valuesPerProducer / 4) << std::endl;
+				}
+			}
+		}
+	}
+}
@@ -61,7 +61,7 @@ namespace bbe
 
 		virtual bbe::List<bbe::Vector3> getNormals() const override;
 		using Shape3::getVertices;
-		virtual void getVertices(bbe::List<bbe::Vector3> &outVertices) const override;
+		virtual void getVertices(VertexList& outVertices) const override;
 
 		bbe::Vector3 approach(const bbe::Cube& other, const bbe::Vector3& approachVector) const;
 	};
@@ -11,13 +11,15 @@
 #include "../BBE/GeneralPurposeAllocator.h"
 #include "../BBE/Stack.h"
 #include "../BBE/Exceptions.h"
+#include "../BBE/StopWatch.h"
+#include "../BBE/AllocatorTelemetry.h"
+#include <cstdint>
 
 namespace bbe
 {
 	class DefragmentationAllocator
 	{
 		//TODO use parent allocator
-		//TODO defragmentation
 	public:
 		template<typename T>
 		class DefragmentationAllocatorPointer
@@ -170,12 +172,13 @@ namespace bbe
 				T* oldData = static_cast<T*>(m_pparent->m_handleTable[m_handleIndex]);
 				T* newData = reinterpret_cast<T*>(allocationLocation);
 
-				if (std::is_trivially_move_constructible<T>::value)
+				if constexpr (std::is_trivially_move_constructible<T>::value)
 				{
 					std::memmove(newData, oldData, amountOfBytes);
 				}
-				else if(allocationLocation + sizeof(T) < (byte*)oldData)
+				else if(allocationLocation + sizeof(T) <= (byte*)oldData)
 				{
+					//Moving to lower addresses in ascending order never overwrites an object that is still alive.
 					for (size_t i = 0; i < m_amountOfObjects; i++)
 					{
 						new (bbe::addressOf(newData[i])) T(std::move(oldData[i]));
@@ -184,15 +187,19 @@ namespace bbe
 				}
 				else
 				{
+					//The new location of an object overlaps the old one, so everything has to take a detour.
+					INTERNAL::Unconstructed<T>* tempData = new INTERNAL::Unconstructed<T>[m_amountOfObjects];
 					for (size_t i = 0; i < m_amountOfObjects; i++)
 					{
-						T tempObj(std::move(oldData[i]));
+						new (bbe::addressOf(tempData[i].m_value)) T(std::move(oldData[i]));
 						bbe::addressOf(oldData[i])->~T();
-
-						T* object = bbe::addressOf(newData[i]);
-						new (object) T(std::move(tempObj));
-						tempObj.~T();
 					}
+					for (size_t i = 0; i < m_amountOfObjects; i++)
+					{
+						new (bbe::addressOf(newData[i])) T(std::move(tempData[i].m_value));
+						tempData[i].m_value.~T();
+					}
+					delete[] tempData;
 				}
 
 				m_pparent->m_handleTable[m_handleIndex] = allocationLocation;
@@ -273,6 +280,8 @@ namespace bbe
 		Stack<size_t> m_unusedHandleStack;
 		List<DefragmentationAllocatorRelocatable, true> m_allocatedBlocks;
 
+		AllocatorTelemetry m_telemetry{ "DefragmentationAllocator" };
+
 	public:
 		explicit DefragmentationAllocator(size_t size = DEFRAGMENTATION_ALLOCAOTR_DEFAULT_SIZE, size_t lengthOfHandleTable = DEFRAGMENTATION_ALLOCAOTR_DEFAULT_SIZE / 4)
 			: m_length(size), m_lengthOfHandleTable(lengthOfHandleTable)
@@ -280,6 +289,7 @@ namespace bbe
 			//UNTESTED
 			m_data = new byte[m_length];
 			m_freeChunks.add(INTERNAL::GeneralPurposeAllocatorFreeChunk(m_data, m_length));
+			m_telemetry.setCapacityBytes(m_length);
 
 			m_handleTable = new void*[m_lengthOfHandleTable];
 			memset(m_handleTable, 0, sizeof(void*) * m_lengthOfHandleTable);
@@ -339,16 +349,19 @@ namespace bbe
 					}
 					if (m_unusedHandleStack.hasDataLeft() == false)
 					{
+						m_telemetry.onFailedAllocation();
 						debugBreak();
 						throw AllocatorOutOfHandlesException();
 					}
 					size_t index = m_unusedHandleStack.pop();
 					m_handleTable[index] = data;
 					m_allocatedBlocks.add(DefragmentationAllocatorRelocatable(this, index, amountOfObjects, data));
+					m_telemetry.onAllocation(amountOfObjects * sizeof(T));
 					return DefragmentationAllocatorPointer<T>(this, index, amountOfObjects);
 				}
 			}
 
+			m_telemetry.onFailedAllocation();
 			debugBreak();
 			throw AllocatorOutOfMemoryException();
 		}
@@ -449,6 +462,7 @@ namespace bbe
 				debugBreak();
 				throw MalformedPointerException();
 			}
+			m_telemetry.onDeallocation(amountOfBytes);
 			pointer.m_handleIndex = 0;
 		}
 
@@ -503,5 +517,76 @@ namespace bbe
 			
 			return true;
 		}
+
+		//Moves live blocks until the memory is compact or the budget is used up.
+		//A single move is never interrupted, so a very large block may overrun
+		//the budget. Returns the amount of moved blocks.
+		size_t defragment(int64_t budgetMicroseconds, size_t maxAmountOfMoves = SIZE_MAX)
+		{
+			StopWatch sw;
+			size_t amountOfMoves = 0;
+			while (amountOfMoves < maxAmountOfMoves && sw.getTimeExpiredMicroseconds() < budgetMicroseconds)
+			{
+				if (!defragment())
+				{
+					break;
+				}
+				amountOfMoves++;
+			}
+			return amountOfMoves;
+		}
+
+		size_t getAmountOfFreeChunks() const
+		{
+			return m_freeChunks.getLength();
+		}
+
+		size_t getFreeBytes() const
+		{
+			size_t freeBytes = 0;
+			for (size_t i = 0; i < m_freeChunks.getLength(); i++)
+			{
+				freeBytes += m_freeChunks[i].m_length;
+			}
+			return freeBytes;
+		}
+
+		size_t getLargestFreeBlock() const
+		{
+			size_t largestFreeBlock = 0;
+			for (size_t i = 0; i < m_freeChunks.getLength(); i++)
+			{
+				largestFreeBlock = Math::max(largestFreeBlock, m_freeChunks[i].m_length);
+			}
+			return largestFreeBlock;
+		}
+
+		AllocatorTelemetry& getTelemetry()
+		{
+			return m_telemetry;
+		}
+
+		const AllocatorTelemetry& getTelemetry() const
+		{
+			return m_telemetry;
+		}
+
+		//Free bytes that can't be used by a single allocation, because they are
+		//not part of the largest free block.
+		size_t getWastedBytes() const
+		{
+			return getFreeBytes() - getLargestFreeBlock();
+		}
+
+		//0 if all free memory is contiguous, approaching 1 the more it is scattered.
+		float getFragmentation() const
+		{
+			const size_t freeBytes = getFreeBytes();
+			if (freeBytes == 0)
+			{
+				return 0;
+			}
+			return static_cast<float>(getWastedBytes()) / static_cast<float>(freeBytes);
+		}
 	};
 }
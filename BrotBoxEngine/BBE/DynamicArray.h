@@ -10,7 +10,7 @@
 
 namespace bbe
 {
-	template<typename T, bool keepSorted>
+	template<typename T, bool keepSorted, typename ListAllocator>
 	class List;
 
 	template <typename T, typename Allocator = NewDeleteAllocator, typename PointerType = T*>
@@ -73,7 +73,8 @@ namespace bbe
 			}
 		}
 
-		DynamicArray(const List<T, true> &list, Allocator* parentAllocator = nullptr)
+		template <typename ListAllocator>
+		DynamicArray(const List<T, true, ListAllocator> &list, Allocator* parentAllocator = nullptr)
 			: m_length(list.getLength())
 		{
 			createArray(list.getLength(), parentAllocator);
@@ -83,7 +84,8 @@ namespace bbe
 			}
 		}
 
-		DynamicArray(const List<T, false> &list, Allocator* parentAllocator = nullptr)
+		template <typename ListAllocator>
+		DynamicArray(const List<T, false, ListAllocator> &list, Allocator* parentAllocator = nullptr)
 			: m_length(list.getLength())
 		{
 			createArray(list.getLength(), parentAllocator);
@@ -194,11 +196,11 @@ namespace bbe
 			length = 16;
 		}
 
-		uint32_t _hash = 0;
+		uint32_t _hash = hash(t.getLength());
 
 		for (std::size_t i = 0; i < length; i++)
 		{
-			_hash += hash(t[i]);
+			_hash = hashCombine(_hash, hash(t[i]));
 		}
 
 		return _hash;
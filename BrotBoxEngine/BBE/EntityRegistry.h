@@ -0,0 +1,361 @@
+#pragma once
+
+#include "../BBE/List.h"
+#include "../BBE/Exceptions.h"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace bbe
+{
+	//Handle to an entity of an EntityRegistry. The generation is bumped every time
+	//an index is reused, so handles to destroyed entities can be detected.
+	class Entity
+	{
+	public:
+		static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+		uint32_t m_index = INVALID_INDEX;
+		uint32_t m_generation = 0;
+
+		Entity() = default;
+
+		Entity(uint32_t index, uint32_t generation)
+			: m_index(index), m_generation(generation)
+		{
+			//do nothing
+		}
+
+		bool isNull() const
+		{
+			return m_index == INVALID_INDEX;
+		}
+
+		bool operator==(const Entity& other) const
+		{
+			return m_index == other.m_index && m_generation == other.m_generation;
+		}
+
+		bool operator!=(const Entity& other) const
+		{
+			return !operator==(other);
+		}
+	};
+
+	class EntityRegistry;
+
+	namespace INTERNAL
+	{
+		inline std::atomic<std::size_t> nextComponentTypeId{ 0 };
+
+		template <typename T>
+		std::size_t getComponentTypeId()
+		{
+			static const std::size_t id = nextComponentTypeId.fetch_add(1, std::memory_order_relaxed);
+			return id;
+		}
+
+		class ComponentPoolBase
+		{
+		public:
+			virtual ~ComponentPoolBase() = default;
+			virtual void removeIfPresent(uint32_t entityIndex) = 0;
+		};
+
+		//Sparse set: m_sparse maps an entity index to the position of its component in the
+		//packed arrays, m_entities maps back. The components of a type are therefore always
+		//contiguous, and removal is a swap with the last element.
+		template <typename T>
+		class ComponentPool : public ComponentPoolBase
+		{
+		public:
+			static constexpr uint32_t NOT_PRESENT = 0xFFFFFFFF;
+
+			List<uint32_t> m_sparse;
+			List<uint32_t> m_entities;
+			List<T> m_components;
+
+			bool contains(uint32_t entityIndex) const
+			{
+				return entityIndex < m_sparse.getLength() && m_sparse[entityIndex] != NOT_PRESENT;
+			}
+
+			template <typename... arguments>
+			T& add(uint32_t entityIndex, arguments&&... args)
+			{
+				if (contains(entityIndex))
+				{
+					throw KeyAlreadyUsedException();
+				}
+				while (m_sparse.getLength() <= entityIndex)
+				{
+					m_sparse.add(NOT_PRESENT);
+				}
+				T& component = m_components.emplace(std::forward<arguments>(args)...);
+				m_sparse[entityIndex] = static_cast<uint32_t>(m_entities.getLength());
+				m_entities.add(entityIndex);
+				return component;
+			}
+
+			T* tryGet(uint32_t entityIndex)
+			{
+				if (!contains(entityIndex))
+				{
+					return nullptr;
+				}
+				return &m_components[m_sparse[entityIndex]];
+			}
+
+			void removeIfPresent(uint32_t entityIndex) override
+			{
+				if (!contains(entityIndex))
+				{
+					return;
+				}
+				const uint32_t denseIndex = m_sparse[entityIndex];
+				const uint32_t lastEntity = m_entities.last();
+				m_components.removeIndexUnordered(denseIndex);
+				m_entities.removeIndexUnordered(denseIndex);
+				if (lastEntity != entityIndex)
+				{
+					m_sparse[lastEntity] = denseIndex;
+				}
+				m_sparse[entityIndex] = NOT_PRESENT;
+			}
+
+			std::size_t getLength() const
+			{
+				return m_entities.getLength();
+			}
+		};
+	}
+
+	//Iterates all entities that have every one of the Components. Only the smallest
+	//of the component sets is walked, the others are probed through their sparse
+	//arrays. Adding or removing the viewed components during forEach is not allowed.
+	template <typename... Components>
+	class EntityView
+	{
+		static_assert(sizeof...(Components) > 0, "A view needs at least one component.");
+	private:
+		EntityRegistry* m_pregistry;
+		std::tuple<INTERNAL::ComponentPool<Components>*...> m_pools;
+
+		template <std::size_t... I>
+		const List<uint32_t>& getSmallestEntitySet(std::index_sequence<I...>) const
+		{
+			const List<uint32_t>* smallest = &std::get<0>(m_pools)->m_entities;
+			((smallest = std::get<I>(m_pools)->m_entities.getLength() < smallest->getLength() ? &std::get<I>(m_pools)->m_entities : smallest), ...);
+			return *smallest;
+		}
+
+		template <std::size_t... I>
+		bool containsAll(uint32_t entityIndex, std::index_sequence<I...>) const
+		{
+			return (std::get<I>(m_pools)->contains(entityIndex) && ...);
+		}
+
+		template <typename Func, std::size_t... I>
+		void call(Func& func, uint32_t entityIndex, std::index_sequence<I...>);
+
+	public:
+		EntityView(EntityRegistry* registry, INTERNAL::ComponentPool<Components>*... pools)
+			: m_pregistry(registry), m_pools(pools...)
+		{
+			//do nothing
+		}
+
+		//func is called as func(Entity, Components&...).
+		template <typename Func>
+		void forEach(Func&& func);
+
+		//Amount of entities forEach visits at most.
+		std::size_t getSizeHint() const
+		{
+			return getSmallestEntitySet(std::index_sequence_for<Components...>()).getLength();
+		}
+	};
+
+	class EntityRegistry
+	{
+	private:
+		List<uint32_t> m_generations;
+		List<uint32_t> m_freeIndices;
+		List<INTERNAL::ComponentPoolBase*> m_pools;
+		std::size_t m_amountOfAliveEntities = 0;
+
+		template <typename T>
+		INTERNAL::ComponentPool<T>* getPool()
+		{
+			const std::size_t id = INTERNAL::getComponentTypeId<T>();
+			while (m_pools.getLength() <= id)
+			{
+				m_pools.add(nullptr);
+			}
+			if (m_pools[id] == nullptr)
+			{
+				m_pools[id] = new INTERNAL::ComponentPool<T>();
+			}
+			return static_cast<INTERNAL::ComponentPool<T>*>(m_pools[id]);
+		}
+
+		void checkAlive(Entity entity) const
+		{
+			if (!isAlive(entity))
+			{
+				throw IllegalArgumentException();
+			}
+		}
+
+		template <typename... Components>
+		friend class EntityView;
+
+	public:
+		EntityRegistry() = default;
+
+		~EntityRegistry()
+		{
+			for (INTERNAL::ComponentPoolBase* pool : m_pools)
+			{
+				delete pool;
+			}
+		}
+
+		EntityRegistry(const EntityRegistry&  other) = delete; //Copy Constructor
+		EntityRegistry(EntityRegistry&& other) = delete; //Move Constructor
+		EntityRegistry& operator=(const EntityRegistry&  other) = delete; //Copy Assignment
+		EntityRegistry& operator=(EntityRegistry&& other) = delete; //Move Assignment
+
+		Entity create()
+		{
+			m_amountOfAliveEntities++;
+			if (m_freeIndices.getLength() > 0)
+			{
+				const uint32_t index = m_freeIndices.last();
+				m_freeIndices.popBack();
+				return Entity(index, m_generations[index]);
+			}
+			m_generations.add(0);
+			return Entity(static_cast<uint32_t>(m_generations.getLength() - 1), 0);
+		}
+
+		//Removes all components of the entity and invalidates every handle to it.
+		void destroy(Entity entity)
+		{
+			checkAlive(entity);
+			for (INTERNAL::ComponentPoolBase* pool : m_pools)
+			{
+				if (pool != nullptr)
+				{
+					pool->removeIfPresent(entity.m_index);
+				}
+			}
+			m_generations[entity.m_index]++;
+			m_freeIndices.add(entity.m_index);
+			m_amountOfAliveEntities--;
+		}
+
+		bool isAlive(Entity entity) const
+		{
+			return entity.m_index < m_generations.getLength() && m_generations[entity.m_index] == entity.m_generation;
+		}
+
+		std::size_t getAmountOfEntities() const
+		{
+			return m_amountOfAliveEntities;
+		}
+
+		template <typename T, typename... arguments>
+		T& addComponent(Entity entity, arguments&&... args)
+		{
+			checkAlive(entity);
+			return getPool<T>()->add(entity.m_index, std::forward<arguments>(args)...);
+		}
+
+		template <typename T>
+		void removeComponent(Entity entity)
+		{
+			checkAlive(entity);
+			getPool<T>()->removeIfPresent(entity.m_index);
+		}
+
+		template <typename T>
+		bool hasComponent(Entity entity)
+		{
+			return isAlive(entity) && getPool<T>()->contains(entity.m_index);
+		}
+
+		//Returns nullptr if the entity doesn't have the component. The pointer is
+		//invalidated when components of the same type are added or removed.
+		template <typename T>
+		T* tryGetComponent(Entity entity)
+		{
+			if (!isAlive(entity))
+			{
+				return nullptr;
+			}
+			return getPool<T>()->tryGet(entity.m_index);
+		}
+
+		template <typename T>
+		T& getComponent(Entity entity)
+		{
+			T* component = tryGetComponent<T>(entity);
+			if (component == nullptr)
+			{
+				throw IllegalArgumentException();
+			}
+			return *component;
+		}
+
+		template <typename T>
+		std::size_t getAmountOfComponents()
+		{
+			return getPool<T>()->getLength();
+		}
+
+		template <typename... Components>
+		EntityView<Components...> view()
+		{
+			return EntityView<Components...>(this, getPool<Components>()...);
+		}
+	};
+
+	template <typename... Components>
+	template <typename Func, std::size_t... I>
+	void EntityView<Components...>::call(Func& func, uint32_t entityIndex, std::index_sequence<I...>)
+	{
+		func(Entity(entityIndex, m_pregistry->m_generations[entityIndex]), std::get<I>(m_pools)->m_components[std::get<I>(m_pools)->m_sparse[entityIndex]]...);
+	}
+
+	template <typename... Components>
+	template <typename Func>
+	void EntityView<Components...>::forEach(Func&& func)
+	{
+		typedef std::index_sequence_for<Components...> Indices;
+		if constexpr (sizeof...(Components) == 1)
+		{
+			//A single component set is walked in its packed order without any lookups.
+			INTERNAL::ComponentPool<Components...>* pool = std::get<0>(m_pools);
+			for (std::size_t i = 0; i < pool->m_entities.getLength(); i++)
+			{
+				const uint32_t entityIndex = pool->m_entities[i];
+				func(Entity(entityIndex, m_pregistry->m_generations[entityIndex]), pool->m_components[i]);
+			}
+		}
+		else
+		{
+			const List<uint32_t>& entities = getSmallestEntitySet(Indices());
+			for (std::size_t i = 0; i < entities.getLength(); i++)
+			{
+				const uint32_t entityIndex = entities[i];
+				if (containsAll(entityIndex, Indices()))
+				{
+					call(func, entityIndex, Indices());
+				}
+			}
+		}
+	}
+}
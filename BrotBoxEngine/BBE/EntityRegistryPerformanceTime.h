@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../BBE/EntityRegistry.h"
+#include "../BBE/List.h"
+#include "../BBE/Vector2.h"
+#include "../BBE/Random.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//The heap allocated, virtually updated game object most examples use today.
+		class EntityRegistryBenchmarkObject
+		{
+		public:
+			Vector2 pos;
+			Vector2 speed;
+			virtual ~EntityRegistryBenchmarkObject() = default;
+			virtual void update(float timeSinceLastFrame)
+			{
+				pos += speed * timeSinceLastFrame;
+			}
+		};
+
+		struct EntityRegistryBenchmarkPosition
+		{
+			Vector2 pos;
+		};
+
+		struct EntityRegistryBenchmarkVelocity
+		{
+			Vector2 speed;
+		};
+
+		void entityRegistryPrintUpdateSpeed()
+		{
+			constexpr std::size_t amountOfEntities = 100000;
+			constexpr int frames = 1000;
+			constexpr float timeSinceLastFrame = 1.f / 60.f;
+
+			List<EntityRegistryBenchmarkObject*> objects;
+			EntityRegistry registry;
+			Random rand;
+			rand.setSeed(42);
+			for (std::size_t i = 0; i < amountOfEntities; i++)
+			{
+				const Vector2 pos(rand.randomFloat(), rand.randomFloat());
+				const Vector2 speed(rand.randomFloat() - 0.5f, rand.randomFloat() - 0.5f);
+				EntityRegistryBenchmarkObject* object = new EntityRegistryBenchmarkObject();
+				object->pos = pos;
+				object->speed = speed;
+				objects.add(object);
+
+				Entity entity = registry.create();
+				registry.addComponent<EntityRegistryBenchmarkPosition>(entity, EntityRegistryBenchmarkPosition{ pos });
+				registry.addComponent<EntityRegistryBenchmarkVelocity>(entity, EntityRegistryBenchmarkVelocity{ speed });
+			}
+			//Shuffle the objects like a long running game would, so the pointers don't happen to be in allocation order.
+			for (std::size_t i = objects.getLength() - 1; i > 0; i--)
+			{
+				const std::size_t other = rand.randomInt((int)i + 1);
+				EntityRegistryBenchmarkObject* temp = objects[i];
+				objects[i] = objects[other];
+				objects[other] = temp;
+			}
+
+			CPUWatch objectWatch;
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (EntityRegistryBenchmarkObject* object : objects)
+				{
+					object->update(timeSinceLastFrame);
+				}
+			}
+			const double objectTime = objectWatch.getTimeExpiredSeconds();
+
+			CPUWatch registryWatch;
+			auto view = registry.view<EntityRegistryBenchmarkPosition, EntityRegistryBenchmarkVelocity>();
+			for (int frame = 0; frame < frames; frame++)
+			{
+				view.forEach([&](Entity entity, EntityRegistryBenchmarkPosition& position, EntityRegistryBenchmarkVelocity& velocity)
+				{
+					position.pos += velocity.speed * timeSinceLastFrame;
+				});
+			}
+			const double registryTime = registryWatch.getTimeExpiredSeconds();
+
+			for (EntityRegistryBenchmarkObject* object : objects)
+			{
+				delete object;
+			}
+
+			std::cout << "Virtual objects: " << objectTime / frames * 1000 << "ms per frame" << std::endl;
+			std::cout << "EntityRegistry:  " << registryTime / frames * 1000 << "ms per frame" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../BBE/DataType.h"
+#include "../BBE/StackAllocator.h"
+#include "../BBE/List.h"
+#include <cstddef>
+#include <new>
+
+namespace bbe
+{
+	//A double buffered linear arena for per frame temporaries. Allocating is a
+	//pointer bump, freeing does nothing. Memory handed out during a frame stays
+	//valid until the end of the following frame, then the whole buffer is
+	//reset at once. Not thread safe.
+	class FrameArena
+	{
+	private:
+		static constexpr std::size_t FRAME_ARENA_DEFAULT_SIZE = 1024 * 1024;
+
+		//A buffer is usually a single block. If a frame needs more, further blocks
+		//are chained and merged into one bigger block when the buffer is reset.
+		typedef List<StackAllocator<byte>*> Buffer;
+
+		Buffer m_buffers[2];
+		std::size_t m_currentBuffer = 0;
+		std::size_t m_blockSize;
+		std::size_t m_peakUsedBytes = 0;
+
+		StackAllocator<byte>& getBlock(std::size_t amountOfBytes, std::size_t alignment);
+		void resetBuffer(Buffer& buffer);
+		void destroyBuffer(Buffer& buffer);
+		std::size_t getUsedBytes(const Buffer& buffer) const;
+
+	public:
+		explicit FrameArena(std::size_t size = FRAME_ARENA_DEFAULT_SIZE);
+		~FrameArena();
+
+		FrameArena(const FrameArena&  other) = delete; //Copy Constructor
+		FrameArena(FrameArena&& other) = delete; //Move Constructor
+		FrameArena& operator=(const FrameArena&  other) = delete; //Copy Assignment
+		FrameArena& operator=(FrameArena&& other) = delete; //Move Assignment
+
+		void* allocate(std::size_t amountOfBytes, std::size_t alignment = alignof(std::max_align_t));
+		void deallocate(void* data, std::size_t amountOfBytes);
+
+		template <typename U, typename... arguments>
+		U* allocateObjects(std::size_t amountOfObjects, arguments&&... args)
+		{
+			//The destructors are called when the buffer is reset.
+			return getBlock(amountOfObjects * sizeof(U), alignof(U)).template allocateObjects<U>(amountOfObjects, std::forward<arguments>(args)...);
+		}
+
+		template <typename U, typename... arguments>
+		U* allocateObject(arguments&&... args)
+		{
+			return allocateObjects<U>(1, std::forward<arguments>(args)...);
+		}
+
+		//Swaps the buffers and resets the one that was used two frames ago.
+		void endFrame();
+
+		std::size_t getUsedBytes() const;
+		std::size_t getCapacity() const;
+		std::size_t getPeakUsedBytes() const;
+
+		void makeCurrent();
+		static FrameArena* getCurrent();
+	};
+
+	//STL style allocator that allocates from a FrameArena. Can be used as the
+	//allocator of a List, e.g. through FrameList. A default constructed
+	//FrameAllocator uses the current arena of the running game and falls back
+	//to the heap if there is none.
+	template <typename T>
+	class FrameAllocator
+	{
+	private:
+		FrameArena* m_parentArena;
+
+		template <typename U>
+		friend class FrameAllocator;
+
+	public:
+		typedef T value_type;
+
+		FrameAllocator()
+			: m_parentArena(FrameArena::getCurrent())
+		{
+			//do nothing
+		}
+
+		explicit FrameAllocator(FrameArena& parentArena)
+			: m_parentArena(bbe::addressOf(parentArena))
+		{
+			//do nothing
+		}
+
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U>& other)
+			: m_parentArena(other.m_parentArena)
+		{
+			//do nothing
+		}
+
+		T* allocate(std::size_t amountOfObjects)
+		{
+			if (m_parentArena == nullptr)
+			{
+				return static_cast<T*>(::operator new(amountOfObjects * sizeof(T)));
+			}
+			return static_cast<T*>(m_parentArena->allocate(amountOfObjects * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* data, std::size_t amountOfObjects)
+		{
+			if (m_parentArena == nullptr)
+			{
+				::operator delete(data);
+				return;
+			}
+			m_parentArena->deallocate(data, amountOfObjects * sizeof(T));
+		}
+
+		FrameArena* getParentArena() const
+		{
+			return m_parentArena;
+		}
+
+		template <typename U>
+		bool operator==(const FrameAllocator<U>& other) const
+		{
+			return m_parentArena == other.m_parentArena;
+		}
+
+		template <typename U>
+		bool operator!=(const FrameAllocator<U>& other) const
+		{
+			return m_parentArena != other.m_parentArena;
+		}
+	};
+
+	template <typename T>
+	using FrameList = List<T, false, FrameAllocator<T>>;
+}
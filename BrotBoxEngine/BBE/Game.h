@@ -9,6 +9,8 @@
 #include "../BBE/Vector2.h"
 #include "../BBE/PhysWorld.h"
 #include "../BBE/SoundManager.h"
+#include "../BBE/FrameArena.h"
+#include "../BBE/StringBuilder.h"
 
 namespace bbe
 {
@@ -29,6 +31,8 @@ namespace bbe
 		GameTime    m_gameTime;
 		PhysWorld   m_physWorld = PhysWorld({ 0, -20 });
 		float       m_fixedFrameTime = 0;
+		FrameArena  m_frameArena;
+		StringBuilder m_screenshotPath;
 #ifndef BBE_NO_AUDIO
 		bbe::INTERNAL::SoundManager m_soundManager;
 #endif
@@ -94,6 +98,9 @@ namespace bbe
 
 		PhysWorld* getPhysWorld();
 
+		// Temporary memory that is valid until the end of the next frame.
+		FrameArena& getFrameArena();
+
 		void screenshot(const bbe::String& path);
 		void setVideoRenderingMode(const char* path);
 		void setScreenshotRecordingMode(const char* path = "images/img");
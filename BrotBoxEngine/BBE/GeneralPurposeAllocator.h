@@ -2,11 +2,19 @@
 
 #include "../BBE/DataType.h"
 #include "../BBE/List.h"
+#include "../BBE/SortedMap.h"
 #include "../BBE/Math.h"
 #include "../BBE/UniquePointer.h"
 #include "../BBE/UtilTest.h"
 #include "../BBE/EmptyClass.h"
 #include "../BBE/Exceptions.h"
+#include "../BBE/AllocatorTelemetry.h"
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace bbe
 {
@@ -92,8 +100,75 @@ namespace bbe
 				}
 			}
 		};
+
+		//Header of a block in the segregated fit mode. Every block, free or used,
+		//knows its size and its physical predecessor, so neighbors can be found
+		//and coalesced in constant time. The free list links overlap the payload
+		//and are only valid while the block is free.
+		struct GeneralPurposeAllocatorBlock
+		{
+			static constexpr size_t FREE_FLAG = 1;
+
+			GeneralPurposeAllocatorBlock* m_prevPhysicalBlock;
+			size_t m_sizeAndFlags;
+			GeneralPurposeAllocatorBlock* m_nextFreeBlock;
+			GeneralPurposeAllocatorBlock* m_prevFreeBlock;
+
+			size_t getSize() const
+			{
+				return m_sizeAndFlags & ~FREE_FLAG;
+			}
+
+			void setSize(size_t size)
+			{
+				m_sizeAndFlags = size | (m_sizeAndFlags & FREE_FLAG);
+			}
+
+			bool isFree() const
+			{
+				return (m_sizeAndFlags & FREE_FLAG) != 0;
+			}
+
+			void setFree(bool free)
+			{
+				m_sizeAndFlags = free ? (m_sizeAndFlags | FREE_FLAG) : (m_sizeAndFlags & ~FREE_FLAG);
+			}
+
+			GeneralPurposeAllocatorBlock* getNextPhysicalBlock()
+			{
+				return reinterpret_cast<GeneralPurposeAllocatorBlock*>(reinterpret_cast<byte*>(this) + getSize());
+			}
+		};
+
+		inline size_t findFirstSet(uint64_t value)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward64(&index, value);
+			return index;
+#else
+			return (size_t)__builtin_ctzll(value);
+#endif
+		}
+
+		inline size_t findLastSet(uint64_t value)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanReverse64(&index, value);
+			return index;
+#else
+			return 63 - (size_t)__builtin_clzll(value);
+#endif
+		}
 	}
 
+	enum class GeneralPurposeAllocatorMode
+	{
+		FIRST_FIT,		//Sorted free list, allocation cost grows with fragmentation.
+		SEGREGATED_FIT,	//TLSF like size classes, constant time allocate and free. 16 bytes overhead per allocation.
+	};
+
 	class GeneralPurposeAllocator
 	{
 		//TODO use parent allocator
@@ -182,33 +257,293 @@ namespace bbe
 		};
 	private:
 		static const size_t GENERAL_PURPOSE_ALLOCATOR_DEFAULT_SIZE = 1024;
+
+		//Segregated fit layout: Blocks below SMALL_BLOCK_SIZE use exact size classes
+		//in steps of BLOCK_GRANULARITY. Bigger blocks are binned by their highest bit
+		//(first level) and SECOND_LEVEL_COUNT linear subdivisions (second level).
+		//A bitmap per level makes finding a non empty fitting list constant time.
+		static constexpr size_t BLOCK_GRANULARITY = 16;
+		static constexpr size_t BLOCK_HEADER_SIZE = offsetof(INTERNAL::GeneralPurposeAllocatorBlock, m_nextFreeBlock);
+		static constexpr size_t MIN_BLOCK_SIZE = sizeof(INTERNAL::GeneralPurposeAllocatorBlock);
+		static constexpr size_t SECOND_LEVEL_COUNT_LOG2 = 4;
+		static constexpr size_t SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_COUNT_LOG2;
+		static constexpr size_t FIRST_LEVEL_SHIFT = SECOND_LEVEL_COUNT_LOG2 + 4;
+		static constexpr size_t SMALL_BLOCK_SIZE = 1 << FIRST_LEVEL_SHIFT;
+		static constexpr size_t FIRST_LEVEL_COUNT = 64 - FIRST_LEVEL_SHIFT + 1;
+		static_assert(SMALL_BLOCK_SIZE / BLOCK_GRANULARITY == SECOND_LEVEL_COUNT, "Small size classes must fill exactly the first level 0.");
+		static_assert(BLOCK_HEADER_SIZE == BLOCK_GRANULARITY, "Payloads must stay aligned to the block granularity.");
+
 		byte* m_data;
 		size_t m_length;
+		const GeneralPurposeAllocatorMode m_mode;
 
-		List<INTERNAL::GeneralPurposeAllocatorFreeChunk, true> m_freeChunks;
+		//First fit free chunks, keyed by their end address. Allocations cut from the front
+		//of a chunk and merging a freed chunk into its right neighbor don't change the key.
+		SortedMap<byte*, INTERNAL::GeneralPurposeAllocatorFreeChunk> m_freeChunks;
 
-	public:
-		explicit GeneralPurposeAllocator(size_t size = GENERAL_PURPOSE_ALLOCATOR_DEFAULT_SIZE)
-			: m_length(size)
+		AllocatorTelemetry m_telemetry{ "GeneralPurposeAllocator" };
+
+		INTERNAL::GeneralPurposeAllocatorBlock* m_firstBlock = nullptr;
+		INTERNAL::GeneralPurposeAllocatorBlock** m_freeBlocks = nullptr;	//FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT list heads
+		uint64_t m_firstLevelBitmap = 0;
+		uint32_t m_secondLevelBitmaps[FIRST_LEVEL_COUNT] = {};
+
+		static void mappingInsert(size_t size, size_t& firstLevel, size_t& secondLevel)
 		{
-			//UNTESTED
-			m_data = new byte[m_length];
-			m_freeChunks.add(INTERNAL::GeneralPurposeAllocatorFreeChunk(m_data, m_length));
+			if (size < SMALL_BLOCK_SIZE)
+			{
+				firstLevel = 0;
+				secondLevel = size / BLOCK_GRANULARITY;
+			}
+			else
+			{
+				const size_t lastSet = INTERNAL::findLastSet(size);
+				secondLevel = (size >> (lastSet - SECOND_LEVEL_COUNT_LOG2)) ^ SECOND_LEVEL_COUNT;
+				firstLevel = lastSet - (FIRST_LEVEL_SHIFT - 1);
+			}
 		}
 
-		~GeneralPurposeAllocator()
+		static void mappingSearch(size_t size, size_t& firstLevel, size_t& secondLevel)
 		{
-			if (m_freeChunks.getLength() != 1)
+			//Rounding up to the next list guarantees that every block of the found list fits.
+			if (size >= SMALL_BLOCK_SIZE)
 			{
-				debugBreak();
+				size += ((size_t)1 << (INTERNAL::findLastSet(size) - SECOND_LEVEL_COUNT_LOG2)) - 1;
+			}
+			mappingInsert(size, firstLevel, secondLevel);
+		}
+
+		void insertFreeBlock(INTERNAL::GeneralPurposeAllocatorBlock* block)
+		{
+			size_t firstLevel;
+			size_t secondLevel;
+			mappingInsert(block->getSize(), firstLevel, secondLevel);
+			INTERNAL::GeneralPurposeAllocatorBlock*& head = m_freeBlocks[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+			block->setFree(true);
+			block->m_prevFreeBlock = nullptr;
+			block->m_nextFreeBlock = head;
+			if (head != nullptr)
+			{
+				head->m_prevFreeBlock = block;
+			}
+			head = block;
+			m_firstLevelBitmap |= (uint64_t)1 << firstLevel;
+			m_secondLevelBitmaps[firstLevel] |= (uint32_t)1 << secondLevel;
+		}
+
+		void removeFreeBlock(INTERNAL::GeneralPurposeAllocatorBlock* block)
+		{
+			size_t firstLevel;
+			size_t secondLevel;
+			mappingInsert(block->getSize(), firstLevel, secondLevel);
+			INTERNAL::GeneralPurposeAllocatorBlock*& head = m_freeBlocks[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+			if (block->m_prevFreeBlock != nullptr)
+			{
+				block->m_prevFreeBlock->m_nextFreeBlock = block->m_nextFreeBlock;
+			}
+			else
+			{
+				head = block->m_nextFreeBlock;
+			}
+			if (block->m_nextFreeBlock != nullptr)
+			{
+				block->m_nextFreeBlock->m_prevFreeBlock = block->m_prevFreeBlock;
+			}
+			if (head == nullptr)
+			{
+				m_secondLevelBitmaps[firstLevel] &= ~((uint32_t)1 << secondLevel);
+				if (m_secondLevelBitmaps[firstLevel] == 0)
+				{
+					m_firstLevelBitmap &= ~((uint64_t)1 << firstLevel);
+				}
 			}
-			if (m_freeChunks[0].m_addr != m_data)
+			block->setFree(false);
+		}
+
+		INTERNAL::GeneralPurposeAllocatorBlock* findFreeBlock(size_t size)
+		{
+			size_t firstLevel;
+			size_t secondLevel;
+			mappingSearch(size, firstLevel, secondLevel);
+			if (firstLevel >= FIRST_LEVEL_COUNT)
+			{
+				return nullptr;
+			}
+
+			uint64_t secondLevelMap = m_secondLevelBitmaps[firstLevel] & (~(uint64_t)0 << secondLevel);
+			if (secondLevelMap == 0)
+			{
+				const uint64_t firstLevelMap = firstLevel + 1 < 64 ? m_firstLevelBitmap & (~(uint64_t)0 << (firstLevel + 1)) : 0;
+				if (firstLevelMap == 0)
+				{
+					return nullptr;
+				}
+				firstLevel = INTERNAL::findFirstSet(firstLevelMap);
+				secondLevelMap = m_secondLevelBitmaps[firstLevel];
+			}
+			secondLevel = INTERNAL::findFirstSet(secondLevelMap);
+
+			INTERNAL::GeneralPurposeAllocatorBlock* block = m_freeBlocks[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+			removeFreeBlock(block);
+			return block;
+		}
+
+		//Cuts the first size bytes off the block. The rest becomes a new free block.
+		void splitBlock(INTERNAL::GeneralPurposeAllocatorBlock* block, size_t size)
+		{
+			INTERNAL::GeneralPurposeAllocatorBlock* rest = reinterpret_cast<INTERNAL::GeneralPurposeAllocatorBlock*>(reinterpret_cast<byte*>(block) + size);
+			rest->m_sizeAndFlags = block->getSize() - size;
+			rest->m_prevPhysicalBlock = block;
+			rest->getNextPhysicalBlock()->m_prevPhysicalBlock = rest;
+			block->setSize(size);
+			insertFreeBlock(rest);
+		}
+
+		void initSegregatedFit()
+		{
+			byte* begin = reinterpret_cast<byte*>(Math::nextMultiple(BLOCK_GRANULARITY, reinterpret_cast<size_t>(m_data)));
+			const size_t usableLength = (m_length - (begin - m_data)) / BLOCK_GRANULARITY * BLOCK_GRANULARITY;
+			if (m_length < 2 * BLOCK_GRANULARITY || usableLength < MIN_BLOCK_SIZE + BLOCK_HEADER_SIZE)
 			{
+				throw IllegalArgumentException();
+			}
+
+			m_freeBlocks = new INTERNAL::GeneralPurposeAllocatorBlock*[FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT]();
+
+			m_firstBlock = reinterpret_cast<INTERNAL::GeneralPurposeAllocatorBlock*>(begin);
+			m_firstBlock->m_prevPhysicalBlock = nullptr;
+			m_firstBlock->m_sizeAndFlags = usableLength - BLOCK_HEADER_SIZE;
+
+			//A used block of size 0 at the end, so every block has a physical successor.
+			INTERNAL::GeneralPurposeAllocatorBlock* sentinel = m_firstBlock->getNextPhysicalBlock();
+			sentinel->m_prevPhysicalBlock = m_firstBlock;
+			sentinel->m_sizeAndFlags = 0;
+
+			insertFreeBlock(m_firstBlock);
+		}
+
+		byte* allocateSegregatedFit(size_t amountOfBytes, size_t alignment)
+		{
+			if (amountOfBytes == 0)
+			{
+				amountOfBytes = 1;
+			}
+			const size_t size = Math::max(Math::nextMultiple(BLOCK_GRANULARITY, amountOfBytes) + BLOCK_HEADER_SIZE, MIN_BLOCK_SIZE);
+			//Over aligned requests may need to cut off a leading gap of up to two times the alignment.
+			const size_t searchSize = alignment > BLOCK_GRANULARITY ? size + 2 * alignment : size;
+
+			INTERNAL::GeneralPurposeAllocatorBlock* block = findFreeBlock(searchSize);
+			if (block == nullptr)
+			{
+				m_telemetry.onFailedAllocation();
 				debugBreak();
+				throw AllocatorOutOfMemoryException();
+			}
+
+			if (alignment > BLOCK_GRANULARITY)
+			{
+				byte* payload = reinterpret_cast<byte*>(block) + BLOCK_HEADER_SIZE;
+				size_t gap = Math::nextMultiple(alignment, reinterpret_cast<size_t>(payload)) - reinterpret_cast<size_t>(payload);
+				if (gap != 0 && gap < MIN_BLOCK_SIZE)
+				{
+					gap += alignment;
+				}
+				if (gap != 0)
+				{
+					//The gap stays free. Its predecessor can't be free, because the block was free.
+					INTERNAL::GeneralPurposeAllocatorBlock* gapBlock = block;
+					block = reinterpret_cast<INTERNAL::GeneralPurposeAllocatorBlock*>(reinterpret_cast<byte*>(gapBlock) + gap);
+					block->m_sizeAndFlags = gapBlock->getSize() - gap;
+					block->m_prevPhysicalBlock = gapBlock;
+					block->getNextPhysicalBlock()->m_prevPhysicalBlock = block;
+					gapBlock->setSize(gap);
+					insertFreeBlock(gapBlock);
+				}
+			}
+
+			if (block->getSize() - size >= MIN_BLOCK_SIZE)
+			{
+				splitBlock(block, size);
 			}
-			if (m_freeChunks[0].m_length != m_length)
+			return reinterpret_cast<byte*>(block) + BLOCK_HEADER_SIZE;
+		}
+
+		void deallocateSegregatedFit(byte* payload)
+		{
+			INTERNAL::GeneralPurposeAllocatorBlock* block = reinterpret_cast<INTERNAL::GeneralPurposeAllocatorBlock*>(payload - BLOCK_HEADER_SIZE);
+			if (payload < m_data || payload >= m_data + m_length || block->isFree())
 			{
 				debugBreak();
+				throw MalformedPointerException();
+			}
+
+			INTERNAL::GeneralPurposeAllocatorBlock* prev = block->m_prevPhysicalBlock;
+			if (prev != nullptr && prev->isFree())
+			{
+				removeFreeBlock(prev);
+				prev->setSize(prev->getSize() + block->getSize());
+				block = prev;
+			}
+			INTERNAL::GeneralPurposeAllocatorBlock* next = block->getNextPhysicalBlock();
+			if (next->isFree())
+			{
+				removeFreeBlock(next);
+				block->setSize(block->getSize() + next->getSize());
+			}
+			block->getNextPhysicalBlock()->m_prevPhysicalBlock = block;
+			insertFreeBlock(block);
+		}
+
+	public:
+		explicit GeneralPurposeAllocator(size_t size = GENERAL_PURPOSE_ALLOCATOR_DEFAULT_SIZE, GeneralPurposeAllocatorMode mode = GeneralPurposeAllocatorMode::FIRST_FIT)
+			: m_length(size), m_mode(mode)
+		{
+			m_data = new byte[m_length];
+			m_telemetry.setCapacityBytes(m_length);
+			if (m_mode == GeneralPurposeAllocatorMode::SEGREGATED_FIT)
+			{
+				try
+				{
+					initSegregatedFit();
+				}
+				catch (...)
+				{
+					delete[] m_data;
+					throw;
+				}
+			}
+			else
+			{
+				m_freeChunks.add(m_data + m_length, INTERNAL::GeneralPurposeAllocatorFreeChunk(m_data, m_length));
+			}
+		}
+
+		~GeneralPurposeAllocator()
+		{
+			if (m_mode == GeneralPurposeAllocatorMode::SEGREGATED_FIT)
+			{
+				if (!m_firstBlock->isFree() || m_firstBlock->getNextPhysicalBlock()->getSize() != 0)
+				{
+					debugBreak();
+				}
+				delete[] m_freeBlocks;
+				m_freeBlocks = nullptr;
+				m_firstBlock = nullptr;
+			}
+			else
+			{
+				if (m_freeChunks.getLength() != 1)
+				{
+					debugBreak();
+				}
+				else if (m_freeChunks.begin().getValue().m_addr != m_data)
+				{
+					debugBreak();
+				}
+				else if (m_freeChunks.begin().getValue().m_length != m_length)
+				{
+					debugBreak();
+				}
 			}
 			if (m_data != nullptr)
 			{
@@ -217,6 +552,21 @@ namespace bbe
 			}
 		}
 
+		GeneralPurposeAllocatorMode getMode() const
+		{
+			return m_mode;
+		}
+
+		AllocatorTelemetry& getTelemetry()
+		{
+			return m_telemetry;
+		}
+
+		const AllocatorTelemetry& getTelemetry() const
+		{
+			return m_telemetry;
+		}
+
 		GeneralPurposeAllocator(const GeneralPurposeAllocator& other) = delete;
 		GeneralPurposeAllocator(GeneralPurposeAllocator&& other) = delete;
 		GeneralPurposeAllocator& operator=(const GeneralPurposeAllocator& other) = delete;
@@ -234,19 +584,32 @@ namespace bbe
 			//UNTESTED
 			static_assert(ALIGNMENT <= 128, "Max alignment of 128 was exceeded");
 			static_assert(ALIGNMENT >= alignof(T), "Alignment must be at least the alignment of type T!");
-			for (size_t i = 0; i < m_freeChunks.getLength(); i++)
+			if (m_mode == GeneralPurposeAllocatorMode::SEGREGATED_FIT)
+			{
+				T* returnPointer = reinterpret_cast<T*>(allocateSegregatedFit(amountOfObjects * sizeof(T), ALIGNMENT));
+				for (size_t i = 0; i < amountOfObjects; i++)
+				{
+					new (bbe::addressOf(returnPointer[i])) T(std::forward<arguments>(args)...);
+				}
+				m_telemetry.onAllocation(amountOfObjects * sizeof(T));
+				return GeneralPurposeAllocatorPointer<T>(returnPointer, amountOfObjects);
+			}
+			for (auto it = m_freeChunks.begin(); it != m_freeChunks.end(); ++it)
 			{
-				T* data = m_freeChunks[i].allocateObject<T, ALIGNMENT>(amountOfObjects, std::forward<arguments>(args)...);
+				T* data = it.getValue().allocateObject<T, ALIGNMENT>(amountOfObjects, std::forward<arguments>(args)...);
 				if (data != nullptr)
 				{
-					if (m_freeChunks[i].m_length == 0)
+					if (it.getValue().m_length == 0)
 					{
-						m_freeChunks.removeIndex(i);
+						byte* chunkEnd = it.getKey();
+						m_freeChunks.remove(chunkEnd);
 					}
+					m_telemetry.onAllocation(amountOfObjects * sizeof(T));
 					return GeneralPurposeAllocatorPointer<T>(data, amountOfObjects);
 				}
 			}
 
+			m_telemetry.onFailedAllocation();
 			debugBreak();
 			throw AllocatorOutOfMemoryException();
 		}
@@ -281,51 +644,48 @@ namespace bbe
 			}
 
 			byte* bytePointer = reinterpret_cast<byte*>(pointer.m_pdata);
+			if (m_mode == GeneralPurposeAllocatorMode::SEGREGATED_FIT)
+			{
+				deallocateSegregatedFit(bytePointer);
+				m_telemetry.onDeallocation(sizeof(T) * pointer.m_length);
+				pointer.m_pdata = nullptr;
+				return;
+			}
 			size_t amountOfBytes = sizeof(T) * pointer.m_length;
 			byte offset = bytePointer[-1];
 
 			INTERNAL::GeneralPurposeAllocatorFreeChunk gpafc(bytePointer - offset, amountOfBytes + offset);
+			byte* gpafcEnd = gpafc.m_addr + gpafc.m_length;
 
-			INTERNAL::GeneralPurposeAllocatorFreeChunk* p_gpafc = &gpafc;
-			INTERNAL::GeneralPurposeAllocatorFreeChunk* left;
-			bool didTouchLeft = false;
-			bool didMerge = false;
-			INTERNAL::GeneralPurposeAllocatorFreeChunk* right;
+			//The left neighbor ends where the freed chunk starts, the right one is the first chunk ending after it.
+			INTERNAL::GeneralPurposeAllocatorFreeChunk* left = m_freeChunks.get(gpafc.m_addr);
+			auto right = m_freeChunks.upperBound(gpafcEnd);
+			const bool touchesRight = right != m_freeChunks.end() && right.getValue().m_addr == gpafcEnd;
 
-			m_freeChunks.getNeighbors(*p_gpafc, left, right);
-			if (left != nullptr)
+			if (touchesRight)
 			{
-				if (left->touches(*p_gpafc))
+				right.getValue().m_addr = gpafc.m_addr;
+				right.getValue().m_length += gpafc.m_length;
+				if (left != nullptr)
 				{
-					left->m_length += p_gpafc->m_length;
-					didTouchLeft = true;
-					p_gpafc = left;
-					didMerge = true;
+					right.getValue().m_addr = left->m_addr;
+					right.getValue().m_length += left->m_length;
+					m_freeChunks.remove(gpafc.m_addr);
 				}
 			}
-			if (right != nullptr)
+			else if (left != nullptr)
 			{
-				if (right->touches(*p_gpafc))
-				{
-					if (didTouchLeft)
-					{
-						p_gpafc->m_length += right->m_length;
-						m_freeChunks.removeSingle(*right);
-					}
-					else
-					{
-						right->m_length += p_gpafc->m_length;
-						right->m_addr = p_gpafc->m_addr;
-					}
-					didMerge = true;
-				}
+				//Growing the left neighbor moves its end, so it gets a new key.
+				INTERNAL::GeneralPurposeAllocatorFreeChunk merged(left->m_addr, left->m_length + gpafc.m_length);
+				m_freeChunks.remove(gpafc.m_addr);
+				m_freeChunks.add(gpafcEnd, merged);
 			}
-
-			if (!didMerge)
+			else
 			{
-				m_freeChunks.add(gpafc);
+				m_freeChunks.add(gpafcEnd, gpafc);
 			}
 
+			m_telemetry.onDeallocation(amountOfBytes);
 			pointer.m_pdata = nullptr;
 		}
 	};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "../BBE/GeneralPurposeAllocator.h"
+#include "../BBE/Random.h"
+#include "../BBE/CPUWatch.h"
+#include "../BBE/UtilTest.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//Keeps up to maxLiveAllocations alive and randomly frees and allocates
+		//blocks of mixed sizes, which fragments the first fit free list.
+		double generalPurposeAllocatorFragmentingRun(GeneralPurposeAllocatorMode mode, int runs, int maxLiveAllocations)
+		{
+			GeneralPurposeAllocator gpa(sizeof(float) * 1024 * 1024 * 16, mode);
+			List<GeneralPurposeAllocator::GeneralPurposeAllocatorPointer<float>> list;
+			list.reserve(maxLiveAllocations);
+			Random rand;
+			rand.setSeed(42);
+
+			CPUWatch watch;
+			for (int i = 0; i < runs; i++)
+			{
+				if (rand.randomBool() && list.getLength() < (size_t)maxLiveAllocations)
+				{
+					const int amount = rand.randomInt(4) == 0 ? rand.randomInt(2048) + 1 : rand.randomInt(16) + 1;
+					list.add(gpa.allocateObjects<float>(amount));
+				}
+				else if (list.getLength() > 0)
+				{
+					const size_t index = (size_t)rand.randomInt((int)list.getLength());
+					gpa.deallocate(list[index]);
+					list.removeIndexUnordered(index);
+				}
+			}
+			const double time = watch.getTimeExpiredSeconds();
+
+			for (size_t i = 0; i < list.getLength(); i++)
+			{
+				gpa.deallocate(list[i]);
+			}
+			return time;
+		}
+
+		void generalPurposeAllocatorPrintSegregatedFitSpeed()
+		{
+			constexpr int runs = 1024 * 256;
+			for (int maxLiveAllocations : { 64, 1024, 4096 })
+			{
+				std::cout << "Live allocations: " << maxLiveAllocations << std::endl;
+				std::cout << "  First fit:      " << generalPurposeAllocatorFragmentingRun(GeneralPurposeAllocatorMode::FIRST_FIT, runs, maxLiveAllocations) << std::endl;
+				std::cout << "  Segregated fit: " << generalPurposeAllocatorFragmentingRun(GeneralPurposeAllocatorMode::SEGREGATED_FIT, runs, maxLiveAllocations) << std::endl;
+			}
+		}
+	}
+}
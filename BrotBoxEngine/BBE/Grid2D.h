@@ -0,0 +1,491 @@
+#pragma once
+
+#include "../BBE/Span.h"
+#include "../BBE/Vector2.h"
+#include "../BBE/Exceptions.h"
+#include "../BBE/UtilDebug.h"
+#include <cstddef>
+#include <exception>
+#include <stdint.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bbe
+{
+	//Memory layouts of a Grid2D. A layout maps a cell to its storage index and
+	//visits all cells in storage order.
+
+	//Rows one after another, like x + y * width. Rows are contiguous, so Grid2D::getRow is available.
+	struct GridRowMajor
+	{
+		static constexpr bool CONTIGUOUS_ROWS = true;
+
+		static std::size_t getStorageLength(int32_t width, int32_t height)
+		{
+			return static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+		}
+
+		static std::size_t getIndex(int32_t x, int32_t y, int32_t width)
+		{
+			return static_cast<std::size_t>(y) * static_cast<std::size_t>(width) + static_cast<std::size_t>(x);
+		}
+
+		template <typename F>
+		static void forEachCell(int32_t width, int32_t height, F&& f)
+		{
+			std::size_t index = 0;
+			for (int32_t y = 0; y < height; y++)
+			{
+				for (int32_t x = 0; x < width; x++)
+				{
+					f(x, y, index);
+					index++;
+				}
+			}
+		}
+	};
+
+	//Square tiles of 2^TILE_SIZE_LOG2 cells, row major inside a tile and the tiles
+	//row major among each other. With the default 8x8 tiles of 4 byte cells a tile
+	//covers four cache lines, so a stencil touching the rows above and below mostly
+	//stays inside the lines that are already loaded. The last tile row and column
+	//are padded.
+	template <int32_t TILE_SIZE_LOG2 = 3>
+	struct GridTiled
+	{
+		static_assert(TILE_SIZE_LOG2 > 0 && TILE_SIZE_LOG2 < 8, "Unreasonable tile size.");
+		static constexpr bool CONTIGUOUS_ROWS = false;
+		static constexpr int32_t TILE_SIZE = 1 << TILE_SIZE_LOG2;
+		static constexpr int32_t TILE_MASK = TILE_SIZE - 1;
+
+		static std::size_t getAmountOfTiles(int32_t cells)
+		{
+			return static_cast<std::size_t>((cells + TILE_MASK) >> TILE_SIZE_LOG2);
+		}
+
+		static std::size_t getStorageLength(int32_t width, int32_t height)
+		{
+			return getAmountOfTiles(width) * getAmountOfTiles(height) * (TILE_SIZE * TILE_SIZE);
+		}
+
+		static std::size_t getIndex(int32_t x, int32_t y, int32_t width)
+		{
+			const std::size_t tile = static_cast<std::size_t>(y >> TILE_SIZE_LOG2) * getAmountOfTiles(width) + static_cast<std::size_t>(x >> TILE_SIZE_LOG2);
+			return (tile << (2 * TILE_SIZE_LOG2)) + static_cast<std::size_t>(((y & TILE_MASK) << TILE_SIZE_LOG2) + (x & TILE_MASK));
+		}
+
+		template <typename F>
+		static void forEachCell(int32_t width, int32_t height, F&& f)
+		{
+			for (int32_t tileY = 0; tileY < height; tileY += TILE_SIZE)
+			{
+				for (int32_t tileX = 0; tileX < width; tileX += TILE_SIZE)
+				{
+					const int32_t endY = tileY + TILE_SIZE < height ? tileY + TILE_SIZE : height;
+					const int32_t endX = tileX + TILE_SIZE < width ? tileX + TILE_SIZE : width;
+					for (int32_t y = tileY; y < endY; y++)
+					{
+						std::size_t index = getIndex(tileX, y, width);
+						for (int32_t x = tileX; x < endX; x++)
+						{
+							f(x, y, index);
+							index++;
+						}
+					}
+				}
+			}
+		}
+	};
+
+	//Z-order curve, the bits of x and y interleaved. Cells that are close in 2D are
+	//close in memory in every direction and at every scale, which suits random
+	//access around a point (e.g. neighbourhood queries of particles). Non power of
+	//two sizes are padded, a 65x65 grid needs as much storage as a 128x128 one
+	//would need for its first 65 rows.
+	struct GridMorton
+	{
+		static constexpr bool CONTIGUOUS_ROWS = false;
+
+		static uint64_t spreadBits(uint32_t value)
+		{
+			uint64_t x = value;
+			x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+			x = (x | (x <<  8)) & 0x00FF00FF00FF00FFull;
+			x = (x | (x <<  4)) & 0x0F0F0F0F0F0F0F0Full;
+			x = (x | (x <<  2)) & 0x3333333333333333ull;
+			x = (x | (x <<  1)) & 0x5555555555555555ull;
+			return x;
+		}
+
+		static uint32_t compactBits(uint64_t x)
+		{
+			x &= 0x5555555555555555ull;
+			x = (x | (x >>  1)) & 0x3333333333333333ull;
+			x = (x | (x >>  2)) & 0x0F0F0F0F0F0F0F0Full;
+			x = (x | (x >>  4)) & 0x00FF00FF00FF00FFull;
+			x = (x | (x >>  8)) & 0x0000FFFF0000FFFFull;
+			x = (x | (x >> 16)) & 0x00000000FFFFFFFFull;
+			return static_cast<uint32_t>(x);
+		}
+
+		static std::size_t getStorageLength(int32_t width, int32_t height)
+		{
+			if (width == 0 || height == 0)
+			{
+				return 0;
+			}
+			//The index grows with x and with y, so the last cell has the biggest one.
+			return static_cast<std::size_t>(getIndex(width - 1, height - 1, width)) + 1;
+		}
+
+		static std::size_t getIndex(int32_t x, int32_t y, int32_t /*width*/)
+		{
+			return static_cast<std::size_t>(spreadBits(static_cast<uint32_t>(x)) | (spreadBits(static_cast<uint32_t>(y)) << 1));
+		}
+
+		template <typename F>
+		static void forEachCell(int32_t width, int32_t height, F&& f)
+		{
+			const std::size_t storageLength = getStorageLength(width, height);
+			for (std::size_t index = 0; index < storageLength; index++)
+			{
+				const int32_t x = static_cast<int32_t>(compactBits(index));
+				const int32_t y = static_cast<int32_t>(compactBits(index >> 1));
+				if (x < width && y < height)
+				{
+					f(x, y, index);
+				}
+			}
+		}
+	};
+
+	//Dense 2D array of width x height cells. The layout is chosen at compile time,
+	//see GridRowMajor, GridTiled and GridMorton. Prefer forEach and parallelForRows
+	//over nested loops, they visit the cells in storage order for every layout.
+	//
+	//  Grid2D<float> heights(256, 256);
+	//  heights.forEach([](int32_t x, int32_t y, float& h) { h = x * 0.1f; });
+	//  heights.forEachNeighbour4(10, 10, [&](int32_t x, int32_t y, float& h) { sum += h; });
+	template <typename T, typename Layout = GridRowMajor>
+	class Grid2D
+	{
+	private:
+		//Below this amount of cells spawning threads costs more than it saves.
+		static constexpr std::size_t PARALLEL_MIN_CELLS = 16 * 1024;
+
+		T*          m_pdata         = nullptr;
+		int32_t     m_width         = 0;
+		int32_t     m_height        = 0;
+		std::size_t m_storageLength = 0;
+
+	public:
+		Grid2D()
+		{
+			//do nothing
+		}
+
+		Grid2D(int32_t width, int32_t height)
+		{
+			if (width < 0 || height < 0)
+			{
+				debugBreak();
+				throw IllegalArgumentException();
+			}
+			m_width = width;
+			m_height = height;
+			m_storageLength = Layout::getStorageLength(width, height);
+			if (m_storageLength > 0)
+			{
+				m_pdata = new T[m_storageLength]();
+			}
+		}
+
+		Grid2D(int32_t width, int32_t height, const T& value)
+			: Grid2D(width, height)
+		{
+			fill(value);
+		}
+
+		Grid2D(const Grid2D& other) //Copy Constructor
+			: m_width(other.m_width), m_height(other.m_height), m_storageLength(other.m_storageLength)
+		{
+			if (m_storageLength > 0)
+			{
+				m_pdata = new T[m_storageLength];
+				for (std::size_t i = 0; i < m_storageLength; i++)
+				{
+					m_pdata[i] = other.m_pdata[i];
+				}
+			}
+		}
+
+		Grid2D(Grid2D&& other) //Move Constructor
+			: m_pdata(other.m_pdata), m_width(other.m_width), m_height(other.m_height), m_storageLength(other.m_storageLength)
+		{
+			other.m_pdata = nullptr;
+			other.m_width = 0;
+			other.m_height = 0;
+			other.m_storageLength = 0;
+		}
+
+		Grid2D& operator=(const Grid2D& other) //Copy Assignment
+		{
+			if (this != &other)
+			{
+				Grid2D copy(other);
+				*this = std::move(copy);
+			}
+			return *this;
+		}
+
+		Grid2D& operator=(Grid2D&& other) //Move Assignment
+		{
+			if (this != &other)
+			{
+				delete[] m_pdata;
+				m_pdata = other.m_pdata;
+				m_width = other.m_width;
+				m_height = other.m_height;
+				m_storageLength = other.m_storageLength;
+				other.m_pdata = nullptr;
+				other.m_width = 0;
+				other.m_height = 0;
+				other.m_storageLength = 0;
+			}
+			return *this;
+		}
+
+		~Grid2D()
+		{
+			delete[] m_pdata;
+			m_pdata = nullptr;
+		}
+
+		int32_t getWidth() const
+		{
+			return m_width;
+		}
+
+		int32_t getHeight() const
+		{
+			return m_height;
+		}
+
+		bool isInBounds(int32_t x, int32_t y) const
+		{
+			return x >= 0 && y >= 0 && x < m_width && y < m_height;
+		}
+
+		//Unchecked access, the caller guarantees isInBounds(x, y).
+		T& get(int32_t x, int32_t y)
+		{
+			return m_pdata[Layout::getIndex(x, y, m_width)];
+		}
+
+		const T& get(int32_t x, int32_t y) const
+		{
+			return m_pdata[Layout::getIndex(x, y, m_width)];
+		}
+
+		T& operator[](const Vector2i& pos)
+		{
+			return get(pos.x, pos.y);
+		}
+
+		const T& operator[](const Vector2i& pos) const
+		{
+			return get(pos.x, pos.y);
+		}
+
+		//Coordinates outside of the grid are moved to the closest edge cell.
+		T& getClamped(int32_t x, int32_t y)
+		{
+			return get(clampX(x), clampY(y));
+		}
+
+		const T& getClamped(int32_t x, int32_t y) const
+		{
+			return get(clampX(x), clampY(y));
+		}
+
+		int32_t clampX(int32_t x) const
+		{
+			return x < 0 ? 0 : (x >= m_width ? m_width - 1 : x);
+		}
+
+		int32_t clampY(int32_t y) const
+		{
+			return y < 0 ? 0 : (y >= m_height ? m_height - 1 : y);
+		}
+
+		//Only available for layouts with contiguous rows.
+		Span<T> getRow(int32_t y)
+		{
+			static_assert(Layout::CONTIGUOUS_ROWS, "The rows of this layout are not contiguous.");
+			return Span<T>(m_pdata + Layout::getIndex(0, y, m_width), static_cast<std::size_t>(m_width));
+		}
+
+		Span<const T> getRow(int32_t y) const
+		{
+			static_assert(Layout::CONTIGUOUS_ROWS, "The rows of this layout are not contiguous.");
+			return Span<const T>(m_pdata + Layout::getIndex(0, y, m_width), static_cast<std::size_t>(m_width));
+		}
+
+		void fill(const T& value)
+		{
+			for (std::size_t i = 0; i < m_storageLength; i++)
+			{
+				m_pdata[i] = value;
+			}
+		}
+
+		//Calls f(x, y, cell) for every cell in storage order.
+		template <typename F>
+		void forEach(F&& f)
+		{
+			T* data = m_pdata;
+			Layout::forEachCell(m_width, m_height, [&](int32_t x, int32_t y, std::size_t index) { f(x, y, data[index]); });
+		}
+
+		template <typename F>
+		void forEach(F&& f) const
+		{
+			const T* data = m_pdata;
+			Layout::forEachCell(m_width, m_height, [&](int32_t x, int32_t y, std::size_t index) { f(x, y, data[index]); });
+		}
+
+		//Calls f(neighbourX, neighbourY, cell) for the up to 4 direct neighbours that are inside the grid.
+		template <typename F>
+		void forEachNeighbour4(int32_t x, int32_t y, F&& f)
+		{
+			if (x > 0)            f(x - 1, y, get(x - 1, y));
+			if (x < m_width - 1)  f(x + 1, y, get(x + 1, y));
+			if (y > 0)            f(x, y - 1, get(x, y - 1));
+			if (y < m_height - 1) f(x, y + 1, get(x, y + 1));
+		}
+
+		//Like forEachNeighbour4, but includes the diagonal neighbours.
+		template <typename F>
+		void forEachNeighbour8(int32_t x, int32_t y, F&& f)
+		{
+			for (int32_t dy = -1; dy <= 1; dy++)
+			{
+				const int32_t ny = y + dy;
+				if (ny < 0 || ny >= m_height)
+				{
+					continue;
+				}
+				for (int32_t dx = -1; dx <= 1; dx++)
+				{
+					const int32_t nx = x + dx;
+					if ((dx == 0 && dy == 0) || nx < 0 || nx >= m_width)
+					{
+						continue;
+					}
+					f(nx, ny, get(nx, ny));
+				}
+			}
+		}
+
+		//Calls f(y) for every row, split into contiguous bands over several threads.
+		//f must only write to cells of its own row. Small grids are done on the
+		//calling thread. amountOfThreads 0 uses all hardware threads.
+		template <typename F>
+		void parallelForRows(F&& f, unsigned amountOfThreads = 0) const
+		{
+			if (amountOfThreads == 0)
+			{
+				amountOfThreads = std::thread::hardware_concurrency();
+			}
+			if (amountOfThreads > static_cast<unsigned>(m_height))
+			{
+				amountOfThreads = static_cast<unsigned>(m_height);
+			}
+			if (amountOfThreads <= 1 || m_storageLength < PARALLEL_MIN_CELLS)
+			{
+				for (int32_t y = 0; y < m_height; y++)
+				{
+					f(y);
+				}
+				return;
+			}
+
+			//Exceptions are caught per band and rethrown once every thread is joined, a joinable
+			//std::thread must never be destroyed and a throwing thread function would terminate.
+			std::vector<std::exception_ptr> errors(amountOfThreads);
+			const auto band = [&f, &errors](unsigned index, int32_t startY, int32_t endY)
+			{
+				try
+				{
+					for (int32_t y = startY; y < endY; y++)
+					{
+						f(y);
+					}
+				}
+				catch (...)
+				{
+					errors[index] = std::current_exception();
+				}
+			};
+			std::vector<std::thread> threads;
+			threads.reserve(amountOfThreads - 1);
+			const auto joinAll = [&threads]()
+			{
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			};
+			const int32_t rowsPerThread = m_height / static_cast<int32_t>(amountOfThreads);
+			const int32_t extraRows = m_height % static_cast<int32_t>(amountOfThreads);
+			int32_t startY = 0;
+			try
+			{
+				for (unsigned i = 0; i < amountOfThreads; i++)
+				{
+					const int32_t endY = startY + rowsPerThread + (static_cast<int32_t>(i) < extraRows ? 1 : 0);
+					if (i + 1 < amountOfThreads)
+					{
+						threads.emplace_back(band, i, startY, endY);
+					}
+					else
+					{
+						band(i, startY, endY);
+					}
+					startY = endY;
+				}
+			}
+			catch (...)
+			{
+				//Starting a thread failed.
+				joinAll();
+				throw;
+			}
+			joinAll();
+			for (const std::exception_ptr& error : errors)
+			{
+				if (error)
+				{
+					std::rethrow_exception(error);
+				}
+			}
+		}
+
+		T* getRaw()
+		{
+			return m_pdata;
+		}
+
+		const T* getRaw() const
+		{
+			return m_pdata;
+		}
+
+		//Amount of stored cells including the padding of the layout.
+		std::size_t getStorageLength() const
+		{
+			return m_storageLength;
+		}
+	};
+}
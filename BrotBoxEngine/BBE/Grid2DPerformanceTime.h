@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../BBE/Grid2D.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		template <typename Layout>
+		double grid2DStencilTime(const char* name, int32_t size, int iterations)
+		{
+			Grid2D<float, Layout> source(size, size, 1.f);
+			Grid2D<float, Layout> target(size, size);
+
+			CPUWatch watch;
+			for (int i = 0; i < iterations; i++)
+			{
+				//5 point blur, a typical diffusion step.
+				target.forEach([&](int32_t x, int32_t y, float& cell)
+				{
+					cell = (source.get(x, y) * 4.f
+						+ source.getClamped(x - 1, y) + source.getClamped(x + 1, y)
+						+ source.getClamped(x, y - 1) + source.getClamped(x, y + 1)) * 0.125f;
+				});
+				std::swap(source, target);
+			}
+			const double time = watch.getTimeExpiredSeconds();
+			std::cout << "    " << name << ": " << time << "s (" << source.get(size / 2, size / 2) << ")" << std::endl;
+			return time;
+		}
+
+		void grid2DPrintStencilSpeed()
+		{
+			for (int32_t size : { 256, 2048 })
+			{
+				const int iterations = size == 256 ? 200 : 5;
+				std::cout << size << "x" << size << ", " << iterations << " iterations" << std::endl;
+
+				//Hand rolled x + y * width array walked column by column, like ValueNoise2D::preCalculate did.
+				{
+					float* source = new float[size * size];
+					float* target = new float[size * size];
+					for (int32_t i = 0; i < size * size; i++)
+					{
+						source[i] = 1.f;
+					}
+					const auto at = [&](int32_t x, int32_t y)
+					{
+						x = x < 0 ? 0 : (x >= size ? size - 1 : x);
+						y = y < 0 ? 0 : (y >= size ? size - 1 : y);
+						return source[x + y * size];
+					};
+					CPUWatch watch;
+					for (int i = 0; i < iterations; i++)
+					{
+						for (int32_t x = 0; x < size; x++)
+						{
+							for (int32_t y = 0; y < size; y++)
+							{
+								target[x + y * size] = (at(x, y) * 4.f + at(x - 1, y) + at(x + 1, y) + at(x, y - 1) + at(x, y + 1)) * 0.125f;
+							}
+						}
+						std::swap(source, target);
+					}
+					std::cout << "    column major loops: " << watch.getTimeExpiredSeconds() << "s (" << source[size / 2 + size / 2 * size] << ")" << std::endl;
+					delete[] source;
+					delete[] target;
+				}
+
+				grid2DStencilTime<GridRowMajor>("GridRowMajor", size, iterations);
+				grid2DStencilTime<GridTiled<>>("GridTiled", size, iterations);
+				grid2DStencilTime<GridMorton>("GridMorton", size, iterations);
+
+				{
+					Grid2D<float> source(size, size, 1.f);
+					Grid2D<float> target(size, size);
+					CPUWatch watch;
+					for (int i = 0; i < iterations; i++)
+					{
+						target.parallelForRows([&](int32_t y)
+						{
+							Span<float> row = target.getRow(y);
+							for (int32_t x = 0; x < size; x++)
+							{
+								row[x] = (source.get(x, y) * 4.f
+									+ source.getClamped(x - 1, y) + source.getClamped(x + 1, y)
+									+ source.getClamped(x, y - 1) + source.getClamped(x, y + 1)) * 0.125f;
+							}
+						});
+						std::swap(source, target);
+					}
+					std::cout << "    GridRowMajor parallelForRows: " << watch.getTimeExpiredSeconds() << "s (" << source.get(size / 2, size / 2) << ")" << std::endl;
+				}
+			}
+		}
+	}
+}
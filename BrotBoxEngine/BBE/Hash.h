@@ -1,21 +1,56 @@
 #pragma once
 
 
-#include "../BBE/Array.h"
 #include <stdint.h>
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 
 namespace bbe
 {
+	//wyhash (final version 4) of length bytes. Well mixed in all 64 bits, fast for short and long inputs.
+	uint64_t hashBytes(const void* data, std::size_t length, uint64_t seed = 0);
+
+	namespace INTERNAL
+	{
+		//Finalizer of splitmix64. Every input bit affects every output bit.
+		inline uint64_t hashMix64(uint64_t x)
+		{
+			x ^= x >> 30;
+			x *= 0xBF58476D1CE4E5B9ull;
+			x ^= x >> 27;
+			x *= 0x94D049BB133111EBull;
+			x ^= x >> 31;
+			return x;
+		}
+
+		inline uint32_t hashFold(uint64_t x)
+		{
+			return static_cast<uint32_t>(x ^ (x >> 32));
+		}
+	}
+
+	//Mixes the hash of another value into seed. The order of the combined hashes matters.
+	inline uint32_t hashCombine(uint32_t seed, uint32_t valueHash)
+	{
+		return INTERNAL::hashFold(INTERNAL::hashMix64((static_cast<uint64_t>(seed) << 32) | valueHash));
+	}
+
 	template<typename T>
 	uint32_t hash(const T &t)
 	{
 		static_assert(std::is_fundamental<T>::value && !std::is_class<T>::value, "No valid hash function found.");
-		return static_cast<uint32_t>(t);
+		uint64_t bits = 0;
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			//-0 and 0 compare equal, so they must hash equal. long double has padding bytes, so it goes through double.
+			const double value = t == 0 ? 0.0 : static_cast<double>(t);
+			std::memcpy(&bits, &value, sizeof(value));
+		}
+		else
+		{
+			bits = static_cast<uint64_t>(t);
+		}
+		return INTERNAL::hashFold(INTERNAL::hashMix64(bits));
 	}
-
-
-
-
-
 }
@@ -3,16 +3,24 @@
 #include "../BBE/List.h"
 #include "../BBE/Hash.h"
 #include "../BBE/Exceptions.h"
+#include "../BBE/Unconstructed.h"
+#include "../BBE/STLCapsule.h"
+#include <cstdint>
+#include <cstring>
 
 namespace bbe
 {
-
-
+	//Open addressing hash map using robin hood probing.
+	//All nodes live in one flat array; a parallel array stores the probe
+	//distance of every slot (0 = empty, otherwise distance + 1). Lookups may
+	//stop as soon as they meet a slot that is closer to its home than the
+	//searched key would be. Insertion shifts the tail of a cluster to the right,
+	//removal shifts it back to the left, so no tombstones are needed.
 	//TODO use own allocators
 	template<typename Key, typename Value>
 	class HashMap
 	{
-	private:
+	public:
 		class HashMapNode
 		{
 			friend class HashMap<Key, Value>;
@@ -21,184 +29,558 @@ namespace bbe
 			Value    m_value;
 			uint32_t m_hash;
 
-			HashMapNode(const Key &key, const Value &value, const uint32_t _hash)
-				: m_key(key), m_value(value), m_hash(_hash)
+			template <typename K, typename... arguments>
+			HashMapNode(const uint32_t _hash, K&& key, arguments&&... args)
+				: m_key(std::forward<K>(key)), m_value(std::forward<arguments>(args)...), m_hash(_hash)
 			{
 				//do nothing
 			}
+
+		public:
+			HashMapNode(const HashMapNode&) = default;
+			HashMapNode(HashMapNode&&) = default;
+
+			const Key& getKey() const
+			{
+				return m_key;
+			}
+
+			Value& getValue()
+			{
+				return m_value;
+			}
+
+			const Value& getValue() const
+			{
+				return m_value;
+			}
+		};
+
+	private:
+		template <typename MapType, typename NodeType>
+		class IteratorBase
+		{
+			friend class HashMap<Key, Value>;
+		private:
+			MapType* m_pmap;
+			size_t   m_index;
+
+			IteratorBase(MapType* map, size_t index)
+				: m_pmap(map), m_index(index)
+			{
+				skipEmpty();
+			}
+
+			void skipEmpty()
+			{
+				while (m_index < m_pmap->m_capacity && m_pmap->m_pdistances[m_index] == 0)
+				{
+					m_index++;
+				}
+			}
+
+		public:
+			NodeType& operator*() const
+			{
+				return m_pmap->m_pnodes[m_index].m_value;
+			}
+
+			NodeType* operator->() const
+			{
+				return bbe::addressOf(m_pmap->m_pnodes[m_index].m_value);
+			}
+
+			IteratorBase& operator++()
+			{
+				m_index++;
+				skipEmpty();
+				return *this;
+			}
+
+			bool operator==(const IteratorBase& other) const
+			{
+				return m_pmap == other.m_pmap && m_index == other.m_index;
+			}
+
+			bool operator!=(const IteratorBase& other) const
+			{
+				return !operator==(other);
+			}
 		};
-		List<HashMapNode> *m_pcontainers = nullptr;
-		size_t             m_amountOfContainers = 0;
 
 	public:
-		HashMap()
-			: m_amountOfContainers(1 << 4)
+		using Iterator      = IteratorBase<HashMap<Key, Value>, HashMapNode>;
+		using ConstIterator = IteratorBase<const HashMap<Key, Value>, const HashMapNode>;
+
+	private:
+		static constexpr size_t HASH_MAP_MIN_CAPACITY     = 16;
+		static constexpr float  HASH_MAP_DEFAULT_LOAD     = 0.8f;
+		static constexpr size_t HASH_MAP_MAX_PROBE_LENGTH = 0xFFFF;
+
+		INTERNAL::Unconstructed<HashMapNode> *m_pnodes = nullptr;
+		uint16_t                             *m_pdistances = nullptr;
+		size_t                                m_capacity = 0;
+		size_t                                m_length = 0;
+		size_t                                m_shift = 64;
+		size_t                                m_maxLength = 0;
+		float                                 m_maxLoadFactor = HASH_MAP_DEFAULT_LOAD;
+
+		size_t getHomeIndex(uint32_t _hash) const
 		{
-			m_pcontainers = new List<HashMapNode>[m_amountOfContainers];
+			//Fibonacci hashing spreads identity hashes of sequential or strided keys over the whole table.
+			return static_cast<size_t>((static_cast<uint64_t>(_hash) * 0x9E3779B97F4A7C15ull) >> m_shift);
 		}
 
-		HashMap(const HashMap& hm)
+		size_t findIndex(const Key &key, uint32_t _hash) const
+		{
+			if (m_length == 0)
+			{
+				return m_capacity;
+			}
+
+			const size_t mask = m_capacity - 1;
+			size_t index = getHomeIndex(_hash);
+			for (uint32_t distance = 1; ; distance++)
+			{
+				const uint16_t slotDistance = m_pdistances[index];
+				if (slotDistance < distance)
+				{
+					//Either empty or a richer node. Robin hood guarantees the key is not further down.
+					return m_capacity;
+				}
+				const HashMapNode &node = m_pnodes[index].m_value;
+				if (node.m_hash == _hash && node.m_key == key)
+				{
+					return index;
+				}
+				index = (index + 1) & mask;
+			}
+		}
+
+		//Finds the slot a node with the given hash belongs to and makes room for it by
+		//shifting the rest of the cluster one slot to the right. Returns m_capacity if
+		//a probe sequence would grow too long, in which case the table must be grown.
+		size_t makeRoom(uint32_t _hash, uint16_t &outDistance)
 		{
-			//UNTESTED
-			m_amountOfContainers = hm.m_amountOfContainers;
-			m_pcontainers = new List<Value>[m_amountOfContainers];
-			for (size_t i = 0; i < m_amountOfContainers; i++)
+			const size_t mask = m_capacity - 1;
+			size_t index = getHomeIndex(_hash);
+			size_t distance = 1;
+			while (m_pdistances[index] >= distance)
 			{
-				for (size_t k = 0; k < hm.m_pcontainers[i].getLength(); k++)
+				index = (index + 1) & mask;
+				distance++;
+				if (distance >= HASH_MAP_MAX_PROBE_LENGTH)
 				{
-					m_pcontainers[i].add(hm.m_pcontainers[i][k]);
+					return m_capacity;
 				}
 			}
+
+			if (m_pdistances[index] != 0)
+			{
+				size_t empty = index;
+				while (m_pdistances[empty] != 0)
+				{
+					if (m_pdistances[empty] + 1u >= HASH_MAP_MAX_PROBE_LENGTH)
+					{
+						return m_capacity;
+					}
+					empty = (empty + 1) & mask;
+				}
+				while (empty != index)
+				{
+					const size_t previous = (empty - 1) & mask;
+					new (bbe::addressOf(m_pnodes[empty].m_value)) HashMapNode(std::move(m_pnodes[previous].m_value));
+					m_pnodes[previous].m_value.~HashMapNode();
+					m_pdistances[empty] = m_pdistances[previous] + 1;
+					empty = previous;
+				}
+				m_pdistances[index] = 0;
+			}
+
+			outDistance = static_cast<uint16_t>(distance);
+			return index;
 		}
 
-		HashMap(HashMap&& hm)
+		//Closes the empty slot at index by shifting the following nodes of its cluster one slot to the left.
+		void closeGap(size_t index)
 		{
-			//UNTESTED
-			m_pcontainers = hm.m_pcontainers;
-			m_amountOfContainers = hm.m_pcontainers;
-			
-			hm.m_pcontainers = nullptr;
-			hm.m_amountOfContainers = 0;
+			const size_t mask = m_capacity - 1;
+			size_t next = (index + 1) & mask;
+			while (m_pdistances[next] > 1)
+			{
+				new (bbe::addressOf(m_pnodes[index].m_value)) HashMapNode(std::move(m_pnodes[next].m_value));
+				m_pnodes[next].m_value.~HashMapNode();
+				m_pdistances[index] = m_pdistances[next] - 1;
+				index = next;
+				next = (next + 1) & mask;
+			}
+			m_pdistances[index] = 0;
 		}
 
-		HashMap& operator=(const HashMap& hm)
+		void allocate(size_t capacity)
 		{
-			//UNTESTED
-			if (this == &hm)
+			m_capacity = capacity;
+			m_shift = 64;
+			for (size_t c = capacity; c > 1; c >>= 1)
 			{
-				return *this;
+				m_shift--;
 			}
-			if (m_pcontainers != nullptr)
+			m_maxLength = static_cast<size_t>(static_cast<float>(m_capacity) * m_maxLoadFactor);
+			if (m_maxLength >= m_capacity)
 			{
-				delete[] m_pcontainers;
+				m_maxLength = m_capacity - 1;
 			}
+			m_pnodes = new INTERNAL::Unconstructed<HashMapNode>[m_capacity];
+			m_pdistances = new uint16_t[m_capacity];
+			std::memset(m_pdistances, 0, m_capacity * sizeof(uint16_t));
+		}
 
-			m_amountOfContainers = hm.m_amountOfContainers;
-			m_pcontainers = new List<Value>[m_amountOfContainers];
-			for (size_t i = 0; i < m_amountOfContainers; i++)
+		void release()
+		{
+			clear();
+			if (m_pnodes != nullptr)
 			{
-				for (size_t k = 0; k < hm.m_pcontainers[i].getLength(); k++)
+				delete[] m_pnodes;
+				m_pnodes = nullptr;
+			}
+			if (m_pdistances != nullptr)
+			{
+				delete[] m_pdistances;
+				m_pdistances = nullptr;
+			}
+			m_capacity = 0;
+			m_maxLength = 0;
+			m_shift = 64;
+		}
+
+		static size_t capacityFor(size_t amountOfElements, float loadFactor)
+		{
+			size_t capacity = HASH_MAP_MIN_CAPACITY;
+			while (static_cast<size_t>(static_cast<float>(capacity) * loadFactor) < amountOfElements)
+			{
+				capacity <<= 1;
+			}
+			return capacity;
+		}
+
+		void rehash(size_t newCapacity)
+		{
+			INTERNAL::Unconstructed<HashMapNode> *oldNodes = m_pnodes;
+			uint16_t *oldDistances = m_pdistances;
+			const size_t oldCapacity = m_capacity;
+
+			allocate(newCapacity);
+			m_length = 0;
+
+			for (size_t i = 0; i < oldCapacity; i++)
+			{
+				if (oldDistances[i] != 0)
 				{
-					m_pcontainers[i].add(hm.m_pcontainers[i][k]);
+					HashMapNode &node = oldNodes[i].m_value;
+					uint16_t distance = 0;
+					size_t index = 0;
+					while ((index = makeRoom(node.m_hash, distance)) == m_capacity)
+					{
+						rehash(m_capacity << 1);
+					}
+					new (bbe::addressOf(m_pnodes[index].m_value)) HashMapNode(std::move(node));
+					m_pdistances[index] = distance;
+					m_length++;
+					node.~HashMapNode();
 				}
 			}
 
-			return *this;
+			if (oldNodes != nullptr)
+			{
+				delete[] oldNodes;
+			}
+			if (oldDistances != nullptr)
+			{
+				delete[] oldDistances;
+			}
 		}
 
-		HashMap& operator=(HashMap&& hm)
+		template <typename K, typename... arguments>
+		size_t emplaceNew(uint32_t _hash, K&& key, arguments&&... args)
+		{
+			if (m_length + 1 > m_maxLength)
+			{
+				rehash(m_capacity == 0 ? HASH_MAP_MIN_CAPACITY : m_capacity << 1);
+			}
+			uint16_t distance = 0;
+			size_t index = 0;
+			while ((index = makeRoom(_hash, distance)) == m_capacity)
+			{
+				rehash(m_capacity << 1);
+			}
+			try
+			{
+				new (bbe::addressOf(m_pnodes[index].m_value)) HashMapNode(_hash, std::forward<K>(key), std::forward<arguments>(args)...);
+			}
+			catch (...)
+			{
+				closeGap(index);
+				throw;
+			}
+			m_pdistances[index] = distance;
+			m_length++;
+			return index;
+		}
+
+	public:
+		HashMap()
+		{
+			//do nothing
+		}
+
+		explicit HashMap(size_t amountOfElements)
+		{
+			reserve(amountOfElements);
+		}
+
+		HashMap(const HashMap& hm)
+			: m_maxLoadFactor(hm.m_maxLoadFactor)
+		{
+			if (hm.m_capacity == 0)
+			{
+				return;
+			}
+			allocate(hm.m_capacity);
+			for (size_t i = 0; i < m_capacity; i++)
+			{
+				if (hm.m_pdistances[i] != 0)
+				{
+					new (bbe::addressOf(m_pnodes[i].m_value)) HashMapNode(hm.m_pnodes[i].m_value);
+					m_pdistances[i] = hm.m_pdistances[i];
+					m_length++;
+				}
+			}
+		}
+
+		HashMap(HashMap&& hm)
+			: m_pnodes(hm.m_pnodes), m_pdistances(hm.m_pdistances), m_capacity(hm.m_capacity), m_length(hm.m_length),
+			m_shift(hm.m_shift), m_maxLength(hm.m_maxLength), m_maxLoadFactor(hm.m_maxLoadFactor)
+		{
+			hm.m_pnodes = nullptr;
+			hm.m_pdistances = nullptr;
+			hm.m_capacity = 0;
+			hm.m_length = 0;
+			hm.m_shift = 64;
+			hm.m_maxLength = 0;
+		}
+
+		HashMap& operator=(const HashMap& hm)
 		{
-			//UNTESTED
 			if (this == &hm)
 			{
 				return *this;
 			}
-			if (m_pcontainers != nullptr)
+			HashMap copy(hm);
+			return operator=(std::move(copy));
+		}
+
+		HashMap& operator=(HashMap&& hm)
+		{
+			if (this == &hm)
 			{
-				delete[] m_pcontainers;
+				return *this;
 			}
+			release();
 
-			m_pcontainers = hm.m_pcontainers;
-			m_amountOfContainers = hm.m_pcontainers;
+			m_pnodes        = hm.m_pnodes;
+			m_pdistances    = hm.m_pdistances;
+			m_capacity      = hm.m_capacity;
+			m_length        = hm.m_length;
+			m_shift         = hm.m_shift;
+			m_maxLength     = hm.m_maxLength;
+			m_maxLoadFactor = hm.m_maxLoadFactor;
 
-			hm.m_pcontainers = nullptr;
-			hm.m_amountOfContainers = 0;
+			hm.m_pnodes = nullptr;
+			hm.m_pdistances = nullptr;
+			hm.m_capacity = 0;
+			hm.m_length = 0;
+			hm.m_shift = 64;
+			hm.m_maxLength = 0;
 
 			return *this;
 		}
 
 		~HashMap()
 		{
-			if (m_pcontainers != nullptr)
-			{
-				delete[] m_pcontainers;
-			}
-			m_pcontainers = nullptr;
-			m_amountOfContainers = 0;
+			release();
 		}
 
 		void add(const Key &key, const Value &value)
 		{
-			uint32_t _hash = hash(key);
-			uint32_t index = _hash & (m_amountOfContainers - 1);
+			const uint32_t _hash = hash(key);
+			if (findIndex(key, _hash) != m_capacity)
+			{
+				throw KeyAlreadyUsedException();
+			}
+			emplaceNew(_hash, key, value);
+		}
 
-			if (m_pcontainers[index].getLength() > 4)
+		void add(Key &&key, Value &&value)
+		{
+			const uint32_t _hash = hash(key);
+			if (findIndex(key, _hash) != m_capacity)
 			{
-				uint32_t differentHashes = 0;
-				for (size_t i = 0; i < m_pcontainers[index].getLength(); i++)
-				{
-					uint32_t otherHash = hash(m_pcontainers[index][i].m_key);
-					if (otherHash != _hash)
-					{
-						differentHashes++;
-						if (differentHashes >= 3)
-						{
-							resize();
-							index = _hash & (m_amountOfContainers - 1);
-							break;
-						}
-					}
-				}
+				throw KeyAlreadyUsedException();
 			}
+			emplaceNew(_hash, std::move(key), std::move(value));
+		}
 
-			for (size_t i = 0; i < m_pcontainers[index].getLength(); i++)
+		template <typename... arguments>
+		Value& emplace(const Key &key, arguments&&... args)
+		{
+			const uint32_t _hash = hash(key);
+			if (findIndex(key, _hash) != m_capacity)
 			{
-				if (key == m_pcontainers[index][i].m_key)
-				{
-					throw KeyAlreadyUsedException();
-				}
+				throw KeyAlreadyUsedException();
 			}
+			const size_t index = emplaceNew(_hash, key, std::forward<arguments>(args)...);
+			return m_pnodes[index].m_value.m_value;
+		}
 
-			m_pcontainers[index].add(HashMapNode(key, value, _hash));
+		template <typename... arguments>
+		Value& getOrEmplace(const Key &key, arguments&&... args)
+		{
+			const uint32_t _hash = hash(key);
+			size_t index = findIndex(key, _hash);
+			if (index != m_capacity)
+			{
+				return m_pnodes[index].m_value.m_value;
+			}
+			index = emplaceNew(_hash, key, std::forward<arguments>(args)...);
+			return m_pnodes[index].m_value.m_value;
 		}
 
-		bool contains(const Key &key)
+		bool contains(const Key &key) const
 		{
 			return get(key) != nullptr;
 		}
 
 		Value* get(const Key &key)
 		{
-			uint32_t _hash = hash(key);
-			uint32_t index = _hash & (m_amountOfContainers - 1);
+			const size_t index = findIndex(key, hash(key));
+			if (index == m_capacity)
+			{
+				return nullptr;
+			}
+			return bbe::addressOf(m_pnodes[index].m_value.m_value);
+		}
+
+		const Value* get(const Key &key) const
+		{
+			const size_t index = findIndex(key, hash(key));
+			if (index == m_capacity)
+			{
+				return nullptr;
+			}
+			return bbe::addressOf(m_pnodes[index].m_value.m_value);
+		}
+
+		bool remove(const Key &key)
+		{
+			size_t index = findIndex(key, hash(key));
+			if (index == m_capacity)
+			{
+				return false;
+			}
+
+			m_pnodes[index].m_value.~HashMapNode();
+			closeGap(index);
+			m_length--;
+			return true;
+		}
 
-			for (size_t i = 0; i < m_pcontainers[index].getLength(); i++)
+		void clear()
+		{
+			if (!std::is_trivially_destructible<HashMapNode>::value)
 			{
-				if (m_pcontainers[index][i].m_key == key)
+				for (size_t i = 0; i < m_capacity; i++)
 				{
-					return &(m_pcontainers[index][i].m_value);
+					if (m_pdistances[i] != 0)
+					{
+						m_pnodes[i].m_value.~HashMapNode();
+					}
 				}
 			}
-			return nullptr;
+			if (m_pdistances != nullptr)
+			{
+				std::memset(m_pdistances, 0, m_capacity * sizeof(uint16_t));
+			}
+			m_length = 0;
 		}
 
-		bool remove(const Key &key)
+		void reserve(size_t amountOfElements)
 		{
-			//TODO
-			//UNTESTED
-			return false;
+			if (amountOfElements <= m_maxLength)
+			{
+				return;
+			}
+			rehash(capacityFor(amountOfElements, m_maxLoadFactor));
 		}
 
-	private:
-		void resize()
+		size_t getLength() const
+		{
+			return m_length;
+		}
+
+		size_t getCapacity() const
 		{
-			size_t newAmountOfContainers = m_amountOfContainers << 1;
-			List<HashMapNode> *newContainers = new List<HashMapNode>[newAmountOfContainers];
+			return m_capacity;
+		}
 
-			for (size_t i = 0; i < m_amountOfContainers; i++)
+		bool isEmpty() const
+		{
+			return m_length == 0;
+		}
+
+		float getMaxLoadFactor() const
+		{
+			return m_maxLoadFactor;
+		}
+
+		void setMaxLoadFactor(float maxLoadFactor)
+		{
+			if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
 			{
-				for (size_t k = 0; k < m_pcontainers[i].getLength(); k++)
+				throw IllegalArgumentException();
+			}
+			m_maxLoadFactor = maxLoadFactor;
+			if (m_capacity > 0)
+			{
+				m_maxLength = static_cast<size_t>(static_cast<float>(m_capacity) * m_maxLoadFactor);
+				if (m_maxLength >= m_capacity)
 				{
-					uint32_t _hash = m_pcontainers[i][k].m_hash;
-					uint32_t index = _hash & (newAmountOfContainers - 1);
-
-					newContainers[index].add(std::move(m_pcontainers[i][k]));
+					m_maxLength = m_capacity - 1;
+				}
+				if (m_length > m_maxLength)
+				{
+					rehash(capacityFor(m_length, m_maxLoadFactor));
 				}
 			}
+		}
 
-			delete[] m_pcontainers;
-			m_pcontainers = newContainers;
-			m_amountOfContainers = newAmountOfContainers;
+		Iterator begin()
+		{
+			return Iterator(this, 0);
+		}
+
+		Iterator end()
+		{
+			return Iterator(this, m_capacity);
+		}
+
+		ConstIterator begin() const
+		{
+			return ConstIterator(this, 0);
+		}
+
+		ConstIterator end() const
+		{
+			return ConstIterator(this, m_capacity);
 		}
 	};
 }
@@ -19,7 +19,7 @@ namespace bbe
 				CPUWatch watchAdd;
 				for (int i = 0; i < 1024 * 1024; i++)
 				{
-					map.add(i, L"Hallo");
+					map.add(i, "Hallo");
 				}
 				std::cout << "BBE Hashmap add speed: " << watchAdd.getTimeExpiredSeconds() << std::endl;
 
@@ -29,6 +29,13 @@ namespace bbe
 					map.get(i);
 				}
 				std::cout << "BBE Hashmap get speed: " << watchGet.getTimeExpiredSeconds() << std::endl;
+
+				CPUWatch watchRemove;
+				for (int i = 0; i < 1024 * 1024; i++)
+				{
+					map.remove(i);
+				}
+				std::cout << "BBE Hashmap remove speed: " << watchRemove.getTimeExpiredSeconds() << std::endl;
 			}
 
 			{
@@ -40,7 +47,7 @@ namespace bbe
 				CPUWatch watchAdd;
 				for (int i = 0; i < 1024 * 1024; i++)
 				{
-					map.insert(std::pair<int, bbe::String>(i, L"Hallo"));
+					map.insert(std::pair<int, bbe::String>(i, "Hallo"));
 				}
 				std::cout << "STD Hashmap add speed: " << watchAdd.getTimeExpiredSeconds() << std::endl;
 
@@ -50,6 +57,13 @@ namespace bbe
 					map.find(i);
 				}
 				std::cout << "STD Hashmap get speed: " << watchGet.getTimeExpiredSeconds() << std::endl;
+
+				CPUWatch watchRemove;
+				for (int i = 0; i < 1024 * 1024; i++)
+				{
+					map.erase(i);
+				}
+				std::cout << "STD Hashmap remove speed: " << watchRemove.getTimeExpiredSeconds() << std::endl;
 			}
 		}
 	}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../BBE/Hash.h"
+#include "../BBE/String.h"
+#include "../BBE/Vector2.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//Prints how many keys landed in an already occupied bucket and the size of the fullest bucket.
+		template<typename Hasher>
+		void hashPrintDistribution(const char* name, const List<uint32_t>& hashes, Hasher hasher)
+		{
+			constexpr uint32_t BUCKETS = 1 << 16;
+			List<uint32_t> bucketSizes;
+			bucketSizes.resizeCapacityAndLength(BUCKETS);
+			for (uint32_t i = 0; i < BUCKETS; i++)
+			{
+				bucketSizes[i] = 0;
+			}
+
+			size_t collisions = 0;
+			uint32_t fullestBucket = 0;
+			for (size_t i = 0; i < hashes.getLength(); i++)
+			{
+				uint32_t& bucket = bucketSizes[hasher(hashes[i]) & (BUCKETS - 1)];
+				if (bucket > 0)
+				{
+					collisions++;
+				}
+				bucket++;
+				if (bucket > fullestBucket)
+				{
+					fullestBucket = bucket;
+				}
+			}
+			std::cout << "    " << name << ": " << collisions << " collisions, fullest bucket " << fullestBucket << std::endl;
+		}
+
+		void hashPrintDistributions()
+		{
+			//Each key set has 65536 keys for 65536 buckets. An ideal hash has about 24000 collisions and a fullest bucket of about 8.
+			List<uint32_t> sequential;
+			List<uint32_t> pageAligned;
+			List<uint32_t> grid;
+			for (uint32_t i = 0; i < (1 << 16); i++)
+			{
+				sequential.add(i);
+				pageAligned.add(i * 4096);
+			}
+			for (int32_t x = 0; x < 256; x++)
+			{
+				for (int32_t y = 0; y < 256; y++)
+				{
+					//Grid coordinates packed into a single integer key.
+					grid.add(static_cast<uint32_t>(x * 1024 + y));
+				}
+			}
+
+			const auto identity = [](uint32_t key) { return key; };
+			const auto mixed = [](uint32_t key) { return hash(key); };
+
+			std::cout << "Sequential integers" << std::endl;
+			hashPrintDistribution("identity", sequential, identity);
+			hashPrintDistribution("hash    ", sequential, mixed);
+			std::cout << "Multiples of 4096" << std::endl;
+			hashPrintDistribution("identity", pageAligned, identity);
+			hashPrintDistribution("hash    ", pageAligned, mixed);
+			std::cout << "Grid coordinates x * 1024 + y" << std::endl;
+			hashPrintDistribution("identity", grid, identity);
+			hashPrintDistribution("hash    ", grid, mixed);
+
+			//Vector2i keys, combining the coordinates instead of packing them.
+			List<uint32_t> gridHashes;
+			for (int32_t x = 0; x < 256; x++)
+			{
+				for (int32_t y = 0; y < 256; y++)
+				{
+					gridHashes.add(hash(Vector2i(x, y)));
+				}
+			}
+			hashPrintDistribution("Vector2i", gridHashes, identity);
+		}
+
+		void hashPrintStringSpeed()
+		{
+			//djb2 over the first 128 bytes, the previous string hash.
+			const auto djb2 = [](const char* data, size_t length)
+			{
+				uint32_t _hash = 5381;
+				if (length > 128)
+				{
+					length = 128;
+				}
+				for (size_t i = 0; i < length; i++)
+				{
+					_hash = ((_hash << 5) + _hash) + data[i];
+				}
+				return _hash;
+			};
+
+			for (size_t length : { 8, 32, 128, 1024 })
+			{
+				List<char> data;
+				for (size_t i = 0; i < length; i++)
+				{
+					data.add(static_cast<char>('a' + i % 26));
+				}
+				constexpr size_t ITERATIONS = 1000000;
+
+				uint32_t sink = 0;
+				CPUWatch djb2Watch;
+				for (size_t i = 0; i < ITERATIONS; i++)
+				{
+					data[0] = static_cast<char>(i);
+					sink += djb2(data.getRaw(), length);
+				}
+				const double djb2Time = djb2Watch.getTimeExpiredSeconds();
+
+				CPUWatch wyhashWatch;
+				for (size_t i = 0; i < ITERATIONS; i++)
+				{
+					data[0] = static_cast<char>(i);
+					sink += static_cast<uint32_t>(hashBytes(data.getRaw(), length));
+				}
+				const double wyhashTime = wyhashWatch.getTimeExpiredSeconds();
+
+				std::cout << length << " bytes: djb2 " << djb2Time << "s, hashBytes " << wyhashTime << "s (" << sink << ")" << std::endl;
+			}
+		}
+	}
+}
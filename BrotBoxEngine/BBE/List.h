@@ -7,21 +7,108 @@
 #include "../BBE/UtilDebug.h"
 #include "../BBE/Hash.h"
 #include "../BBE/Exceptions.h"
+#include "../BBE/STLAllocator.h"
 #include <initializer_list>
 #include <iostream>
 #include <cstring>
+#include <limits>
+#include <type_traits>
+#include <memory>
 
 namespace bbe
 {
-	template <typename T, bool keepSorted = false>
-	class List
+	//The Allocator follows the STL allocator interface. It is rebound to the
+	//internal storage type and stored as an empty base, so stateless
+	//allocators do not increase the size of a List.
+	template <typename T, bool keepSorted = false, typename Allocator = STLAllocator<T>>
+	class List : private std::allocator_traits<Allocator>::template rebind_alloc<INTERNAL::Unconstructed<T>>
 	{
-		//TODO use own allocators
 	private:
+		using StorageAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<INTERNAL::Unconstructed<T>>;
+
 		size_t m_length;
 		size_t m_capacity;
 		INTERNAL::Unconstructed<T>* m_pdata;
 
+		//Trivially copyable types can be relocated with a single memcpy/memmove
+		//instead of a move construction and destruction per element.
+		static constexpr bool isTriviallyRelocatable = std::is_trivially_copyable<T>::value;
+
+		//The templated predicate overloads accept any callable directly. This way
+		//small lambdas get inlined instead of being type erased by std::function.
+		template <typename Predicate>
+		using EnableIfPredicate = typename std::enable_if<std::is_invocable_r<bool, Predicate&, const T&>::value, int>::type;
+
+		template <typename Predicate>
+		using EnableIfComparator = typename std::enable_if<std::is_invocable_r<bool, Predicate&, const T&, const T&>::value, int>::type;
+
+		using StdPredicate = std::function<bool(const T&)>;
+		using StdComparator = std::function<bool(const T&, const T&)>;
+
+		static void relocate(INTERNAL::Unconstructed<T>* dest, INTERNAL::Unconstructed<T>* src, size_t amount)
+		{
+			if constexpr (isTriviallyRelocatable)
+			{
+				if (amount > 0)
+				{
+					std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * amount);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < amount; i++)
+				{
+					new (bbe::addressOf(dest[i].m_value)) T(std::move(src[i].m_value));
+					src[i].m_value.~T();
+				}
+			}
+		}
+
+		static void copyConstruct(INTERNAL::Unconstructed<T>* dest, const INTERNAL::Unconstructed<T>* src, size_t amount)
+		{
+			if constexpr (isTriviallyRelocatable)
+			{
+				if (amount > 0)
+				{
+					std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * amount);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < amount; i++)
+				{
+					new (bbe::addressOf(dest[i].m_value)) T(src[i].m_value);
+				}
+			}
+		}
+
+		StorageAllocator& getStorageAllocator()
+		{
+			return *this;
+		}
+
+		const StorageAllocator& getStorageAllocator() const
+		{
+			return *this;
+		}
+
+		INTERNAL::Unconstructed<T>* allocateStorage(size_t amount)
+		{
+			if (amount == 0)
+			{
+				return nullptr;
+			}
+			return std::allocator_traits<StorageAllocator>::allocate(getStorageAllocator(), amount);
+		}
+
+		void deallocateStorage(INTERNAL::Unconstructed<T>* data, size_t amount)
+		{
+			if (data != nullptr)
+			{
+				std::allocator_traits<StorageAllocator>::deallocate(getStorageAllocator(), data, amount);
+			}
+		}
+
 		void growIfNeeded(size_t amountOfNewObjects)
 		{
 			if (m_capacity < m_length + amountOfNewObjects)
@@ -32,18 +119,11 @@ namespace bbe
 					newCapacity = m_capacity * 2;
 				}
 
-				INTERNAL::Unconstructed<T>* newData = new INTERNAL::Unconstructed<T>[newCapacity];
+				INTERNAL::Unconstructed<T>* newData = allocateStorage(newCapacity);
 
-				for (size_t i = 0; i < m_length; i++)
-				{
-					new (bbe::addressOf(newData[i].m_value)) T(std::move(m_pdata[i].m_value));
-					m_pdata[i].m_value.~T();
-				}
+				relocate(newData, m_pdata, m_length);
 
-				if (m_pdata != nullptr)
-				{
-					delete[] m_pdata;
-				}
+				deallocateStorage(m_pdata, m_capacity);
 				m_pdata = newData;
 				m_capacity = newCapacity;
 			}
@@ -56,17 +136,23 @@ namespace bbe
 			//DO NOTHING
 		}
 
+		explicit List(const Allocator& allocator)
+			: StorageAllocator(allocator), m_length(0), m_capacity(0), m_pdata(nullptr)
+		{
+			//DO NOTHING
+		}
+
 		explicit List(size_t amountOfData)
 			: m_length(0), m_capacity(amountOfData)
 		{
-			m_pdata = new INTERNAL::Unconstructed<T>[amountOfData];
+			m_pdata = allocateStorage(amountOfData);
 		}
 
 		template <typename... arguments>
 		List(size_t amountOfObjects, arguments&&... args)
 			: m_length(amountOfObjects), m_capacity(amountOfObjects)
 		{
-			m_pdata = new INTERNAL::Unconstructed<T>[amountOfObjects];
+			m_pdata = allocateStorage(amountOfObjects);
 			const T copyVal = T(std::forward<arguments>(args)...);
 			for (size_t i = 0; i < amountOfObjects; i++)
 			{
@@ -74,18 +160,15 @@ namespace bbe
 			}
 		}
 
-		List(const List<T, keepSorted>& other)
-			: m_length(other.m_length), m_capacity(other.m_capacity)
+		List(const List& other)
+			: StorageAllocator(other.getStorageAllocator()), m_length(other.m_length), m_capacity(other.m_capacity)
 		{
-			m_pdata = new INTERNAL::Unconstructed<T>[m_capacity];
-			for (size_t i = 0; i < m_length; i++)
-			{
-				new (bbe::addressOf(m_pdata[i])) T(other.m_pdata[i].m_value);
-			}
+			m_pdata = allocateStorage(m_capacity);
+			copyConstruct(m_pdata, other.m_pdata, m_length);
 		}
 
-		List(List<T, keepSorted>&& other)
-			: m_length(other.m_length), m_capacity(other.m_capacity), m_pdata(other.m_pdata)
+		List(List&& other)
+			: StorageAllocator(std::move(other.getStorageAllocator())), m_length(other.m_length), m_capacity(other.m_capacity), m_pdata(other.m_pdata)
 		{
 			other.m_pdata = nullptr;
 			other.m_length = 0;
@@ -95,41 +178,42 @@ namespace bbe
 		/*nonexplicit*/ List(const std::initializer_list<T> &il)
 			: m_length(0), m_capacity(il.size())
 		{
-			m_pdata = new INTERNAL::Unconstructed<T>[m_capacity];
+			m_pdata = allocateStorage(m_capacity);
 			for (auto iter = il.begin(); iter != il.end(); iter++) {
 				add(*iter);
 			}
 		}
 
-		List& operator=(const List<T, keepSorted>& other)
+		List& operator=(const List& other)
 		{
-			clear();
-
-			if (m_pdata != nullptr)
+			if (this == &other)
 			{
-				delete[] m_pdata;
+				return *this;
 			}
+			clear();
+
+			deallocateStorage(m_pdata, m_capacity);
 
 			m_length = other.m_length;
 			m_capacity = other.m_capacity;
-			m_pdata = new INTERNAL::Unconstructed<T>[m_capacity];
-			for (size_t i = 0; i < m_capacity; i++)
-			{
-				new (bbe::addressOf(m_pdata[i])) T(other.m_pdata[i].m_value);
-			}
+			m_pdata = allocateStorage(m_capacity);
+			copyConstruct(m_pdata, other.m_pdata, m_length);
 
 			return *this;
 		}
 
-		List& operator=(List<T, keepSorted>&& other)
+		List& operator=(List&& other)
 		{
-			clear();
-
-			if (m_pdata != nullptr)
+			if (this == &other)
 			{
-				delete[] m_pdata;
+				return *this;
 			}
+			clear();
 
+			deallocateStorage(m_pdata, m_capacity);
+
+			//The storage is stolen, so the allocator that owns it has to come along.
+			getStorageAllocator() = std::move(other.getStorageAllocator());
 			m_length = other.m_length;
 			m_capacity = other.m_capacity;
 			m_pdata = other.m_pdata;
@@ -145,10 +229,7 @@ namespace bbe
 		{
 			clear();
 
-			if (m_pdata != nullptr)
-			{
-				delete[] m_pdata;
-			}
+			deallocateStorage(m_pdata, m_capacity);
 
 			m_pdata = nullptr;
 			m_length = 0;
@@ -165,6 +246,11 @@ namespace bbe
 			return m_length;
 		}
 
+		Allocator getAllocator() const
+		{
+			return Allocator(getStorageAllocator());
+		}
+
 		T* getRaw()
 		{
 			return reinterpret_cast<T*>(m_pdata);
@@ -199,7 +285,7 @@ namespace bbe
 			return m_pdata[index].m_value;
 		}
 
-		List<T, keepSorted>& operator+=(List<T, keepSorted> other)
+		List& operator+=(List other)
 		{
 			for (size_t i = 0; i < other.m_length; i++)
 			{
@@ -349,6 +435,39 @@ namespace bbe
 			m_length += 1;
 		}
 
+		//Constructs the new last element in place from args, without a temporary that is moved in.
+		template <typename... arguments, bool dummyKeepSorted = keepSorted>
+		typename std::enable_if<!dummyKeepSorted, T&>::type emplace(arguments&&... args)
+		{
+			static_assert(dummyKeepSorted == keepSorted, "Do not specify dummyKeepSorted!");
+			if (m_capacity < m_length + 1)
+			{
+				//The new element is constructed before the old ones are relocated, as args may refer to them.
+				const size_t newCapacity = m_capacity * 2 > m_length + 1 ? m_capacity * 2 : m_length + 1;
+				INTERNAL::Unconstructed<T>* newData = allocateStorage(newCapacity);
+				try
+				{
+					new (bbe::addressOf(newData[m_length].m_value)) T(std::forward<arguments>(args)...);
+				}
+				catch (...)
+				{
+					deallocateStorage(newData, newCapacity);
+					throw;
+				}
+				relocate(newData, m_pdata, m_length);
+				deallocateStorage(m_pdata, m_capacity);
+				m_pdata = newData;
+				m_capacity = newCapacity;
+			}
+			else
+			{
+				new (bbe::addressOf(m_pdata[m_length].m_value)) T(std::forward<arguments>(args)...);
+			}
+
+			m_length += 1;
+			return m_pdata[m_length - 1].m_value;
+		}
+
 		template <bool dummyKeepSorted = keepSorted>
 		typename std::enable_if<!dummyKeepSorted, size_t>::type getIndexOnAdd(const T& val)
 		{
@@ -511,16 +630,19 @@ namespace bbe
 			{
 				debugBreak();
 			}
-			for (size_t i = 0; i < amount; i++)
+			if constexpr (!std::is_trivially_destructible<T>::value)
 			{
-				m_pdata[m_length - 1 - i].m_value.~T();
+				for (size_t i = 0; i < amount; i++)
+				{
+					m_pdata[m_length - 1 - i].m_value.~T();
+				}
 			}
 			m_length -= amount;
 		}
 
 		void clear()
 		{
-			if (!std::is_trivially_destructible_v<T>)
+			if constexpr (!std::is_trivially_destructible_v<T>)
 			{
 				for (size_t i = 0; i < m_length; i++)
 				{
@@ -536,31 +658,12 @@ namespace bbe
 			{
 				return false;
 			}
-			m_capacity = m_length;
 
-			if (m_length == 0)
-			{
-				if (m_pdata != nullptr)
-				{
-					delete[] m_pdata;
-				}
-				m_pdata = nullptr;
-				return true;
-			}
-			INTERNAL::Unconstructed<T>* newList = new INTERNAL::Unconstructed<T>[m_length];
-			for (size_t i = 0; i < m_length; i++)
-			{
-				new (bbe::addressOf(newList[i])) T(std::move(m_pdata[i].m_value));
-			}
-			if (m_pdata != nullptr)
-			{
-				for (size_t i = 0; i < m_length; i++)
-				{
-					bbe::addressOf(m_pdata[i].m_value)->~T();
-				}
-				delete[] m_pdata;
-			}
+			INTERNAL::Unconstructed<T>* newList = allocateStorage(m_length);
+			relocate(newList, m_pdata, m_length);
+			deallocateStorage(m_pdata, m_capacity);
 			m_pdata = newList;
+			m_capacity = m_length;
 			return true;
 		}
 
@@ -600,21 +703,36 @@ namespace bbe
 				return;
 			}
 
-			INTERNAL::Unconstructed<T>* newList = new INTERNAL::Unconstructed<T>[newCapacity];
-			for (size_t i = 0; i < m_length; i++)
-			{
-				new (bbe::addressOf(newList[i])) T(std::move(m_pdata[i].m_value));
-			}
-			if (m_pdata != nullptr) {
-				for (size_t i = 0; i < m_length; i++) {
-					bbe::addressOf(m_pdata[i].m_value)->~T();
-				}
-				delete[] m_pdata;
-			}
+			INTERNAL::Unconstructed<T>* newList = allocateStorage(newCapacity);
+			relocate(newList, m_pdata, m_length);
+			deallocateStorage(m_pdata, m_capacity);
 			m_pdata = newList;
 			m_capacity = newCapacity;
 		}
 
+		//Makes sure that at least newCapacity elements fit into the list. Unlike
+		//resizeCapacity this never shrinks the list.
+		void reserve(size_t newCapacity)
+		{
+			if (newCapacity > m_capacity)
+			{
+				resizeCapacity(newCapacity);
+			}
+		}
+
+		//Sets the length of the list without initializing new elements. Only
+		//available for trivial types, where reading the new elements before
+		//writing them is the only thing that can go wrong.
+		template <typename dummyT = T>
+		typename std::enable_if<std::is_trivial<dummyT>::value, void>::type
+			resizeUninitialized(size_t newLength)
+		{
+			static_assert(std::is_same<dummyT, T>::value, "Do not specify dummyT!");
+			static_assert(!keepSorted, "Uninitialized elements can not be kept sorted!");
+			reserve(newLength);
+			m_length = newLength;
+		}
+
 		size_t removeAll(const T& remover)
 		{
 			return removeAll(
@@ -625,13 +743,18 @@ namespace bbe
 		}
 
 		size_t removeAll(std::function<bool(const T&)> predicate)
+		{
+			return removeAll<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		size_t removeAll(Predicate&& predicate)
 		{
 			size_t moveRange = 0;
 			for (size_t i = 0; i < m_length; i++)
 			{
 				if (predicate(m_pdata[i].m_value))
 				{
-					bbe::addressOf(m_pdata[i].m_value)->~T();
 					moveRange++;
 				}
 				else if (moveRange != 0)
@@ -639,23 +762,83 @@ namespace bbe
 					m_pdata[i - moveRange].m_value = std::move(m_pdata[i].m_value);
 				}
 			}
-			m_length -= moveRange;
+			popBack(moveRange);
 			return moveRange;
 		}
 
-		bool removeIndex(size_t index) {
-			if (index >= m_length) {
+		//Like removeAll, but fills the gaps with elements from the back instead of
+		//shifting everything down. Does not keep the order of the list.
+		template <bool dummyKeepSorted = keepSorted>
+		typename std::enable_if<!dummyKeepSorted, size_t>::type removeAllUnordered(const T& remover)
+		{
+			static_assert(dummyKeepSorted == keepSorted, "Do not specify dummyKeepSorted!");
+			return removeAllUnordered(
+				[&](const T& other)
+				{
+					return other == remover;
+				});
+		}
+
+		template <typename Predicate, bool dummyKeepSorted = keepSorted, EnableIfPredicate<Predicate> = 0>
+		typename std::enable_if<!dummyKeepSorted, size_t>::type removeAllUnordered(Predicate&& predicate)
+		{
+			static_assert(dummyKeepSorted == keepSorted, "Do not specify dummyKeepSorted!");
+			size_t removed = 0;
+			size_t i = 0;
+			while (i < m_length)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					removeIndexUnordered(i);
+					removed++;
+				}
+				else
+				{
+					i++;
+				}
+			}
+			return removed;
+		}
+
+		//Removes the element at index by moving the last element into its place. O(1), but does not keep the order of the list.
+		template <bool dummyKeepSorted = keepSorted>
+		typename std::enable_if<!dummyKeepSorted, bool>::type removeIndexUnordered(size_t index)
+		{
+			static_assert(dummyKeepSorted == keepSorted, "Do not specify dummyKeepSorted!");
+			if (index >= m_length)
+			{
 				return false;
 			}
 
-			m_pdata[index].m_value.~T();
 			if (index != m_length - 1)
 			{
-				new (bbe::addressOf(m_pdata[index].m_value)) T(std::move(m_pdata[index + 1].m_value));
+				m_pdata[index].m_value = std::move(m_pdata[m_length - 1].m_value);
+			}
+			popBack();
+			return true;
+		}
+
+		bool removeIndex(size_t index) {
+			if (index >= m_length) {
+				return false;
+			}
 
-				for (size_t i = index + 1; i < m_length - 1; i++)
+			if constexpr (isTriviallyRelocatable)
+			{
+				std::memmove(static_cast<void*>(m_pdata + index), static_cast<const void*>(m_pdata + index + 1), sizeof(T) * (m_length - index - 1));
+			}
+			else
+			{
+				m_pdata[index].m_value.~T();
+				if (index != m_length - 1)
 				{
-					m_pdata[i].m_value = std::move(m_pdata[i + 1].m_value);
+					new (bbe::addressOf(m_pdata[index].m_value)) T(std::move(m_pdata[index + 1].m_value));
+
+					for (size_t i = index + 1; i < m_length - 1; i++)
+					{
+						m_pdata[i].m_value = std::move(m_pdata[i + 1].m_value);
+					}
+					m_pdata[m_length - 1].m_value.~T();
 				}
 			}
 
@@ -674,6 +857,12 @@ namespace bbe
 		}
 
 		bool removeSingle(std::function<bool(const T&)> predicate)
+		{
+			return removeSingle<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool removeSingle(Predicate&& predicate)
 		{
 			size_t index = 0;
 			bool found = false;
@@ -701,6 +890,12 @@ namespace bbe
 		}
 
 		size_t containsAmount(std::function<bool(const T&)> predicate) const
+		{
+			return containsAmount<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		size_t containsAmount(Predicate&& predicate) const
 		{
 			size_t amount = 0;
 			for (size_t i = 0; i < m_length; i++)
@@ -740,6 +935,12 @@ namespace bbe
 		}
 
 		bool contains(std::function<bool(const T&)> predicate) const
+		{
+			return contains<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool contains(Predicate&& predicate) const
 		{
 			for (size_t i = 0; i < m_length; i++)
 			{
@@ -758,31 +959,37 @@ namespace bbe
 
 		bool containsUnique(std::function<bool(const T&)> predicate) const
 		{
-			return containsAmount(predicate) == 1;
+			return containsAmount<const StdPredicate&>(predicate) == 1;
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool containsUnique(Predicate&& predicate) const
+		{
+			return containsAmount(std::forward<Predicate>(predicate)) == 1;
 		}
 
 		T* begin()
 		{
 			//UNTESTED
-			return &(this->m_pdata[0].m_value);
+			return reinterpret_cast<T*>(this->m_pdata);
 		}
 
 		const T* begin() const
 		{
 			//UNTESTED
-			return &(this->m_pdata[0].m_value);
+			return reinterpret_cast<const T*>(this->m_pdata);
 		}
 
 		T* end()
 		{
 			//UNTESTED
-			return &(this->m_pdata[getLength()].m_value);
+			return reinterpret_cast<T*>(this->m_pdata + getLength());
 		}
 
 		const T* end() const
 		{
 			//UNTESTED
-			return &(this->m_pdata[getLength()].m_value);
+			return reinterpret_cast<const T*>(this->m_pdata + getLength());
 		}
 
 		void sort()
@@ -792,7 +999,13 @@ namespace bbe
 
 		void sort(std::function<bool(const T&, const T&)> predicate)
 		{
-			sortSTL(reinterpret_cast<T*>(m_pdata), reinterpret_cast<T*>(m_pdata + m_length), predicate);
+			sort<const StdComparator&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfComparator<Predicate> = 0>
+		void sort(Predicate&& predicate)
+		{
+			sortSTL(reinterpret_cast<T*>(m_pdata), reinterpret_cast<T*>(m_pdata + m_length), std::forward<Predicate>(predicate));
 		}
 
 		T& first()
@@ -827,6 +1040,12 @@ namespace bbe
 		}
 
 		T* find(std::function<bool(const T&)> predicate)
+		{
+			return find<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		T* find(Predicate&& predicate)
 		{
 			for (size_t i = 0; i < m_length; i++)
 			{
@@ -848,6 +1067,12 @@ namespace bbe
 		}
 
 		T* findLast(std::function<bool(const T&)> predicate)
+		{
+			return findLast<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		T* findLast(Predicate&& predicate)
 		{
 			for (size_t i = m_length - 1; i >= 0 && i != std::numeric_limits<size_t>::max(); i--)
 			{
@@ -895,11 +1120,11 @@ namespace bbe
 			length = 16;
 		}
 
-		uint32_t _hash = 0;
+		uint32_t _hash = hash(t.getLength());
 
 		for (int i = 0; i < length; i++)
 		{
-			_hash += hash(t[i]);
+			_hash = hashCombine(_hash, hash(t[i]));
 		}
 
 		return _hash;
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "../BBE/Unconstructed.h"
+#include "../BBE/STLCapsule.h"
+#include "../BBE/Exceptions.h"
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		template <typename T>
+		struct MPMCQueueCell
+		{
+			std::atomic<std::size_t> sequence;
+			Unconstructed<T> data;
+		};
+	}
+
+	//Bounded lock free queue for any amount of producer and consumer threads
+	//(Dmitry Vyukov's design). The capacity is rounded up to a power of two.
+	//Every cell carries a sequence number that tells whether it is ready to be
+	//written or read in the current lap, so producers and consumers only contend
+	//on their own index and never on each other's.
+	template <typename T>
+	class MPMCQueue
+	{
+	private:
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		INTERNAL::MPMCQueueCell<T>* m_cells = nullptr;
+		std::size_t m_capacity = 0;
+		std::size_t m_mask = 0;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueuePosition{ 0 };
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_dequeuePosition{ 0 };
+
+		//Claims up to maxAmount consecutive cells starting at the current position and
+		//returns how many. A cell is ready if its sequence is its position plus
+		//sequenceOffset. A ready cell can only be changed again by whoever claims it,
+		//so checking the cells before the CAS is safe.
+		std::size_t claim(std::atomic<std::size_t>& positionCounter, std::size_t sequenceOffset, std::size_t maxAmount, std::size_t& position)
+		{
+			position = positionCounter.load(std::memory_order_relaxed);
+			while (true)
+			{
+				std::size_t amount = 0;
+				bool retry = false;
+				while (amount < maxAmount)
+				{
+					const std::size_t sequence = m_cells[(position + amount) & m_mask].sequence.load(std::memory_order_acquire);
+					const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + amount + sequenceOffset);
+					if (difference == 0)
+					{
+						amount++;
+					}
+					else
+					{
+						//Positive: another thread already claimed this cell, our position is stale.
+						//Negative: the cell is still in use by the other side, the queue is full (or empty).
+						retry = difference > 0 && amount == 0;
+						break;
+					}
+				}
+				if (retry)
+				{
+					position = positionCounter.load(std::memory_order_relaxed);
+					continue;
+				}
+				if (amount == 0)
+				{
+					return 0;
+				}
+				if (positionCounter.compare_exchange_weak(position, position + amount, std::memory_order_relaxed))
+				{
+					return amount;
+				}
+			}
+		}
+
+	public:
+		explicit MPMCQueue(std::size_t capacity)
+		{
+			if (capacity < 2)
+			{
+				throw IllegalArgumentException();
+			}
+			m_capacity = 1;
+			while (m_capacity < capacity)
+			{
+				m_capacity <<= 1;
+			}
+			m_mask = m_capacity - 1;
+			m_cells = new INTERNAL::MPMCQueueCell<T>[m_capacity];
+			for (std::size_t i = 0; i < m_capacity; i++)
+			{
+				m_cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		~MPMCQueue()
+		{
+			const std::size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+			for (std::size_t i = m_dequeuePosition.load(std::memory_order_relaxed); i != enqueuePosition; i++)
+			{
+				m_cells[i & m_mask].data.m_value.~T();
+			}
+			delete[] m_cells;
+			m_cells = nullptr;
+		}
+
+		MPMCQueue(const MPMCQueue&  other) = delete; //Copy Constructor
+		MPMCQueue(MPMCQueue&& other) = delete; //Move Constructor
+		MPMCQueue& operator=(const MPMCQueue&  other) = delete; //Copy Assignment
+		MPMCQueue& operator=(MPMCQueue&& other) = delete; //Move Assignment
+
+		//Returns false if the queue is full.
+		template <typename... arguments>
+		bool tryEmplace(arguments&&... args)
+		{
+			std::size_t position;
+			if (claim(m_enqueuePosition, 0, 1, position) == 0)
+			{
+				return false;
+			}
+			INTERNAL::MPMCQueueCell<T>& cell = m_cells[position & m_mask];
+			new (bbe::addressOf(cell.data.m_value)) T(std::forward<arguments>(args)...);
+			cell.sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool tryPush(const T& value)
+		{
+			return tryEmplace(value);
+		}
+
+		bool tryPush(T&& value)
+		{
+			return tryEmplace(std::move(value));
+		}
+
+		//Claims as many consecutive cells as are free (at most amountOfValues) with a
+		//single CAS and returns how many values were pushed.
+		std::size_t tryPushBatch(const T* values, std::size_t amountOfValues)
+		{
+			if (amountOfValues == 0)
+			{
+				return 0;
+			}
+			std::size_t position;
+			const std::size_t amount = claim(m_enqueuePosition, 0, amountOfValues, position);
+			for (std::size_t i = 0; i < amount; i++)
+			{
+				INTERNAL::MPMCQueueCell<T>& cell = m_cells[(position + i) & m_mask];
+				new (bbe::addressOf(cell.data.m_value)) T(values[i]);
+				cell.sequence.store(position + i + 1, std::memory_order_release);
+			}
+			return amount;
+		}
+
+		//Returns false if the queue is empty.
+		bool tryPop(T& out)
+		{
+			std::size_t position;
+			if (claim(m_dequeuePosition, 1, 1, position) == 0)
+			{
+				return false;
+			}
+			INTERNAL::MPMCQueueCell<T>& cell = m_cells[position & m_mask];
+			out = std::move(cell.data.m_value);
+			cell.data.m_value.~T();
+			cell.sequence.store(position + m_capacity, std::memory_order_release);
+			return true;
+		}
+
+		//Pops up to maxAmountOfValues values with a single CAS and returns how many that were.
+		std::size_t tryPopBatch(T* out, std::size_t maxAmountOfValues)
+		{
+			if (maxAmountOfValues == 0)
+			{
+				return 0;
+			}
+			std::size_t position;
+			const std::size_t amount = claim(m_dequeuePosition, 1, maxAmountOfValues, position);
+			for (std::size_t i = 0; i < amount; i++)
+			{
+				INTERNAL::MPMCQueueCell<T>& cell = m_cells[(position + i) & m_mask];
+				out[i] = std::move(cell.data.m_value);
+				cell.data.m_value.~T();
+				cell.sequence.store(position + i + m_capacity, std::memory_order_release);
+			}
+			return amount;
+		}
+
+		std::size_t getCapacity() const
+		{
+			return m_capacity;
+		}
+
+		//Only a snapshot while other threads are working on the queue.
+		std::size_t getLength() const
+		{
+			const std::size_t dequeuePosition = m_dequeuePosition.load(std::memory_order_acquire);
+			const std::size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+			return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+		}
+
+		bool isEmpty() const
+		{
+			return getLength() == 0;
+		}
+	};
+}
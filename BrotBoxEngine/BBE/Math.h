@@ -15,11 +15,24 @@ namespace bbe
 	{
 		namespace INTERNAL
 		{
-			void startMath();
-			constexpr std::size_t TABLE_SIZES = 1024 * 64;
-			extern double sinTable[TABLE_SIZES];
-			extern double cosTable[TABLE_SIZES];
-			extern double tanTable[TABLE_SIZES];
+			//sin and cos reduce the argument to r in [-PI/4, PI/4] and a quadrant, then evaluate a minimax
+			//polynomial. The batch versions in VectorBatch.h use the same constants and operations.
+			constexpr float TRIG_TWO_OVER_PI = 0.636619772367581343f;
+			constexpr float TRIG_ROUND_MAGIC = 12582912.f; //1.5 * 2^23, adding and subtracting it rounds to the nearest integer.
+			//Cody-Waite split of PI/2. The first parts have few mantissa bits, so quadrant * part is exact.
+			constexpr float TRIG_PI_OVER_2_PART1 = 1.5703125f;
+			constexpr float TRIG_PI_OVER_2_PART2 = 4.837512969970703125e-4f;
+			constexpr float TRIG_PI_OVER_2_PART3 = 7.54978995489188216e-8f;
+			//Above this (and for NaN and infinities) quadrant * PART1 is no longer exact, std::sin and std::cos take over.
+			constexpr float TRIG_FAST_REDUCTION_LIMIT = 100000.f;
+			//sin(r) ~ r + r^3 * (S1 + r^2 * (S2 + r^2 * S3))
+			constexpr float TRIG_SIN_1 = -1.6666654611e-1f;
+			constexpr float TRIG_SIN_2 = 8.3321608736e-3f;
+			constexpr float TRIG_SIN_3 = -1.9515295891e-4f;
+			//cos(r) ~ 1 - r^2 / 2 + r^4 * (C1 + r^2 * (C2 + r^2 * C3))
+			constexpr float TRIG_COS_1 = 4.166664568298827e-2f;
+			constexpr float TRIG_COS_2 = -1.388731625493765e-3f;
+			constexpr float TRIG_COS_3 = 2.443315711809948e-5f;
 		}
 
 		constexpr  int32_t BIGGEST_PRIME_32_SIGNED   = 2147483647;
@@ -38,11 +51,14 @@ namespace bbe
 
 		double pow(double base, double expo);
 
-		double cos(double val);
+		//Max absolute error of sin and cos is 8e-8 for |val| <= 8192 and 1e-6 for |val| <= 100000. Larger
+		//values fall back to the much slower std::sin and std::cos. NaN and infinities give NaN.
+		float cos(float val);
 		float acos(float val);
-		double sin(double val);
+		float sin(float val);
+		void sincos(float val, float& outSin, float& outCos);
 		float asin(float val);
-		double tan(double val);
+		float tan(float val);
 		float atan(float val);
 		float sqrt(float val);
 		template<typename T>
@@ -184,20 +200,8 @@ namespace bbe
 		bbe::List<bbe::Vector2> getConvexHull(const bbe::List<bbe::Vector2>& points);
 		const bbe::Vector2* getClosest(const bbe::Vector2& pos, const bbe::List<bbe::Vector2>& points);
 		      bbe::Vector2* getClosest(const bbe::Vector2& pos,       bbe::List<bbe::Vector2>& points);
-		
-		template<typename Vec>
-		bbe::List<Vec> project(const bbe::List<Vec>& points, const Vec& projection)
-		{
-			bbe::List<Vec> retVal;
-			retVal.resizeCapacityAndLength(points.getLength());
 
-			for (size_t i = 0; i < points.getLength(); i++)
-			{
-				retVal[i] = points[i].project(projection);
-			}
-
-			return retVal;
-		}
+		//project, dot and transformPoints for whole arrays of vectors are in VectorBatch.h.
 
 		Vector2 interpolateLinear(Vector2 a, Vector2 b, float t);
 		Vector2 interpolateBool(Vector2 a, Vector2 b, float t);
@@ -5,6 +5,21 @@
 
 namespace bbe
 {
+#ifdef BBE_USE_SSE2
+	namespace INTERNAL
+	{
+		//cols[0] * v.x + cols[1] * v.y + cols[2] * v.z + cols[3] * v.w, summed left to right like the scalar version.
+		inline __m128 matrix4MulColumn(const Vector4* cols, __m128 v)
+		{
+			__m128 retVal = _mm_mul_ps(loadVector4(cols[0]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			retVal = _mm_add_ps(retVal, _mm_mul_ps(loadVector4(cols[1]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+			retVal = _mm_add_ps(retVal, _mm_mul_ps(loadVector4(cols[2]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+			retVal = _mm_add_ps(retVal, _mm_mul_ps(loadVector4(cols[3]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+			return retVal;
+		}
+	}
+#endif
+
 	class Matrix4
 	{
 	private:
@@ -37,4 +52,49 @@ namespace bbe
 		Vector3 extractScale() const;
 		Matrix4 extractRotation() const;
 	};
+
+	//Construction and multiplication are inline, see Vector4 for why they are bit identical with and without SSE.
+	inline Matrix4::Matrix4()
+		: m_cols{ Vector4(1, 0, 0, 0), Vector4(0, 1, 0, 0), Vector4(0, 0, 1, 0), Vector4(0, 0, 0, 1) }
+	{
+		static_assert(sizeof(Matrix4) == sizeof(float) * 16, "The size of a Matrix4 must be sizeof(float) * 16!");
+	}
+
+	inline Matrix4::Matrix4(const Vector4& col0, const Vector4& col1, const Vector4& col2, const Vector4& col3)
+		: m_cols{ col0, col1, col2, col3 }
+	{
+	}
+
+	inline Matrix4 Matrix4::operator*(const Matrix4& other) const
+	{
+#ifdef BBE_USE_SSE2
+		return Matrix4(
+			INTERNAL::storeVector4(INTERNAL::matrix4MulColumn(m_cols, INTERNAL::loadVector4(other.m_cols[0]))),
+			INTERNAL::storeVector4(INTERNAL::matrix4MulColumn(m_cols, INTERNAL::loadVector4(other.m_cols[1]))),
+			INTERNAL::storeVector4(INTERNAL::matrix4MulColumn(m_cols, INTERNAL::loadVector4(other.m_cols[2]))),
+			INTERNAL::storeVector4(INTERNAL::matrix4MulColumn(m_cols, INTERNAL::loadVector4(other.m_cols[3])))
+		);
+#else
+		return Matrix4(
+			operator*(other.m_cols[0]),
+			operator*(other.m_cols[1]),
+			operator*(other.m_cols[2]),
+			operator*(other.m_cols[3])
+		);
+#endif
+	}
+
+	inline Vector4 Matrix4::operator*(const Vector4& other) const
+	{
+#ifdef BBE_USE_SSE2
+		return INTERNAL::storeVector4(INTERNAL::matrix4MulColumn(m_cols, INTERNAL::loadVector4(other)));
+#else
+		return Vector4(
+			m_cols[0].x * other.x + m_cols[1].x * other.y + m_cols[2].x * other.z + m_cols[3].x * other.w,
+			m_cols[0].y * other.x + m_cols[1].y * other.y + m_cols[2].y * other.z + m_cols[3].y * other.w,
+			m_cols[0].z * other.x + m_cols[1].z * other.y + m_cols[2].z * other.z + m_cols[3].z * other.w,
+			m_cols[0].w * other.x + m_cols[1].w * other.y + m_cols[2].w * other.z + m_cols[3].w * other.w
+		);
+#endif
+	}
 }
\ No newline at end of file
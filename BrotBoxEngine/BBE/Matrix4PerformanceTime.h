@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../BBE/Matrix4.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//The out of line scalar product that Matrix4::operator* used to be.
+#ifdef _MSC_VER
+		__declspec(noinline)
+#else
+		__attribute__((noinline))
+#endif
+		Matrix4 matrix4ScalarMul(const Matrix4& a, const Matrix4& b)
+		{
+			const float* pa = reinterpret_cast<const float*>(&a);
+			const float* pb = reinterpret_cast<const float*>(&b);
+			Matrix4 retVal;
+			float* pr = reinterpret_cast<float*>(&retVal);
+			for (int col = 0; col < 4; col++)
+			{
+				for (int row = 0; row < 4; row++)
+				{
+					pr[col * 4 + row] = pa[row] * pb[col * 4] + pa[4 + row] * pb[col * 4 + 1] + pa[8 + row] * pb[col * 4 + 2] + pa[12 + row] * pb[col * 4 + 3];
+				}
+			}
+			return retVal;
+		}
+
+		//Composes viewProjection * translation * rotation * scale for a scene of objects, the path every
+		//draw call of the 3D brush takes, and transforms a corner of each object with the result.
+		void matrix4PrintTransformCompositionSpeed()
+		{
+			constexpr size_t AMOUNT_OF_OBJECTS = 10000;
+			constexpr int ITERATIONS = 100;
+
+			List<Matrix4> translations;
+			List<Matrix4> rotations;
+			List<Matrix4> scales;
+			for (size_t i = 0; i < AMOUNT_OF_OBJECTS; i++)
+			{
+				translations.add(Matrix4::createTranslationMatrix(Vector3((float)i, (float)(i % 7), (float)(i % 13))));
+				rotations.add(Matrix4::createRotationMatrix(0.001f * i, Vector3(0, 0, 1)));
+				scales.add(Matrix4::createScaleMatrix(Vector3(1.f + (i % 3))));
+			}
+			const Matrix4 viewProjection = Matrix4::createPerspectiveMatrix(1.f, 16.f / 9.f, 0.1f, 1000.f) * Matrix4::createViewMatrix(Vector3(0, -10, 5), Vector3(0), Vector3(0, 0, 1));
+			const Vector4 corner(0.5f, 0.5f, 0.5f, 1.f);
+
+			float scalarSink = 0;
+			CPUWatch scalarWatch;
+			for (int k = 0; k < ITERATIONS; k++)
+			{
+				for (size_t i = 0; i < AMOUNT_OF_OBJECTS; i++)
+				{
+					const Matrix4 mvp = matrix4ScalarMul(matrix4ScalarMul(matrix4ScalarMul(viewProjection, translations[i]), rotations[i]), scales[i]);
+					const float* pmvp = reinterpret_cast<const float*>(&mvp);
+					scalarSink += pmvp[0] * corner.x + pmvp[4] * corner.y + pmvp[8] * corner.z + pmvp[12] * corner.w;
+				}
+			}
+			const double scalarTime = scalarWatch.getTimeExpiredSeconds();
+
+			float sink = 0;
+			CPUWatch inlineWatch;
+			for (int k = 0; k < ITERATIONS; k++)
+			{
+				for (size_t i = 0; i < AMOUNT_OF_OBJECTS; i++)
+				{
+					const Matrix4 mvp = viewProjection * translations[i] * rotations[i] * scales[i];
+					sink += (mvp * corner).x;
+				}
+			}
+			const double inlineTime = inlineWatch.getTimeExpiredSeconds();
+
+			std::cout << AMOUNT_OF_OBJECTS * ITERATIONS << " compositions: out of line scalar " << scalarTime << "s, inline Matrix4 " << inlineTime << "s (" << scalarSink << " == " << sink << ")" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "../BBE/DataType.h"
+#include "../BBE/StackAllocator.h"
+#include "../BBE/PoolAllocator.h"
+#include "../BBE/GeneralPurposeAllocator.h"
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+namespace bbe
+{
+	//Adapters that let standard containers (std::pmr::vector, std::pmr::unordered_map, ...)
+	//allocate from bbe allocators. The adapters don't own the wrapped allocator, it
+	//has to outlive every container that uses the adapter.
+
+	//Monotonic: deallocate does nothing, memory is reclaimed by resetting the
+	//StackAllocator (deallocateAll or deallocateToMarker) once the containers are gone.
+	class StackAllocatorMemoryResource : public std::pmr::memory_resource
+	{
+	private:
+		StackAllocator<byte>* m_parentAllocator;
+
+	protected:
+		void* do_allocate(std::size_t amountOfBytes, std::size_t alignment) override;
+		void do_deallocate(void* data, std::size_t amountOfBytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	public:
+		explicit StackAllocatorMemoryResource(StackAllocator<byte>& parentAllocator);
+
+		StackAllocator<byte>& getParentAllocator() const;
+	};
+
+	//Maps the runtime alignment of a request onto the compile time alignment the
+	//GeneralPurposeAllocator expects. Alignments above 128 are not supported.
+	class GeneralPurposeAllocatorMemoryResource : public std::pmr::memory_resource
+	{
+	private:
+		GeneralPurposeAllocator* m_parentAllocator;
+
+	protected:
+		void* do_allocate(std::size_t amountOfBytes, std::size_t alignment) override;
+		void do_deallocate(void* data, std::size_t amountOfBytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	public:
+		explicit GeneralPurposeAllocatorMemoryResource(GeneralPurposeAllocator& parentAllocator);
+
+		GeneralPurposeAllocator& getParentAllocator() const;
+	};
+
+	//Chunk type for a PoolAllocator that backs a PoolAllocatorMemoryResource.
+	//SIZE should be the node size of the container, e.g. found through sizeof
+	//on a node of the used standard library or simply by trying.
+	template <std::size_t SIZE, std::size_t ALIGNMENT = alignof(std::max_align_t)>
+	struct MemoryResourceChunk
+	{
+		alignas(ALIGNMENT) byte data[SIZE];
+	};
+
+	//Serves every request that fits into a single chunk from the pool, which makes
+	//it a good fit for node based containers (std::pmr::list, std::pmr::map, ...).
+	//Bigger requests, e.g. the bucket array of a std::pmr::unordered_map, are
+	//forwarded to the upstream resource.
+	template <typename T, PoolAllocatorThreading THREADING = PoolAllocatorThreading::SINGLE_THREADED, typename Allocator = STLAllocator<INTERNAL::PoolChunk<T, THREADING>>>
+	class PoolAllocatorMemoryResource : public std::pmr::memory_resource
+	{
+		static_assert(std::is_trivially_default_constructible<T>::value && std::is_trivially_destructible<T>::value, "The chunk type must be trivial, e.g. a MemoryResourceChunk.");
+	private:
+		PoolAllocator<T, THREADING, Allocator>* m_parentAllocator;
+		std::pmr::memory_resource* m_upstream;
+
+		static bool fitsIntoChunk(std::size_t amountOfBytes, std::size_t alignment)
+		{
+			return amountOfBytes <= sizeof(T) && alignment <= alignof(T);
+		}
+
+	protected:
+		void* do_allocate(std::size_t amountOfBytes, std::size_t alignment) override
+		{
+			if (fitsIntoChunk(amountOfBytes, alignment))
+			{
+				return m_parentAllocator->allocateObject();
+			}
+			return m_upstream->allocate(amountOfBytes, alignment);
+		}
+
+		void do_deallocate(void* data, std::size_t amountOfBytes, std::size_t alignment) override
+		{
+			if (fitsIntoChunk(amountOfBytes, alignment))
+			{
+				m_parentAllocator->deallocate(static_cast<T*>(data));
+				return;
+			}
+			m_upstream->deallocate(data, amountOfBytes, alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+
+	public:
+		explicit PoolAllocatorMemoryResource(PoolAllocator<T, THREADING, Allocator>& parentAllocator, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			: m_parentAllocator(bbe::addressOf(parentAllocator)), m_upstream(upstream)
+		{
+			//do nothing
+		}
+
+		PoolAllocator<T, THREADING, Allocator>& getParentAllocator() const
+		{
+			return *m_parentAllocator;
+		}
+
+		std::pmr::memory_resource* getUpstream() const
+		{
+			return m_upstream;
+		}
+	};
+}
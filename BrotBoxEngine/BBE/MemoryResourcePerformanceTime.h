@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../BBE/MemoryResource.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+namespace bbe {
+	namespace test {
+		//Forwards to the heap and counts how often it was asked to.
+		class MemoryResourceHeapCounter : public std::pmr::memory_resource
+		{
+		public:
+			std::size_t m_amountOfAllocations = 0;
+
+		protected:
+			void* do_allocate(std::size_t amountOfBytes, std::size_t alignment) override
+			{
+				m_amountOfAllocations++;
+				return std::pmr::new_delete_resource()->allocate(amountOfBytes, alignment);
+			}
+
+			void do_deallocate(void* data, std::size_t amountOfBytes, std::size_t alignment) override
+			{
+				std::pmr::new_delete_resource()->deallocate(data, amountOfBytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+		};
+
+		//A typical per frame workload: a vector, a node list and a hash map that
+		//are filled and thrown away again.
+		double memoryResourceWorkload(std::pmr::memory_resource* resource, int runs)
+		{
+			CPUWatch watch;
+			for (int run = 0; run < runs; run++)
+			{
+				std::pmr::vector<int> vec(resource);
+				std::pmr::list<int> list(resource);
+				std::pmr::unordered_map<int, int> map(resource);
+				for (int i = 0; i < 1000; i++)
+				{
+					vec.push_back(i);
+					list.push_back(i);
+					map[i] = i;
+				}
+			}
+			return watch.getTimeExpiredSeconds();
+		}
+
+		void memoryResourcePrintAllocationCounts()
+		{
+			constexpr int runs = 100;
+
+			MemoryResourceHeapCounter heap;
+			const double heapTime = memoryResourceWorkload(&heap, runs);
+			std::cout << "Default heap:            " << heap.m_amountOfAllocations << " heap allocations, " << heapTime << "s" << std::endl;
+
+			{
+				StackAllocator<byte> sa(1024 * 1024);
+				StackAllocatorMemoryResource resource(sa);
+				CPUWatch watch;
+				for (int run = 0; run < runs; run++)
+				{
+					memoryResourceWorkload(&resource, 1);
+					sa.deallocateAll();
+				}
+				std::cout << "StackAllocator:          1 heap allocation,   " << watch.getTimeExpiredSeconds() << "s (" << sa.getTelemetry().getAmountOfAllocations() << " served)" << std::endl;
+			}
+
+			{
+				typedef MemoryResourceChunk<32> Chunk;
+				PoolAllocator<Chunk> pa(2048);
+				MemoryResourceHeapCounter upstream;
+				PoolAllocatorMemoryResource<Chunk> resource(pa, &upstream);
+				const double time = memoryResourceWorkload(&resource, runs);
+				std::cout << "PoolAllocator:           " << pa.getAmountOfSlabs() + upstream.m_amountOfAllocations << " heap allocations, " << time << "s (" << pa.getTelemetry().getAmountOfAllocations() << " served)" << std::endl;
+			}
+
+			{
+				GeneralPurposeAllocator gpa(1024 * 1024, GeneralPurposeAllocatorMode::SEGREGATED_FIT);
+				GeneralPurposeAllocatorMemoryResource resource(gpa);
+				const double time = memoryResourceWorkload(&resource, runs);
+				std::cout << "GeneralPurposeAllocator: 1 heap allocation,   " << time << "s (" << gpa.getTelemetry().getAmountOfAllocations() << " served)" << std::endl;
+			}
+		}
+	}
+}
@@ -48,6 +48,11 @@ namespace bbe
 			setSeed((FieldType)timeStamp);
 		}
 
+		explicit MersenneTwisterBase(FieldType seed)
+		{
+			setSeed(seed);
+		}
+
 		void setSeed(FieldType seed)
 		{
 			m_mt[0] = seed;
@@ -3,11 +3,17 @@
 #include <cassert>
 #include <utility>
 #include <iostream>
+#include "../BBE/AllocatorTelemetry.h"
 
 namespace bbe
 {
 	class NewDeleteAllocator
 	{
+	private:
+		//delete[] doesn't tell us the length of the array, so only the amount of
+		//allocations and deallocations is tracked, not the bytes.
+		AllocatorTelemetry m_telemetry{ "NewDeleteAllocator" };
+
 	public:
 		explicit NewDeleteAllocator(std::size_t size)
 		{
@@ -17,25 +23,41 @@ namespace bbe
 		template <typename T, typename... arguments>
 		T* allocateObject(arguments&&... args)
 		{
-			return new T(std::forward<arguments>(args)...);
+			T* retVal = new T(std::forward<arguments>(args)...);
+			m_telemetry.onAllocation(0);
+			return retVal;
 		}
 
 		template <typename T>
 		T* allocateObjects(std::size_t amountOfObjects = 1)
 		{
-			return new T[amountOfObjects];
+			T* retVal = new T[amountOfObjects];
+			m_telemetry.onAllocation(0);
+			return retVal;
 		}
 
 		template <typename T>
 		void deallocate(T* data)
 		{
 			delete data;
+			m_telemetry.onDeallocation(0);
 		}
 
 		template <typename T>
 		void deallocateArray(T* data)
 		{
 			delete[] data;
+			m_telemetry.onDeallocation(0);
+		}
+
+		AllocatorTelemetry& getTelemetry()
+		{
+			return m_telemetry;
+		}
+
+		const AllocatorTelemetry& getTelemetry() const
+		{
+			return m_telemetry;
 		}
 	};
 }
\ No newline at end of file
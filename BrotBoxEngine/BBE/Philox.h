@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+#include "../BBE/Span.h"
+
+namespace bbe
+{
+	//Counter based random numbers with Philox4x32-10, see: https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+	//The value with a given index is a pure function of (seed, stream, index), nothing changes on access.
+	//Threads can share one instance or split a range of indices between them and get the same values
+	//no matter how the work is scheduled. Streams of the same seed are independent, e.g. one per
+	//particle emitter. fill uses SSE2 or AVX2 (see getSimdLevel) and is bit identical to getUInt/getFloat.
+	class Philox4x32
+	{
+	private:
+		uint32_t m_key[2];
+		uint32_t m_stream[2];
+
+	public:
+		explicit Philox4x32(uint64_t seed, uint64_t stream = 0);
+
+		//The values with the indices 4 * blockIndex to 4 * blockIndex + 3, one evaluation of Philox.
+		void getBlock(uint64_t blockIndex, uint32_t outValues[4]) const;
+
+		uint32_t getUInt(uint64_t index) const;
+		//[0, 1) from the upper 24 bits, every multiple of 2^-24 is equally likely.
+		float getFloat(uint64_t index) const;
+
+		//out[i] = getUInt(firstIndex + i)
+		void fill(uint64_t firstIndex, Span<uint32_t> out) const;
+		//out[i] = getFloat(firstIndex + i)
+		void fill(uint64_t firstIndex, Span<float> out) const;
+	};
+}
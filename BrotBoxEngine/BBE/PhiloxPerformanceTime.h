@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../BBE/Philox.h"
+#include "../BBE/Random.h"
+#include "../BBE/Simd.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe
+{
+	namespace test
+	{
+		void philoxPrintSpeed()
+		{
+			constexpr size_t AMOUNT_OF_VALUES = 1000 * 1000;
+			constexpr int ITERATIONS = 100;
+
+			List<float> values;
+			values.resizeCapacityAndLength(AMOUNT_OF_VALUES);
+			float sink = 0;
+
+			std::cout << AMOUNT_OF_VALUES << " floats, " << ITERATIONS << " iterations" << std::endl;
+			{
+				Random rand(42);
+				CPUWatch watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					for (size_t i = 0; i < values.getLength(); i++)
+					{
+						values[i] = rand.randomFloat();
+					}
+					sink += values[k];
+				}
+				std::cout << "    Random::randomFloat:   " << watch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+			}
+
+			const Philox4x32 philox(42);
+			{
+				CPUWatch watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					for (size_t i = 0; i < values.getLength(); i++)
+					{
+						values[i] = philox.getFloat(i);
+					}
+					sink += values[k];
+				}
+				std::cout << "    Philox4x32::getFloat:  " << watch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+			}
+
+			const SimdLevel supported = getSimdLevel();
+			for (SimdLevel level : { SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				if (level > supported) continue;
+				setSimdLevel(level);
+				const char* name = level == SimdLevel::SCALAR ? "scalar" : (level == SimdLevel::SSE2 ? "SSE2  " : "AVX2  ");
+
+				CPUWatch watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					philox.fill(0, Span<float>(values.getRaw(), values.getLength()));
+					sink += values[k];
+				}
+				std::cout << "    Philox4x32::fill " << name << ": " << watch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+			}
+			setSimdLevel(supported);
+		}
+	}
+}
@@ -5,26 +5,51 @@
 #include "../BBE/STLAllocator.h"
 #include "../BBE/STLCapsule.h"
 #include "../BBE/Exceptions.h"
+#include "../BBE/AllocatorTelemetry.h"
 #include <memory>
+#include <atomic>
+#include <mutex>
 
 namespace bbe
 {
+	enum class PoolAllocatorThreading
+	{
+		SINGLE_THREADED,
+		THREAD_SAFE,
+	};
+
 	namespace INTERNAL
 	{
+		template <typename T, PoolAllocatorThreading THREADING>
+		union PoolChunk;
+
+		template <typename T, PoolAllocatorThreading THREADING>
+		struct PoolChunkLinks
+		{
+			PoolChunk<T, THREADING>* nextPoolChunk;
+		};
+
+		//Thread safe pools chain whole batches in the shared list, which needs a second link.
 		template <typename T>
+		struct PoolChunkLinks<T, PoolAllocatorThreading::THREAD_SAFE>
+		{
+			PoolChunk<T, PoolAllocatorThreading::THREAD_SAFE>* nextPoolChunk;
+			PoolChunk<T, PoolAllocatorThreading::THREAD_SAFE>* nextBatch;
+		};
+
+		template <typename T, PoolAllocatorThreading THREADING = PoolAllocatorThreading::SINGLE_THREADED>
 		union PoolChunk
 		{
 			T value;
-			PoolChunk<T>* nextPoolChunk;
+			PoolChunkLinks<T, THREADING> links;
 
 			~PoolChunk() = delete;
 		};
-	}
-
 
-	
+		inline std::atomic<std::size_t> poolAllocatorNextThreadIndex{ 0 };
+	}
 
-	template <typename T, typename Allocator = STLAllocator<INTERNAL::PoolChunk<T>>>
+	template <typename T, PoolAllocatorThreading THREADING = PoolAllocatorThreading::SINGLE_THREADED, typename Allocator = STLAllocator<INTERNAL::PoolChunk<T, THREADING>>>
 	class PoolAllocator
 	{
 	public:
@@ -36,6 +61,8 @@ namespace bbe
 		typedef std::size_t                                                size_type;
 
 	private:
+		typedef INTERNAL::PoolChunk<T, THREADING> Chunk;
+
 		class PoolAllocatorDestroyer
 		{
 		private:
@@ -53,34 +80,296 @@ namespace bbe
 			}
 		};
 
+		//Every thread owns one of these (threads beyond AMOUNT_OF_THREAD_CACHES share them).
+		//The spin lock is therefore practically uncontended.
+		struct alignas(64) ThreadCache
+		{
+			std::atomic_flag lock = ATOMIC_FLAG_INIT;
+			Chunk* head = nullptr;
+			std::size_t length = 0;
+			std::atomic<std::size_t> allocations{ 0 };
+			std::atomic<std::size_t> deallocations{ 0 };
+		};
+
 		static constexpr std::size_t POOL_ALLOCATOR_DEFAULT_SIZE = 1024;
+		static constexpr std::size_t MAX_AMOUNT_OF_SLABS = 48;
+		static constexpr std::size_t AMOUNT_OF_THREAD_CACHES = 64;
+		static constexpr std::size_t BATCH_SIZE = 32;
 #ifndef BBE_DISABLE_ALL_SECURITY_CHECKS
 		std::size_t m_openAllocations = 0;		//Used to find memory leaks
 #endif //!BBE_DISABLE_ALL_SECURITY_CHECKS
 
-		INTERNAL::PoolChunk<T>* m_data = nullptr;
-		INTERNAL::PoolChunk<T>* m_head = nullptr;
+		//Slabs are only ever appended. m_amountOfSlabs is published after the slab entry
+		//is written, so lock free readers never see a half initialized slab.
+		Chunk* m_slabs[MAX_AMOUNT_OF_SLABS] = {};
+		std::size_t m_slabLengths[MAX_AMOUNT_OF_SLABS] = {};
+		std::atomic<std::size_t> m_amountOfSlabs{ 0 };
+		std::atomic<std::size_t> m_capacity{ 0 };
+		Chunk* m_head = nullptr;
 		std::size_t m_length;
+		std::size_t m_usedChunks = 0;
+		std::size_t m_peakUsedChunks = 0;
+
+		ThreadCache* m_threadCaches = nullptr;
+		std::atomic<Chunk*> m_sharedBatches{ nullptr };
+		std::mutex m_growMutex;
+		std::atomic<std::size_t> m_sharedUsedChunks{ 0 };
+		std::atomic<std::size_t> m_sharedPeakUsedChunks{ 0 };
 
 		Allocator* m_parentAllocator = nullptr;
 		bool m_needsToDeleteParentAllocator = false;
 
+		AllocatorTelemetry m_telemetry{ "PoolAllocator" };
+
+		static std::size_t getThreadCacheIndex()
+		{
+			static thread_local const std::size_t index = INTERNAL::poolAllocatorNextThreadIndex.fetch_add(1, std::memory_order_relaxed) % AMOUNT_OF_THREAD_CACHES;
+			return index;
+		}
+
+		static void lockCache(ThreadCache& cache)
+		{
+			while (cache.lock.test_and_set(std::memory_order_acquire))
+			{
+				//spin
+			}
+		}
+
+		static void unlockCache(ThreadCache& cache)
+		{
+			cache.lock.clear(std::memory_order_release);
+		}
+
+		Chunk* addSlab()
+		{
+			const std::size_t amountOfSlabs = m_amountOfSlabs.load(std::memory_order_relaxed);
+			if (amountOfSlabs == MAX_AMOUNT_OF_SLABS)
+			{
+				m_telemetry.onFailedAllocation();
+				debugBreak();
+				throw AllocatorOutOfMemoryException();
+			}
+
+			//The first two slabs have the requested size, every further slab doubles the capacity.
+			std::size_t slabLength = amountOfSlabs < 2 ? m_length : m_capacity.load(std::memory_order_relaxed);
+			if constexpr (THREADING == PoolAllocatorThreading::THREAD_SAFE)
+			{
+				slabLength = (slabLength + BATCH_SIZE - 1) / BATCH_SIZE * BATCH_SIZE;
+			}
+
+			Chunk* slab = nullptr;
+			try
+			{
+				slab = m_parentAllocator->allocate(slabLength);
+			}
+			catch (...)
+			{
+				m_telemetry.onFailedAllocation();
+				throw;
+			}
+			for (std::size_t i = 0; i < slabLength - 1; i++)
+			{
+				slab[i].links.nextPoolChunk = bbe::addressOf(slab[i + 1]);
+			}
+			slab[slabLength - 1].links.nextPoolChunk = nullptr;
+
+			m_slabs[amountOfSlabs] = slab;
+			m_slabLengths[amountOfSlabs] = slabLength;
+			const std::size_t capacity = m_capacity.fetch_add(slabLength, std::memory_order_relaxed) + slabLength;
+			m_telemetry.setCapacityBytes(capacity * sizeof(T));
+			m_amountOfSlabs.store(amountOfSlabs + 1, std::memory_order_release);
+			return slab;
+		}
+
+		bool isInSlab(const T* data) const
+		{
+			const std::size_t amountOfSlabs = m_amountOfSlabs.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < amountOfSlabs; i++)
+			{
+				const T* begin = reinterpret_cast<const T*>(m_slabs[i]);
+				const T* end = reinterpret_cast<const T*>(m_slabs[i] + m_slabLengths[i]);
+				if (data >= begin && data < end)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void pushSharedBatches(Chunk* first, Chunk* last)
+		{
+			Chunk* expected = m_sharedBatches.load(std::memory_order_relaxed);
+			do
+			{
+				last->links.nextBatch = expected;
+			} while (!m_sharedBatches.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		Chunk* popSharedBatchLocked()
+		{
+			//Only called while m_growMutex is held. With a single popper a head that is still
+			//equal to batch can not have been popped and pushed again in between, so a plain
+			//compare exchange is free of the ABA problem. Pushes stay lock free.
+			Chunk* batch = m_sharedBatches.load(std::memory_order_acquire);
+			while (batch != nullptr && !m_sharedBatches.compare_exchange_weak(batch, batch->links.nextBatch, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				//retry with the new head
+			}
+			return batch;
+		}
+
+		Chunk* refillThreadSafe()
+		{
+			//Waiting for the mutex instead of growing right away keeps the pool from adding
+			//slabs while other threads are merely busy handing batches around.
+			std::lock_guard<std::mutex> guard(m_growMutex);
+			Chunk* batch = popSharedBatchLocked();
+			if (batch != nullptr)
+			{
+				return batch;
+			}
+
+			Chunk* slab = addSlab();
+			const std::size_t slabLength = m_slabLengths[m_amountOfSlabs.load(std::memory_order_relaxed) - 1];
+			for (std::size_t i = 0; i < slabLength; i += BATCH_SIZE)
+			{
+				slab[i + BATCH_SIZE - 1].links.nextPoolChunk = nullptr;
+				slab[i].links.nextBatch = i + BATCH_SIZE < slabLength ? bbe::addressOf(slab[i + BATCH_SIZE]) : nullptr;
+			}
+			if (slabLength > BATCH_SIZE)
+			{
+				pushSharedBatches(bbe::addressOf(slab[BATCH_SIZE]), bbe::addressOf(slab[slabLength - BATCH_SIZE]));
+			}
+			return slab;
+		}
+
+		Chunk* takeChunk()
+		{
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				if (m_head == nullptr)
+				{
+					m_head = addSlab();
+				}
+				Chunk* chunk = m_head;
+				m_head = chunk->links.nextPoolChunk;
+				m_usedChunks++;
+				if (m_usedChunks > m_peakUsedChunks)
+				{
+					m_peakUsedChunks = m_usedChunks;
+				}
+				m_telemetry.onAllocation(sizeof(T));
+				return chunk;
+			}
+			else
+			{
+				ThreadCache& cache = m_threadCaches[getThreadCacheIndex()];
+				lockCache(cache);
+				if (cache.head == nullptr)
+				{
+					Chunk* batch = nullptr;
+					try
+					{
+						batch = refillThreadSafe();
+					}
+					catch (...)
+					{
+						unlockCache(cache);
+						throw;
+					}
+					cache.head = batch;
+					cache.length = BATCH_SIZE;
+				}
+				Chunk* chunk = cache.head;
+				cache.head = chunk->links.nextPoolChunk;
+				cache.length--;
+				cache.allocations.store(cache.allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				unlockCache(cache);
+
+				const std::size_t usedChunks = m_sharedUsedChunks.fetch_add(1, std::memory_order_relaxed) + 1;
+				std::size_t peakUsedChunks = m_sharedPeakUsedChunks.load(std::memory_order_relaxed);
+				while (usedChunks > peakUsedChunks && !m_sharedPeakUsedChunks.compare_exchange_weak(peakUsedChunks, usedChunks, std::memory_order_relaxed))
+				{
+					//retry with the new peak
+				}
+				return chunk;
+			}
+		}
+
+		void returnChunk(Chunk* chunk)
+		{
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				chunk->links.nextPoolChunk = m_head;
+				m_head = chunk;
+				m_usedChunks--;
+				m_telemetry.onDeallocation(sizeof(T));
+			}
+			else
+			{
+				m_sharedUsedChunks.fetch_sub(1, std::memory_order_relaxed);
+				ThreadCache& cache = m_threadCaches[getThreadCacheIndex()];
+				lockCache(cache);
+				chunk->links.nextPoolChunk = cache.head;
+				cache.head = chunk;
+				cache.length++;
+				cache.deallocations.store(cache.deallocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				if (cache.length >= 2 * BATCH_SIZE)
+				{
+					//Hand a full batch back so that chunks freed by one thread can be reused by others.
+					Chunk* batch = cache.head;
+					Chunk* batchEnd = batch;
+					for (std::size_t i = 1; i < BATCH_SIZE; i++)
+					{
+						batchEnd = batchEnd->links.nextPoolChunk;
+					}
+					cache.head = batchEnd->links.nextPoolChunk;
+					cache.length -= BATCH_SIZE;
+					batchEnd->links.nextPoolChunk = nullptr;
+					pushSharedBatches(batch, batch);
+				}
+				unlockCache(cache);
+			}
+		}
+
+		static void refreshTelemetry(const void* owner, AllocatorTelemetry& telemetry)
+		{
+			//Thread safe pools only count per cache, the sum is built when the profiler asks for it.
+			const PoolAllocator* pool = static_cast<const PoolAllocator*>(owner);
+			std::size_t allocations = 0;
+			std::size_t deallocations = 0;
+			for (std::size_t i = 0; i < AMOUNT_OF_THREAD_CACHES; i++)
+			{
+				allocations += pool->m_threadCaches[i].allocations.load(std::memory_order_relaxed);
+				deallocations += pool->m_threadCaches[i].deallocations.load(std::memory_order_relaxed);
+			}
+			telemetry.setCounters((allocations - deallocations) * sizeof(T), allocations, deallocations);
+		}
+
 	public:
 		explicit PoolAllocator(std::size_t size = POOL_ALLOCATOR_DEFAULT_SIZE, Allocator* parentAllocator = nullptr)
 			: m_length(size), m_parentAllocator(parentAllocator)
 		{
+			if (m_length == 0)
+			{
+				throw IllegalArgumentException();
+			}
 			if (m_parentAllocator == nullptr)
 			{
 				m_parentAllocator = new Allocator();
 				m_needsToDeleteParentAllocator = true;
 			}
-			m_data = m_parentAllocator->allocate(m_length);
-			for (std::size_t i = 0; i < m_length - 1; i++)
+			if constexpr (THREADING == PoolAllocatorThreading::THREAD_SAFE)
+			{
+				m_threadCaches = new ThreadCache[AMOUNT_OF_THREAD_CACHES];
+				m_telemetry.setRefresher(refreshTelemetry, this);
+				Chunk* batch = refillThreadSafe();
+				pushSharedBatches(batch, batch);
+			}
+			else
 			{
-				m_data[i].nextPoolChunk = bbe::addressOf(m_data[i + 1]);
+				m_head = addSlab();
 			}
-			m_data[m_length - 1].nextPoolChunk = nullptr;
-			m_head = m_data;
 		}
 
 		PoolAllocator(const PoolAllocator&  other) = delete; //Copy Constructor
@@ -91,20 +380,24 @@ namespace bbe
 		~PoolAllocator()
 		{
 #ifndef BBE_DISABLE_ALL_SECURITY_CHECKS
-			if (m_openAllocations != 0)
+			if (m_openAllocations != 0 || getAmountOfUsedChunks() != 0)
 			{
 				debugBreak();
 			}
 #endif // !BBE_DISABLE_ALL_SECURITY_CHECKS
-			if (m_data != nullptr && m_parentAllocator != nullptr)
+			m_telemetry.setRefresher(nullptr, nullptr);
+			const std::size_t amountOfSlabs = m_amountOfSlabs.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < amountOfSlabs; i++)
 			{
-				m_parentAllocator->deallocate(m_data, m_length);
+				m_parentAllocator->deallocate(m_slabs[i], m_slabLengths[i]);
+				m_slabs[i] = nullptr;
 			}
 			if (m_needsToDeleteParentAllocator)
 			{
 				delete m_parentAllocator;
 			}
-			m_data = nullptr;
+			delete[] m_threadCaches;
+			m_threadCaches = nullptr;
 			m_head = nullptr;
 		}
 
@@ -118,37 +411,95 @@ namespace bbe
 		template <typename... arguments>
 		T* allocateObject(arguments&&... args)
 		{
-			if (m_head == nullptr)
+			Chunk* retVal = takeChunk();
+			T* realRetVal = nullptr;
+			try
 			{
-				debugBreak();
-				throw AllocatorOutOfMemoryException();
+				realRetVal = new (retVal) T(std::forward<arguments>(args)...);
+			}
+			catch (...)
+			{
+				returnChunk(retVal);
+				throw;
 			}
-			INTERNAL::PoolChunk<T>* retVal = m_head;
-			m_head = retVal->nextPoolChunk;
-			T* realRetVal = new (retVal) T(std::forward<arguments>(args)...);
 #ifndef BBE_DISABLE_ALL_SECURITY_CHECKS
-			m_openAllocations++;
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				m_openAllocations++;
+			}
 #endif // !BBE_DISABLE_ALL_SECURITY_CHECKS
 			return realRetVal;
 		}
 
 		void deallocate(T* data)
 		{
-			if (data < reinterpret_cast<T*>(m_data))
-			{
-				throw MalformedPointerException();
-			}
-			if (data > reinterpret_cast<T*>(m_data) + m_length)
+			if (!isInSlab(data))
 			{
 				throw MalformedPointerException();
 			}
 			data->~T();
-			INTERNAL::PoolChunk<T>* poolChunk = reinterpret_cast<INTERNAL::PoolChunk<T>*>(data);
-			poolChunk->nextPoolChunk = m_head;
-			m_head = poolChunk;
+			returnChunk(reinterpret_cast<Chunk*>(data));
 #ifndef BBE_DISABLE_ALL_SECURITY_CHECKS
-			m_openAllocations--;
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				m_openAllocations--;
+			}
 #endif //!BBE_DISABLE_ALL_SECURITY_CHECKS
 		}
+
+		PoolAllocatorThreading getThreading() const
+		{
+			return THREADING;
+		}
+
+		std::size_t getAmountOfSlabs() const
+		{
+			return m_amountOfSlabs.load(std::memory_order_acquire);
+		}
+
+		std::size_t getCapacity() const
+		{
+			return m_capacity.load(std::memory_order_relaxed);
+		}
+
+		std::size_t getAmountOfUsedChunks() const
+		{
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				return m_usedChunks;
+			}
+
+			//While other threads are still allocating this is a snapshot.
+			return m_sharedUsedChunks.load(std::memory_order_relaxed);
+		}
+
+		std::size_t getAmountOfFreeChunks() const
+		{
+			return getCapacity() - getAmountOfUsedChunks();
+		}
+
+		std::size_t getPeakAmountOfUsedChunks() const
+		{
+			if constexpr (THREADING == PoolAllocatorThreading::SINGLE_THREADED)
+			{
+				return m_peakUsedChunks;
+			}
+			return m_sharedPeakUsedChunks.load(std::memory_order_relaxed);
+		}
+
+		float getOccupancy() const
+		{
+			return static_cast<float>(getAmountOfUsedChunks()) / static_cast<float>(getCapacity());
+		}
+
+		AllocatorTelemetry& getTelemetry()
+		{
+			return m_telemetry;
+		}
+
+		const AllocatorTelemetry& getTelemetry() const
+		{
+			return m_telemetry;
+		}
 	};
 }
@@ -12,6 +12,7 @@
 #include "../BBE/BezierCurve2.h"
 #include "../BBE/Font.h"
 #include "../BBE/Line2.h"
+#include "../BBE/Span.h"
 
 namespace bbe
 {
@@ -128,6 +129,7 @@ namespace bbe
 		void fillArrow(const Vector2& p1, const Vector2& p2, float tailWidth = 1, float spikeInnerLength = 20, float spikeOuterLength = 30, float spikeAngle = 0.35, bool dynamicSpikeLength = true);
 
 		void fillLineStrip(const bbe::List<bbe::Vector2> &points, bool closed, float lineWidth = 1);
+		void fillLineStrip(bbe::Span<const bbe::Vector2> points, bool closed, float lineWidth = 1);
 
 		void fillBezierCurve(const Vector2& startPoint, const Vector2& endPoint, const bbe::List<Vector2>& controlPoints);
 		void fillBezierCurve(const Vector2& startPoint, const Vector2& endPoint);
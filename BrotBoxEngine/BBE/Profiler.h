@@ -1,16 +1,38 @@
 #pragma once
 
+#include "../BBE/String.h"
+#include "../BBE/List.h"
+#include <cstddef>
+
 namespace bbe
 {
 	namespace Profiler
 	{
+		struct AllocatorStatistics
+		{
+			bbe::String name;
+			std::size_t liveBytes = 0;
+			std::size_t peakBytes = 0;
+			std::size_t capacityBytes = 0;
+			std::size_t amountOfAllocations = 0;
+			std::size_t amountOfDeallocations = 0;
+			std::size_t amountOfFailedAllocations = 0;
+			std::size_t amountOfAllocationsLastFrame = 0;
+		};
+
 		float getRenderTime();
 		float getCPUTime();
 
+		//A snapshot of every allocator that currently exists.
+		bbe::List<AllocatorStatistics> getAllocatorStatistics();
+		//Must be called between ImGui::NewFrame and ImGui::Render, e.g. in draw2D.
+		void drawAllocatorStatisticsWindow();
+
 		namespace INTERNAL
 		{
 			void setRenderTime(float time);
 			void setCPUTime(float time);
+			void endFrame();
 		}
 	}
-}
\ No newline at end of file
+}
@@ -1,56 +1,187 @@
 #pragma once
 
 #include <random>
+#include <type_traits>
 #include "../BBE/DataType.h"
 #include "../BBE/List.h"
 #include "../BBE/Vector2.h"
 #include "../BBE/Vector3.h"
 #include "../BBE/Vector4.h"
+#include "../BBE/UtilDebug.h"
+#include "../BBE/Exceptions.h"
+#include "../BBE/MersenneTwister.h"
+#include "../BBE/Xoshiro256.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace bbe {
-	class Random
+	namespace INTERNAL
+	{
+		//The upper 64 bits of the 128 bit product, the lower ones are written to outLow.
+		inline uint64_t randomMul128(uint64_t a, uint64_t b, uint64_t& outLow)
+		{
+#if defined(__SIZEOF_INT128__)
+			const __uint128_t product = static_cast<__uint128_t>(a) * b;
+			outLow = static_cast<uint64_t>(product);
+			return static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			uint64_t high;
+			outLow = _umul128(a, b, &high);
+			return high;
+#else
+			const uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+			const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+			uint64_t c = t < rl;
+			outLow = t + (rm1 << 32);
+			c += outLow < t;
+			return rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+		}
+	}
+
+	//Generator must provide next(), returning 32 or 64 random bits, a constructor taking the seed and setSeed(). Integers in a range
+	//use Lemire's multiply and shift method, which is unbiased and almost never needs a division
+	//(see: https://arxiv.org/abs/1805.10941). Floats are built directly from the upper bits.
+	template<typename Generator>
+	class RandomBase
 	{
 	private:
-		std::random_device m_ranDev;
-		std::mt19937       m_mt;
-		
+		Generator m_generator;
+
+		static constexpr bool GENERATES_64_BITS = sizeof(decltype(std::declval<Generator&>().next())) >= sizeof(uint64_t);
+
+		uint32_t next32()
+		{
+			if constexpr (GENERATES_64_BITS)
+			{
+				//The upper bits of xoshiro256** are the stronger ones.
+				return static_cast<uint32_t>(m_generator.next() >> 32);
+			}
+			else
+			{
+				return static_cast<uint32_t>(m_generator.next());
+			}
+		}
+
+		uint64_t next64()
+		{
+			if constexpr (GENERATES_64_BITS)
+			{
+				return m_generator.next();
+			}
+			else
+			{
+				const uint64_t high = static_cast<uint32_t>(m_generator.next());
+				return (high << 32) | static_cast<uint32_t>(m_generator.next());
+			}
+		}
+
+		//[0, range)
+		uint32_t bounded32(uint32_t range)
+		{
+			uint64_t product = static_cast<uint64_t>(next32()) * range;
+			uint32_t low = static_cast<uint32_t>(product);
+			if (low < range)
+			{
+				const uint32_t threshold = (0u - range) % range;
+				while (low < threshold)
+				{
+					product = static_cast<uint64_t>(next32()) * range;
+					low = static_cast<uint32_t>(product);
+				}
+			}
+			return static_cast<uint32_t>(product >> 32);
+		}
+
+		//[0, range)
+		uint64_t bounded64(uint64_t range)
+		{
+			uint64_t low;
+			uint64_t high = INTERNAL::randomMul128(next64(), range, low);
+			if (low < range)
+			{
+				const uint64_t threshold = (0ull - range) % range;
+				while (low < threshold)
+				{
+					high = INTERNAL::randomMul128(next64(), range, low);
+				}
+			}
+			return high;
+		}
+
 		template<typename T>
 		T randomInteger_()
 		{
-			//UNTESTED
-			std::uniform_int_distribution<T> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
-			return dist(m_mt);
+			if constexpr (sizeof(T) <= sizeof(uint32_t))
+			{
+				return static_cast<T>(next32());
+			}
+			else
+			{
+				return static_cast<T>(next64());
+			}
 		}
 
 		template<typename T>
 		T randomInteger_(T max)
 		{
-			//UNTESTED
-			std::uniform_int_distribution<T> dist(0, max - 1);
-			return dist(m_mt);
+			if (!(max > 0))
+			{
+				debugBreak();
+				throw IllegalArgumentException();
+			}
+			if constexpr (sizeof(T) <= sizeof(uint32_t))
+			{
+				return static_cast<T>(bounded32(static_cast<uint32_t>(max)));
+			}
+			else
+			{
+				return static_cast<T>(bounded64(static_cast<uint64_t>(max)));
+			}
 		}
 
 		template<typename T>
 		T randomFloat_()
 		{
-			//UNTESTED
-			std::uniform_real_distribution<T> dist(0.0, 1.0);
-			return dist(m_mt);
+			//[0, 1) with every representable multiple of the smallest step equally likely.
+			if constexpr (std::is_same<T, float>::value)
+			{
+				return (next32() >> 8) * (1.0f / 16777216.0f);
+			}
+			else
+			{
+				return (next64() >> 11) * (1.0 / 9007199254740992.0);
+			}
 		}
 
 		template<typename T>
 		T randomFloat_(T max)
 		{
-			//UNTESTED
-			std::uniform_real_distribution<T> dist(0.0, max);
-			return dist(m_mt);
+			return randomFloat_<T>() * max;
+		}
+
+		static uint64_t randomDeviceSeed()
+		{
+			std::random_device ranDev;
+			const uint64_t high = ranDev();
+			return (high << 32) | ranDev();
 		}
 
 	public:
-		explicit Random()
-			: m_ranDev(), m_mt(m_ranDev())
+		explicit RandomBase()
+			: RandomBase(randomDeviceSeed())
 		{
-			//DO NOTHING
+			//do nothing
+		}
+
+		//The seed goes straight to the generator, so it is seeded only once. That matters for
+		//generators that are expensive to seed, like the Mersenne Twister.
+		explicit RandomBase(uint64_t seed)
+			: m_generator(seed)
+		{
+			//do nothing
 		}
 
 		Vector2 randomVector2()
@@ -219,6 +350,17 @@ namespace bbe {
 			//UNTESTED
 			return randomInteger_<unsigned long>(max);
 		}
+
+		//Unlike randomULong, 64 bits on every platform (unsigned long is 32 bits on Windows).
+		uint64_t randomUInt64()
+		{
+			return randomInteger_<uint64_t>();
+		}
+
+		uint64_t randomUInt64(uint64_t max)
+		{
+			return randomInteger_<uint64_t>(max);
+		}
 		
 		float randomFloat()
 		{
@@ -246,13 +388,23 @@ namespace bbe {
 
 		bool randomBool()
 		{
-			//UNTESTED
-			return randomFloat() > 0.5f;
+			return (next32() >> 31) != 0;
 		}
 
-		void setSeed(unsigned int seed)
+		void setSeed(uint64_t seed)
 		{
-			m_mt.seed(seed);
+			m_generator.setSeed(seed);
+		}
+
+		//E.g. to jump a copy of a Xoshiro256StarStar based Random to get an independent stream.
+		Generator& getGenerator()
+		{
+			return m_generator;
 		}
 	};
+
+	//xoshiro256**, fast and constant time to seed.
+	typedef RandomBase<Xoshiro256StarStar> Random;
+	//The engine's Mersenne Twister. Slow to seed, see MersenneTwisterBase::setSeed.
+	typedef RandomBase<mt19937> RandomMersenneTwister;
 }
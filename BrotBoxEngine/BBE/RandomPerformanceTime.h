@@ -0,0 +1,120 @@
+#pragma once
+
+#include "../BBE/Random.h"
+#include "../BBE/MersenneTwister.h"
+#include "../BBE/Xoshiro256.h"
+#include "../BBE/CPUWatch.h"
+#include <random>
+#include <iostream>
+
+namespace bbe
+{
+	namespace test
+	{
+		void randomPrintSpeed()
+		{
+			constexpr int SEEDS = 10000;
+			constexpr int OUTPUTS = 1000 * 1000 * 100;
+
+			{
+				uint64_t sink = 0;
+				CPUWatch mtWatch;
+				mt19937 mt(42);
+				sink += mt.next();
+				const double mtTime = mtWatch.getTimeExpiredSeconds();
+
+				CPUWatch stlWatch;
+				std::mt19937 stl;
+				for (int i = 0; i < SEEDS; i++)
+				{
+					stl.seed(i);
+					sink += stl();
+				}
+				const double stlTime = stlWatch.getTimeExpiredSeconds();
+
+				CPUWatch xoshiroWatch;
+				Xoshiro256StarStar xoshiro;
+				for (int i = 0; i < SEEDS; i++)
+				{
+					xoshiro.setSeed(i);
+					sink += xoshiro.next();
+				}
+				const double xoshiroTime = xoshiroWatch.getTimeExpiredSeconds();
+
+				std::cout << "Time per seed, Mersenne Twister BBE: " << mtTime << "s, Mersenne Twister STL: " << stlTime / SEEDS
+					<< "s, xoshiro256**: " << xoshiroTime / SEEDS << "s (" << sink << ")" << std::endl;
+			}
+
+			{
+				mt19937 mt;
+				std::mt19937 stl;
+				Xoshiro256StarStar xoshiro;
+				uint64_t sink = 0;
+
+				CPUWatch mtWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					sink += mt.next();
+				}
+				const double mtTime = mtWatch.getTimeExpiredSeconds();
+
+				CPUWatch stlWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					sink += stl();
+				}
+				const double stlTime = stlWatch.getTimeExpiredSeconds();
+
+				CPUWatch xoshiroWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					sink += xoshiro.next();
+				}
+				const double xoshiroTime = xoshiroWatch.getTimeExpiredSeconds();
+
+				std::cout << OUTPUTS << " raw outputs, Mersenne Twister BBE (32 bit): " << mtTime << "s, Mersenne Twister STL (32 bit): " << stlTime
+					<< "s, xoshiro256** (64 bit): " << xoshiroTime << "s (" << sink << ")" << std::endl;
+			}
+
+			{
+				//What Random did before: std::mt19937 and a new distribution object per call.
+				std::mt19937 stl(42);
+				Random rand(42);
+				double sink = 0;
+
+				CPUWatch stlIntWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					std::uniform_int_distribution<int> dist(0, 99);
+					sink += dist(stl);
+				}
+				const double stlIntTime = stlIntWatch.getTimeExpiredSeconds();
+
+				CPUWatch intWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					sink += rand.randomInt(100);
+				}
+				const double intTime = intWatch.getTimeExpiredSeconds();
+
+				CPUWatch stlFloatWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					std::uniform_real_distribution<float> dist(0.0, 1.0);
+					sink += dist(stl);
+				}
+				const double stlFloatTime = stlFloatWatch.getTimeExpiredSeconds();
+
+				CPUWatch floatWatch;
+				for (int i = 0; i < OUTPUTS; i++)
+				{
+					sink += rand.randomFloat();
+				}
+				const double floatTime = floatWatch.getTimeExpiredSeconds();
+
+				std::cout << OUTPUTS << " randomInt(100), std distribution: " << stlIntTime << "s, Random: " << intTime << "s" << std::endl;
+				std::cout << OUTPUTS << " randomFloat(), std distribution: " << stlFloatTime << "s, Random: " << floatTime << "s (" << sink << ")" << std::endl;
+			}
+		}
+	}
+}
@@ -49,7 +49,8 @@ namespace bbe
 		float getWidth() const;
 		float getHeight() const;
 		virtual bbe::Vector2 getCenter() const override;
-		virtual void getVertices(bbe::List<bbe::Vector2>& outVertices) const override;
+		using Shape2::getVertices;
+		virtual void getVertices(VertexList& outVertices) const override;
 
 		void setX(float x);
 		void setY(float y);
@@ -47,6 +47,6 @@ namespace bbe
 		virtual bbe::Vector2 getCenter() const override;
 
 		using Shape2::getVertices;
-		virtual void getVertices(bbe::List<bbe::Vector2>& outVertices) const override;
+		virtual void getVertices(VertexList& outVertices) const override;
 	};
 }
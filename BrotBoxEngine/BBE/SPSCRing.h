@@ -0,0 +1,182 @@
+#pragma once
+
+#include "../BBE/Unconstructed.h"
+#include "../BBE/STLCapsule.h"
+#include "../BBE/Exceptions.h"
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace bbe
+{
+	//Bounded lock free ring for exactly one producer thread and one consumer thread.
+	//The capacity is rounded up to a power of two. Each side keeps a cached copy of
+	//the other side's index and only reloads it when the ring looks full (or empty),
+	//so in the steady state neither thread touches the other one's cache line.
+	template <typename T>
+	class SPSCRing
+	{
+	private:
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		INTERNAL::Unconstructed<T>* m_pdata = nullptr;
+		std::size_t m_capacity = 0;
+		std::size_t m_mask = 0;
+
+		//Written by the producer.
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail{ 0 };
+		std::size_t m_cachedHead = 0;
+
+		//Written by the consumer.
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head{ 0 };
+		std::size_t m_cachedTail = 0;
+
+		std::size_t getFreeSlotsForProducer(std::size_t tail, std::size_t neededSlots)
+		{
+			std::size_t freeSlots = m_capacity - (tail - m_cachedHead);
+			if (freeSlots < neededSlots)
+			{
+				m_cachedHead = m_head.load(std::memory_order_acquire);
+				freeSlots = m_capacity - (tail - m_cachedHead);
+			}
+			return freeSlots;
+		}
+
+		std::size_t getUsedSlotsForConsumer(std::size_t head, std::size_t neededSlots)
+		{
+			std::size_t usedSlots = m_cachedTail - head;
+			if (usedSlots < neededSlots)
+			{
+				m_cachedTail = m_tail.load(std::memory_order_acquire);
+				usedSlots = m_cachedTail - head;
+			}
+			return usedSlots;
+		}
+
+	public:
+		explicit SPSCRing(std::size_t capacity)
+		{
+			if (capacity == 0)
+			{
+				throw IllegalArgumentException();
+			}
+			m_capacity = 1;
+			while (m_capacity < capacity)
+			{
+				m_capacity <<= 1;
+			}
+			m_mask = m_capacity - 1;
+			m_pdata = new INTERNAL::Unconstructed<T>[m_capacity];
+		}
+
+		~SPSCRing()
+		{
+			const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; i++)
+			{
+				m_pdata[i & m_mask].m_value.~T();
+			}
+			delete[] m_pdata;
+			m_pdata = nullptr;
+		}
+
+		SPSCRing(const SPSCRing&  other) = delete; //Copy Constructor
+		SPSCRing(SPSCRing&& other) = delete; //Move Constructor
+		SPSCRing& operator=(const SPSCRing&  other) = delete; //Copy Assignment
+		SPSCRing& operator=(SPSCRing&& other) = delete; //Move Assignment
+
+		//Producer side. Returns false if the ring is full.
+		template <typename... arguments>
+		bool tryEmplace(arguments&&... args)
+		{
+			const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			if (getFreeSlotsForProducer(tail, 1) == 0)
+			{
+				return false;
+			}
+			new (bbe::addressOf(m_pdata[tail & m_mask].m_value)) T(std::forward<arguments>(args)...);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool tryPush(const T& value)
+		{
+			return tryEmplace(value);
+		}
+
+		bool tryPush(T&& value)
+		{
+			return tryEmplace(std::move(value));
+		}
+
+		//Producer side. Pushes as many of the values as fit and returns how many
+		//that were. All of them are published with a single store.
+		std::size_t tryPushBatch(const T* values, std::size_t amountOfValues)
+		{
+			const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			const std::size_t freeSlots = getFreeSlotsForProducer(tail, amountOfValues);
+			const std::size_t amount = freeSlots < amountOfValues ? freeSlots : amountOfValues;
+			for (std::size_t i = 0; i < amount; i++)
+			{
+				new (bbe::addressOf(m_pdata[(tail + i) & m_mask].m_value)) T(values[i]);
+			}
+			if (amount > 0)
+			{
+				m_tail.store(tail + amount, std::memory_order_release);
+			}
+			return amount;
+		}
+
+		//Consumer side. Returns false if the ring is empty.
+		bool tryPop(T& out)
+		{
+			const std::size_t head = m_head.load(std::memory_order_relaxed);
+			if (getUsedSlotsForConsumer(head, 1) == 0)
+			{
+				return false;
+			}
+			T& value = m_pdata[head & m_mask].m_value;
+			out = std::move(value);
+			value.~T();
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		//Consumer side. Pops up to maxAmountOfValues values and returns how many that were.
+		std::size_t tryPopBatch(T* out, std::size_t maxAmountOfValues)
+		{
+			const std::size_t head = m_head.load(std::memory_order_relaxed);
+			const std::size_t usedSlots = getUsedSlotsForConsumer(head, maxAmountOfValues);
+			const std::size_t amount = usedSlots < maxAmountOfValues ? usedSlots : maxAmountOfValues;
+			for (std::size_t i = 0; i < amount; i++)
+			{
+				T& value = m_pdata[(head + i) & m_mask].m_value;
+				out[i] = std::move(value);
+				value.~T();
+			}
+			if (amount > 0)
+			{
+				m_head.store(head + amount, std::memory_order_release);
+			}
+			return amount;
+		}
+
+		std::size_t getCapacity() const
+		{
+			return m_capacity;
+		}
+
+		//Only a snapshot while the other thread is working on the ring.
+		std::size_t getLength() const
+		{
+			const std::size_t head = m_head.load(std::memory_order_acquire);
+			const std::size_t tail = m_tail.load(std::memory_order_acquire);
+			return tail - head;
+		}
+
+		bool isEmpty() const
+		{
+			return getLength() == 0;
+		}
+	};
+}
@@ -7,6 +7,19 @@ namespace bbe
 	template <typename T>
 	class STLAllocator : public std::allocator<T>
 	{
-		//ADD NOTHING
+	public:
+		//Without this, the rebind inherited from std::allocator would turn rebound copies into std::allocators.
+		template <typename U>
+		struct rebind
+		{
+			using other = STLAllocator<U>;
+		};
+
+		STLAllocator() = default;
+
+		template <typename U>
+		STLAllocator(const STLAllocator<U>&) noexcept
+		{
+		}
 	};
 }
@@ -2,6 +2,8 @@
 
 #include "../BBE/Vector2.h"
 #include "../BBE/Vector3.h"
+#include "../BBE/VectorBatch.h"
+#include "../BBE/SmallList.h"
 
 namespace bbe
 {
@@ -34,6 +36,9 @@ namespace bbe
 			return projectionsPenetration(pr1, pr2) != 0;
 		}
 	public:
+		//The vertices of the shapes in here fit inline, so the separating axis tests don't allocate.
+		typedef bbe::SmallList<Vec, 8> VertexList;
+
 		virtual Vec getCenter() const = 0;
 
 		virtual bbe::List<Vec> getVertices() const
@@ -43,7 +48,15 @@ namespace bbe
 			return retVal;
 		}
 
-		virtual void getVertices(bbe::List<Vec>& outVertices) const = 0;
+		virtual void getVertices(bbe::List<Vec>& outVertices) const
+		{
+			VertexList vertices;
+			getVertices(vertices);
+			outVertices.clear();
+			outVertices.addArray(vertices.getRaw(), vertices.getLength());
+		}
+
+		virtual void getVertices(VertexList& outVertices) const = 0;
 
 		virtual bbe::List<Vec> getNormals() const = 0;
 
@@ -51,26 +64,10 @@ namespace bbe
 
 		virtual ProjectionResult project(const Vec& projection) const
 		{
-			const bbe::List<Vec> vertices = getVertices();
-			const bbe::List<Vec> projections = bbe::Math::project(vertices, projection);
-
-			const float init = projections[0] * projection;
-			ProjectionResult retVal{ init, init };
-
-			for (size_t i = 1; i < projections.getLength(); i++)
-			{
-				const float dot = projections[i] * projection;
-				if (dot > retVal.stop)
-				{
-					retVal.stop = dot;
-				}
-				if (dot < retVal.start)
-				{
-					retVal.start = dot;
-				}
-			}
-
-			return retVal;
+			VertexList vertices;
+			getVertices(vertices);
+			const bbe::Math::ProjectionRange range = bbe::Math::projectRange(bbe::Span<const Vec>(vertices.getRaw(), vertices.getLength()), projection);
+			return ProjectionResult{ range.min, range.max };
 		}
 
 		virtual bool intersects(const Shape<Vec>& other) const
@@ -101,7 +98,8 @@ namespace bbe
 	public:
 		virtual bbe::List<Vector2> getNormals() const override
 		{
-			auto vertices = getVertices();
+			VertexList vertices;
+			getVertices(vertices);
 			bbe::List<Vector2> retVal;
 			retVal.resizeCapacityAndLength(vertices.getLength());
 
@@ -177,6 +175,7 @@ namespace bbe
 				for (const bbe::Vector3& normalOther : normalsOther)
 				{
 					const bbe::Vector3 cross = normalThis.cross(normalOther);
+					if (cross.getLengthSq() == 0) continue; // Parallel normals, already covered above.
 					auto p1 = project(cross);
 					auto p2 = other.project(cross);
 					if (!projectionsIntersect(p1, p2)) return false;
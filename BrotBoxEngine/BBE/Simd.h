@@ -0,0 +1,37 @@
+#pragma once
+
+//Compile time detection of the SIMD instruction sets the engine may use in headers.
+//Every SIMD path has a scalar fallback that produces bit identical results. Define
+//BBE_NO_SIMD to force the fallbacks, e.g. to test them on an SSE2 capable machine.
+#if !defined(BBE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BBE_USE_SSE2
+#endif
+
+//AVX2 is not part of the x86-64 baseline, so it is only used by translation units that check
+//getSimdLevel() at runtime. Functions using it must be marked with BBE_TARGET_AVX2.
+#if defined(BBE_USE_SSE2) && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define BBE_CAN_DISPATCH_AVX2
+#if defined(_MSC_VER) && !defined(__clang__)
+#define BBE_TARGET_AVX2
+#else
+#define BBE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace bbe
+{
+	enum class SimdLevel
+	{
+		SCALAR,
+		SSE2,
+		AVX2,
+	};
+
+	//The best level that is supported by both the build and the CPU, unless lowered with setSimdLevel.
+	SimdLevel getSimdLevel();
+
+	//Lowers (or restores) the level used by runtime dispatched code, e.g. to compare the paths in
+	//tests and benchmarks. Levels above what the build and the CPU support are clamped.
+	void setSimdLevel(SimdLevel level);
+}
@@ -0,0 +1,716 @@
+#pragma once
+
+#include <functional>
+#include "../BBE/STLCapsule.h"
+#include "../BBE/Unconstructed.h"
+#include "../BBE/UtilDebug.h"
+#include "../BBE/Hash.h"
+#include "../BBE/Exceptions.h"
+#include "../BBE/List.h"
+#include <initializer_list>
+#include <limits>
+
+namespace bbe
+{
+	//A List that stores up to N elements inline and only spills to the heap
+	//once it grows beyond that. Meant for short lived temporaries in hot paths
+	//(e.g. the vertices or projections of a single shape) that would otherwise
+	//allocate on every call.
+	template <typename T, size_t N>
+	class SmallList
+	{
+		static_assert(N > 0, "SmallList needs at least one inline element. Use List instead.");
+	private:
+		size_t m_length;
+		size_t m_capacity;
+		INTERNAL::Unconstructed<T>* m_pdata;
+		INTERNAL::Unconstructed<T>  m_inlineData[N];
+
+		//Same templated predicate overloads as List, so small lambdas get inlined.
+		template <typename Predicate>
+		using EnableIfPredicate = typename std::enable_if<std::is_invocable_r<bool, Predicate&, const T&>::value, int>::type;
+
+		template <typename Predicate>
+		using EnableIfComparator = typename std::enable_if<std::is_invocable_r<bool, Predicate&, const T&, const T&>::value, int>::type;
+
+		using StdPredicate = std::function<bool(const T&)>;
+		using StdComparator = std::function<bool(const T&, const T&)>;
+
+		bool usesInlineData() const
+		{
+			return m_pdata == m_inlineData;
+		}
+
+		void moveElementsTo(INTERNAL::Unconstructed<T>* newData)
+		{
+			for (size_t i = 0; i < m_length; i++)
+			{
+				new (bbe::addressOf(newData[i].m_value)) T(std::move(m_pdata[i].m_value));
+				m_pdata[i].m_value.~T();
+			}
+		}
+
+		void releaseHeapData()
+		{
+			if (!usesInlineData())
+			{
+				delete[] m_pdata;
+				m_pdata = m_inlineData;
+				m_capacity = N;
+			}
+		}
+
+		void growIfNeeded(size_t amountOfNewObjects)
+		{
+			if (m_capacity < m_length + amountOfNewObjects)
+			{
+				size_t newCapacity = m_length + amountOfNewObjects;
+				if (newCapacity < m_capacity * 2)
+				{
+					newCapacity = m_capacity * 2;
+				}
+				resizeCapacity(newCapacity);
+			}
+		}
+
+		template <typename Other>
+		void copyFrom(const Other& other)
+		{
+			growIfNeeded(other.getLength());
+			for (size_t i = 0; i < other.getLength(); i++)
+			{
+				new (bbe::addressOf(m_pdata[i].m_value)) T(other[i]);
+			}
+			m_length = other.getLength();
+		}
+
+		void moveFrom(SmallList<T, N>&& other)
+		{
+			if (other.usesInlineData())
+			{
+				for (size_t i = 0; i < other.m_length; i++)
+				{
+					new (bbe::addressOf(m_inlineData[i].m_value)) T(std::move(other.m_inlineData[i].m_value));
+				}
+				m_length = other.m_length;
+				other.clear();
+			}
+			else
+			{
+				m_pdata = other.m_pdata;
+				m_length = other.m_length;
+				m_capacity = other.m_capacity;
+
+				other.m_pdata = other.m_inlineData;
+				other.m_length = 0;
+				other.m_capacity = N;
+			}
+		}
+
+	public:
+		SmallList()
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			//DO NOTHING
+		}
+
+		template <typename... arguments>
+		SmallList(size_t amountOfObjects, arguments&&... args)
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			growIfNeeded(amountOfObjects);
+			const T copyVal = T(std::forward<arguments>(args)...);
+			for (size_t i = 0; i < amountOfObjects; i++)
+			{
+				new (bbe::addressOf(m_pdata[i].m_value)) T(copyVal);
+			}
+			m_length = amountOfObjects;
+		}
+
+		SmallList(const SmallList<T, N>& other)
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			copyFrom(other);
+		}
+
+		SmallList(SmallList<T, N>&& other)
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			moveFrom(std::move(other));
+		}
+
+		explicit SmallList(const List<T>& other)
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			copyFrom(other);
+		}
+
+		/*nonexplicit*/ SmallList(const std::initializer_list<T> &il)
+			: m_length(0), m_capacity(N), m_pdata(m_inlineData)
+		{
+			growIfNeeded(il.size());
+			for (auto iter = il.begin(); iter != il.end(); iter++) {
+				add(*iter);
+			}
+		}
+
+		SmallList& operator=(const SmallList<T, N>& other)
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			copyFrom(other);
+			return *this;
+		}
+
+		SmallList& operator=(SmallList<T, N>&& other)
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			releaseHeapData();
+			moveFrom(std::move(other));
+			return *this;
+		}
+
+		~SmallList()
+		{
+			clear();
+			releaseHeapData();
+		}
+
+		size_t getCapacity() const
+		{
+			return m_capacity;
+		}
+
+		size_t getLength() const
+		{
+			return m_length;
+		}
+
+		//Returns true as long as the elements are still stored inline, i.e. no heap allocation happened.
+		bool isSmall() const
+		{
+			return usesInlineData();
+		}
+
+		T* getRaw()
+		{
+			return reinterpret_cast<T*>(m_pdata);
+		}
+
+		const T* getRaw() const
+		{
+			return reinterpret_cast<const T*>(m_pdata);
+		}
+
+		bool isEmpty() const
+		{
+			return m_length == 0;
+		}
+
+		T& operator[](size_t index)
+		{
+			if (index >= m_length)
+			{
+				debugBreak();
+			}
+			return m_pdata[index].m_value;
+		}
+
+		const T& operator[](size_t index) const
+		{
+			if (index >= m_length)
+			{
+				debugBreak();
+			}
+			return m_pdata[index].m_value;
+		}
+
+		void add(const T& val, size_t amount = 1)
+		{
+			growIfNeeded(amount);
+			for (size_t i = 0; i < amount; i++)
+			{
+				new (bbe::addressOf(m_pdata[m_length + i].m_value)) T(val);
+			}
+			m_length += amount;
+		}
+
+		void add(T&& val)
+		{
+			growIfNeeded(1);
+			new (bbe::addressOf(m_pdata[m_length].m_value)) T(std::move(val));
+			m_length += 1;
+		}
+
+		template <typename... arguments>
+		T& emplace(arguments&&... args)
+		{
+			growIfNeeded(1);
+			T* object = new (bbe::addressOf(m_pdata[m_length].m_value)) T(std::forward<arguments>(args)...);
+			m_length += 1;
+			return *object;
+		}
+
+		template <typename U>
+		void addAll(U&& t)
+		{
+			add(std::forward<U>(t));
+		}
+
+		template<typename U, typename... arguments>
+		void addAll(U&& t, arguments&&... args)
+		{
+			add(std::forward<U>(t));
+			addAll(std::forward<arguments>(args)...);
+		}
+
+		void addArray(const T* data, size_t size)
+		{
+			growIfNeeded(size);
+			for (size_t i = 0; i < size; i++)
+			{
+				add(data[i]);
+			}
+		}
+
+		void popBack(size_t amount = 1)
+		{
+			if (amount > m_length)
+			{
+				debugBreak();
+			}
+			for (size_t i = 0; i < amount; i++)
+			{
+				m_pdata[m_length - 1 - i].m_value.~T();
+			}
+			m_length -= amount;
+		}
+
+		void clear()
+		{
+			if (!std::is_trivially_destructible_v<T>)
+			{
+				for (size_t i = 0; i < m_length; i++)
+				{
+					(&(m_pdata[i].m_value))->~T();
+				}
+			}
+			m_length = 0;
+		}
+
+		bool shrink()
+		{
+			if (usesInlineData() || m_length == m_capacity)
+			{
+				return false;
+			}
+			if (m_length <= N)
+			{
+				INTERNAL::Unconstructed<T>* oldData = m_pdata;
+				moveElementsTo(m_inlineData);
+				delete[] oldData;
+				m_pdata = m_inlineData;
+				m_capacity = N;
+				return true;
+			}
+			resizeCapacity(m_length);
+			return true;
+		}
+
+		void resizeCapacity(size_t newCapacity)
+		{
+			if (newCapacity < m_length)
+			{
+				debugBreak();
+				throw IllegalArgumentException();
+			}
+
+			if (newCapacity <= m_capacity)
+			{
+				return;
+			}
+
+			INTERNAL::Unconstructed<T>* newData = new INTERNAL::Unconstructed<T>[newCapacity];
+			moveElementsTo(newData);
+			if (!usesInlineData())
+			{
+				delete[] m_pdata;
+			}
+			m_pdata = newData;
+			m_capacity = newCapacity;
+		}
+
+		template <typename dummyT = T>
+		typename std::enable_if<std::is_default_constructible<dummyT>::value, void>::type
+			resizeCapacityAndLength(size_t newLength)
+		{
+			static_assert(std::is_same<dummyT, T>::value, "Do not specify dummyT!");
+			if (newLength < m_length)
+			{
+				popBack(m_length - newLength);
+				return;
+			}
+			growIfNeeded(newLength - m_length);
+			for (size_t i = m_length; i < newLength; i++)
+			{
+				new (bbe::addressOf(m_pdata[i].m_value)) T();
+			}
+			m_length = newLength;
+		}
+
+		bool removeIndex(size_t index)
+		{
+			if (index >= m_length)
+			{
+				return false;
+			}
+
+			for (size_t i = index; i < m_length - 1; i++)
+			{
+				m_pdata[i].m_value = std::move(m_pdata[i + 1].m_value);
+			}
+			m_pdata[m_length - 1].m_value.~T();
+			m_length--;
+			return true;
+		}
+
+		size_t removeAll(const T& remover)
+		{
+			return removeAll(
+				[&](const T& other)
+				{
+					return other == remover;
+				});
+		}
+
+		size_t removeAll(std::function<bool(const T&)> predicate)
+		{
+			return removeAll<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		size_t removeAll(Predicate&& predicate)
+		{
+			size_t moveRange = 0;
+			for (size_t i = 0; i < m_length; i++)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					moveRange++;
+				}
+				else if (moveRange != 0)
+				{
+					m_pdata[i - moveRange].m_value = std::move(m_pdata[i].m_value);
+				}
+			}
+			popBack(moveRange);
+			return moveRange;
+		}
+
+		//Like removeAll, but fills the gaps with elements from the back instead of
+		//shifting everything down. Does not keep the order of the list.
+		size_t removeAllUnordered(const T& remover)
+		{
+			return removeAllUnordered(
+				[&](const T& other)
+				{
+					return other == remover;
+				});
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		size_t removeAllUnordered(Predicate&& predicate)
+		{
+			size_t removed = 0;
+			size_t i = 0;
+			while (i < m_length)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					removeIndexUnordered(i);
+					removed++;
+				}
+				else
+				{
+					i++;
+				}
+			}
+			return removed;
+		}
+
+		//Removes the element at index by moving the last element into its place. O(1), but does not keep the order of the list.
+		bool removeIndexUnordered(size_t index)
+		{
+			if (index >= m_length)
+			{
+				return false;
+			}
+
+			if (index != m_length - 1)
+			{
+				m_pdata[index].m_value = std::move(m_pdata[m_length - 1].m_value);
+			}
+			popBack();
+			return true;
+		}
+
+		bool removeSingle(const T& remover)
+		{
+			return removeSingle(
+				[&](const T& t)
+				{
+					return remover == t;
+				});
+		}
+
+		bool removeSingle(std::function<bool(const T&)> predicate)
+		{
+			return removeSingle<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool removeSingle(Predicate&& predicate)
+		{
+			T* found = find(std::forward<Predicate>(predicate));
+			if (found == nullptr) return false;
+			return removeIndex(found - getRaw());
+		}
+
+		size_t containsAmount(const T& t) const
+		{
+			return containsAmount(
+				[&](const T& other)
+				{
+					return t == other;
+				});
+		}
+
+		size_t containsAmount(std::function<bool(const T&)> predicate) const
+		{
+			return containsAmount<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		size_t containsAmount(Predicate&& predicate) const
+		{
+			size_t amount = 0;
+			for (size_t i = 0; i < m_length; i++)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					amount++;
+				}
+			}
+			return amount;
+		}
+
+		bool contains(const T& t) const
+		{
+			return contains(
+				[&](const T& other)
+				{
+					return t == other;
+				});
+		}
+
+		bool contains(std::function<bool(const T&)> predicate) const
+		{
+			return contains<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool contains(Predicate&& predicate) const
+		{
+			for (size_t i = 0; i < m_length; i++)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool containsUnique(const T& t) const
+		{
+			return containsAmount(t) == 1;
+		}
+
+		bool containsUnique(std::function<bool(const T&)> predicate) const
+		{
+			return containsAmount<const StdPredicate&>(predicate) == 1;
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		bool containsUnique(Predicate&& predicate) const
+		{
+			return containsAmount(std::forward<Predicate>(predicate)) == 1;
+		}
+
+		T* find(const T& t)
+		{
+			return find(
+				[&](const T& other)
+				{
+					return t == other;
+				});
+		}
+
+		T* find(std::function<bool(const T&)> predicate)
+		{
+			return find<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		T* find(Predicate&& predicate)
+		{
+			for (size_t i = 0; i < m_length; i++)
+			{
+				if (predicate(m_pdata[i].m_value))
+				{
+					return bbe::addressOf(m_pdata[i].m_value);
+				}
+			}
+			return nullptr;
+		}
+
+		T* findLast(const T& t)
+		{
+			return findLast(
+				[&t](const T& other)
+				{
+					return t == other;
+				});
+		}
+
+		T* findLast(std::function<bool(const T&)> predicate)
+		{
+			return findLast<const StdPredicate&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfPredicate<Predicate> = 0>
+		T* findLast(Predicate&& predicate)
+		{
+			for (size_t i = m_length; i > 0; i--)
+			{
+				if (predicate(m_pdata[i - 1].m_value))
+				{
+					return bbe::addressOf(m_pdata[i - 1].m_value);
+				}
+			}
+			return nullptr;
+		}
+
+		T* begin()
+		{
+			return reinterpret_cast<T*>(m_pdata);
+		}
+
+		const T* begin() const
+		{
+			return reinterpret_cast<const T*>(m_pdata);
+		}
+
+		T* end()
+		{
+			return reinterpret_cast<T*>(m_pdata) + m_length;
+		}
+
+		const T* end() const
+		{
+			return reinterpret_cast<const T*>(m_pdata) + m_length;
+		}
+
+		void sort()
+		{
+			sortSTL(begin(), end());
+		}
+
+		void sort(std::function<bool(const T&, const T&)> predicate)
+		{
+			sort<const StdComparator&>(predicate);
+		}
+
+		template <typename Predicate, EnableIfComparator<Predicate> = 0>
+		void sort(Predicate&& predicate)
+		{
+			sortSTL(begin(), end(), std::forward<Predicate>(predicate));
+		}
+
+		T& first()
+		{
+			if (m_length == 0)
+			{
+				throw ContainerEmptyException();
+			}
+
+			return m_pdata[0].m_value;
+		}
+
+		T& last()
+		{
+			if (m_length == 0)
+			{
+				throw ContainerEmptyException();
+			}
+
+			return m_pdata[m_length - 1].m_value;
+		}
+
+		List<T> toList() const
+		{
+			List<T> retVal(m_length);
+			retVal.addArray(getRaw(), m_length);
+			return retVal;
+		}
+
+		bool operator==(const SmallList<T, N>& other) const
+		{
+			if (m_length != other.m_length)
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < m_length; i++)
+			{
+				if (m_pdata[i].m_value != other.m_pdata[i].m_value)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool operator!=(const SmallList<T, N>& other) const
+		{
+			return !(operator==(other));
+		}
+	};
+
+	template<typename T, size_t N>
+	uint32_t hash(const SmallList<T, N> &t)
+	{
+		size_t length = t.getLength();
+		if (length > 16)
+		{
+			length = 16;
+		}
+
+		uint32_t _hash = hash(t.getLength());
+
+		for (size_t i = 0; i < length; i++)
+		{
+			_hash = hashCombine(_hash, hash(t[i]));
+		}
+
+		return _hash;
+	}
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+#include "../BBE/Span.h"
+#include "../BBE/STLCapsule.h"
+#include "../BBE/Exceptions.h"
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace bbe
+{
+	//Structure of arrays list. Every field gets its own contiguous column, so a loop
+	//that only touches some fields only pulls those through the cache. Columns are
+	//aligned to at least a cache line, which also suits SIMD loads.
+	//
+	//  SoAList<Vector2, Vector2, int> particles;
+	//  particles.add(pos, speed, type);
+	//  for (auto [pos, speed, type] : particles) pos += speed;
+	//  Span<Vector2> positions = particles.getColumn<0>();
+	template <typename... Fields>
+	class SoAList
+	{
+		static_assert(sizeof...(Fields) > 0, "An SoAList needs at least one field.");
+	private:
+		static constexpr std::size_t COLUMN_ALIGNMENT = 64;
+		static constexpr std::size_t SOA_LIST_MIN_CAPACITY = 16;
+		static constexpr std::size_t AMOUNT_OF_FIELDS = sizeof...(Fields);
+		typedef std::index_sequence_for<Fields...> FieldIndices;
+
+		template <std::size_t I>
+		using Field = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+		template <typename T>
+		static constexpr std::size_t getColumnAlignment()
+		{
+			return alignof(T) > COLUMN_ALIGNMENT ? alignof(T) : COLUMN_ALIGNMENT;
+		}
+
+		std::tuple<Fields*...> m_columns;
+		std::size_t m_length = 0;
+		std::size_t m_capacity = 0;
+
+		template <typename T>
+		static T* allocateColumn(std::size_t capacity)
+		{
+			return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(getColumnAlignment<T>())));
+		}
+
+		template <typename T>
+		static void deallocateColumn(T* column)
+		{
+			if (column != nullptr)
+			{
+				::operator delete(column, std::align_val_t(getColumnAlignment<T>()));
+			}
+		}
+
+		template <typename T>
+		static void relocate(T* destination, T* source, std::size_t amount)
+		{
+			if constexpr (std::is_trivially_copyable<T>::value)
+			{
+				if (amount > 0)
+				{
+					std::memcpy(destination, source, amount * sizeof(T));
+				}
+			}
+			else
+			{
+				for (std::size_t i = 0; i < amount; i++)
+				{
+					new (bbe::addressOf(destination[i])) T(std::move(source[i]));
+					source[i].~T();
+				}
+			}
+		}
+
+		template <typename T>
+		static void destroy(T* column, std::size_t begin, std::size_t end)
+		{
+			if constexpr (!std::is_trivially_destructible<T>::value)
+			{
+				for (std::size_t i = begin; i < end; i++)
+				{
+					column[i].~T();
+				}
+			}
+		}
+
+		template <std::size_t... I>
+		void reallocate(std::size_t newCapacity, std::index_sequence<I...>)
+		{
+			std::tuple<Fields*...> newColumns(allocateColumn<Fields>(newCapacity)...);
+			(relocate(std::get<I>(newColumns), std::get<I>(m_columns), m_length), ...);
+			(deallocateColumn(std::get<I>(m_columns)), ...);
+			m_columns = newColumns;
+			m_capacity = newCapacity;
+		}
+
+		template <std::size_t... I>
+		void destroyRange(std::size_t begin, std::size_t end, std::index_sequence<I...>)
+		{
+			(destroy(std::get<I>(m_columns), begin, end), ...);
+		}
+
+		template <std::size_t... I>
+		void deallocateColumns(std::index_sequence<I...>)
+		{
+			(deallocateColumn(std::get<I>(m_columns)), ...);
+			m_columns = std::tuple<Fields*...>();
+		}
+
+		template <std::size_t... I, typename... Args>
+		void constructAt(std::size_t index, std::index_sequence<I...>, Args&&... values)
+		{
+			(new (bbe::addressOf(std::get<I>(m_columns)[index])) Fields(std::forward<Args>(values)), ...);
+		}
+
+		template <std::size_t... I>
+		void copyFrom(const SoAList& other, std::index_sequence<I...>)
+		{
+			for (std::size_t i = 0; i < other.m_length; i++)
+			{
+				(new (bbe::addressOf(std::get<I>(m_columns)[i])) Fields(std::get<I>(other.m_columns)[i]), ...);
+				m_length++;
+			}
+		}
+
+		template <std::size_t... I>
+		void moveElement(std::size_t to, std::size_t from, std::index_sequence<I...>)
+		{
+			((std::get<I>(m_columns)[to] = std::move(std::get<I>(m_columns)[from])), ...);
+		}
+
+		template <std::size_t... I>
+		std::tuple<Fields&...> getElement(std::size_t index, std::index_sequence<I...>)
+		{
+			return std::tuple<Fields&...>(std::get<I>(m_columns)[index]...);
+		}
+
+		template <std::size_t... I>
+		std::tuple<const Fields&...> getElement(std::size_t index, std::index_sequence<I...>) const
+		{
+			return std::tuple<const Fields&...>(std::get<I>(m_columns)[index]...);
+		}
+
+	public:
+		//Zip iterator. Dereferencing yields a tuple of references to the fields of one
+		//element, which works well with structured bindings.
+		template <bool isConst>
+		class Iterator
+		{
+		private:
+			typedef typename std::conditional<isConst, const SoAList*, SoAList*>::type ListPointer;
+			ListPointer m_plist;
+			std::size_t m_index;
+
+		public:
+			Iterator(ListPointer list, std::size_t index)
+				: m_plist(list), m_index(index)
+			{
+				//do nothing
+			}
+
+			auto operator*() const
+			{
+				return (*m_plist)[m_index];
+			}
+
+			Iterator& operator++()
+			{
+				m_index++;
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator copy = *this;
+				m_index++;
+				return copy;
+			}
+
+			bool operator==(const Iterator& other) const
+			{
+				return m_index == other.m_index && m_plist == other.m_plist;
+			}
+
+			bool operator!=(const Iterator& other) const
+			{
+				return !operator==(other);
+			}
+		};
+
+		SoAList()
+		{
+			//do nothing
+		}
+
+		explicit SoAList(std::size_t capacity)
+		{
+			reserve(capacity);
+		}
+
+		SoAList(const SoAList& other) //Copy Constructor
+		{
+			reserve(other.m_length);
+			copyFrom(other, FieldIndices());
+		}
+
+		SoAList(SoAList&& other) noexcept //Move Constructor
+			: m_columns(other.m_columns), m_length(other.m_length), m_capacity(other.m_capacity)
+		{
+			other.m_columns = std::tuple<Fields*...>();
+			other.m_length = 0;
+			other.m_capacity = 0;
+		}
+
+		SoAList& operator=(const SoAList& other) //Copy Assignment
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			reserve(other.m_length);
+			copyFrom(other, FieldIndices());
+			return *this;
+		}
+
+		SoAList& operator=(SoAList&& other) noexcept //Move Assignment
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			deallocateColumns(FieldIndices());
+			m_columns = other.m_columns;
+			m_length = other.m_length;
+			m_capacity = other.m_capacity;
+			other.m_columns = std::tuple<Fields*...>();
+			other.m_length = 0;
+			other.m_capacity = 0;
+			return *this;
+		}
+
+		~SoAList()
+		{
+			clear();
+			deallocateColumns(FieldIndices());
+		}
+
+		template <typename... Args>
+		void add(Args&&... values)
+		{
+			static_assert(sizeof...(Args) == AMOUNT_OF_FIELDS, "add needs exactly one value per field.");
+			if (m_length == m_capacity)
+			{
+				reserve(m_capacity == 0 ? SOA_LIST_MIN_CAPACITY : m_capacity * 2);
+			}
+			constructAt(m_length, FieldIndices(), std::forward<Args>(values)...);
+			m_length++;
+		}
+
+		//Moves the last element into the gap, so this is O(1) but doesn't keep the order.
+		void removeIndexUnordered(std::size_t index)
+		{
+			if (index >= m_length)
+			{
+				throw IllegalIndexException();
+			}
+			if (index != m_length - 1)
+			{
+				moveElement(index, m_length - 1, FieldIndices());
+			}
+			popBack();
+		}
+
+		void popBack()
+		{
+			if (m_length == 0)
+			{
+				throw ContainerEmptyException();
+			}
+			destroyRange(m_length - 1, m_length, FieldIndices());
+			m_length--;
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			if (capacity > m_capacity)
+			{
+				reallocate(capacity, FieldIndices());
+			}
+		}
+
+		void clear()
+		{
+			destroyRange(0, m_length, FieldIndices());
+			m_length = 0;
+		}
+
+		std::size_t getLength() const
+		{
+			return m_length;
+		}
+
+		std::size_t getCapacity() const
+		{
+			return m_capacity;
+		}
+
+		bool isEmpty() const
+		{
+			return m_length == 0;
+		}
+
+		template <std::size_t I>
+		Span<Field<I>> getColumn()
+		{
+			return Span<Field<I>>(std::get<I>(m_columns), m_length);
+		}
+
+		template <std::size_t I>
+		Span<const Field<I>> getColumn() const
+		{
+			return Span<const Field<I>>(std::get<I>(m_columns), m_length);
+		}
+
+		template <std::size_t I>
+		Field<I>& get(std::size_t index)
+		{
+			return std::get<I>(m_columns)[index];
+		}
+
+		template <std::size_t I>
+		const Field<I>& get(std::size_t index) const
+		{
+			return std::get<I>(m_columns)[index];
+		}
+
+		std::tuple<Fields&...> operator[](std::size_t index)
+		{
+			return getElement(index, FieldIndices());
+		}
+
+		std::tuple<const Fields&...> operator[](std::size_t index) const
+		{
+			return getElement(index, FieldIndices());
+		}
+
+		Iterator<false> begin()
+		{
+			return Iterator<false>(this, 0);
+		}
+
+		Iterator<false> end()
+		{
+			return Iterator<false>(this, m_length);
+		}
+
+		Iterator<true> begin() const
+		{
+			return Iterator<true>(this, 0);
+		}
+
+		Iterator<true> end() const
+		{
+			return Iterator<true>(this, m_length);
+		}
+	};
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../BBE/SoAList.h"
+#include "../BBE/List.h"
+#include "../BBE/Vector2.h"
+#include "../BBE/Vector4.h"
+#include "../BBE/Random.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//The particle layout of ExampleParticleLife and friends, padded with the kind of
+		//per particle data real simulations carry around but rarely touch.
+		struct SoAListBenchmarkParticle
+		{
+			Vector2 pos;
+			Vector2 speed;
+			int type;
+			float mass;
+			float age;
+			float color[4];
+		};
+
+		void soaListPrintParticleUpdateSpeed()
+		{
+			constexpr std::size_t amountOfParticles = 1024 * 1024;
+			constexpr int frames = 100;
+			constexpr float timeSinceLastFrame = 1.f / 60.f;
+
+			List<SoAListBenchmarkParticle> aos;
+			SoAList<Vector2, Vector2, int, float, float, Vector4> soa;
+			aos.resizeCapacity(amountOfParticles);
+			soa.reserve(amountOfParticles);
+			Random rand;
+			rand.setSeed(42);
+			for (std::size_t i = 0; i < amountOfParticles; i++)
+			{
+				const Vector2 pos(rand.randomFloat(), rand.randomFloat());
+				const Vector2 speed(rand.randomFloat() - 0.5f, rand.randomFloat() - 0.5f);
+				const int type = rand.randomInt(6);
+				aos.add(SoAListBenchmarkParticle{ pos, speed, type, 1.f, 0.f, { 1, 1, 1, 1 } });
+				soa.add(pos, speed, type, 1.f, 0.f, Vector4(1, 1, 1, 1));
+			}
+
+			//Integrate the positions and count the particles of one type, the two loops every example runs per frame.
+			int aosCount = 0;
+			CPUWatch aosWatch;
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (std::size_t i = 0; i < aos.getLength(); i++)
+				{
+					aos[i].speed *= 0.99f;
+					aos[i].pos += aos[i].speed * timeSinceLastFrame;
+				}
+				for (std::size_t i = 0; i < aos.getLength(); i++)
+				{
+					aosCount += aos[i].type == 0 ? 1 : 0;
+				}
+			}
+			const double aosTime = aosWatch.getTimeExpiredSeconds();
+
+			int soaCount = 0;
+			CPUWatch soaWatch;
+			for (int frame = 0; frame < frames; frame++)
+			{
+				Span<Vector2> positions = soa.getColumn<0>();
+				Span<Vector2> speeds = soa.getColumn<1>();
+				for (std::size_t i = 0; i < positions.getLength(); i++)
+				{
+					speeds[i] *= 0.99f;
+					positions[i] += speeds[i] * timeSinceLastFrame;
+				}
+				for (int type : soa.getColumn<2>())
+				{
+					soaCount += type == 0 ? 1 : 0;
+				}
+			}
+			const double soaTime = soaWatch.getTimeExpiredSeconds();
+
+			std::cout << "AoS: " << aosTime << "s (" << aosCount << ")" << std::endl;
+			std::cout << "SoA: " << soaTime << "s (" << soaCount << ")" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,1023 @@
+#pragma once
+
+#include "../BBE/Exceptions.h"
+#include "../BBE/Unconstructed.h"
+#include "../BBE/STLCapsule.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace bbe
+{
+	//Ordered map implemented as a B+ tree. All entries live in the leaves, which
+	//are linked for in order iteration; inner nodes only hold separator keys. A
+	//node holds about four cache lines of keys (and values in the leaves), keys
+	//and values are stored in separate arrays so searching a node only touches
+	//keys. Insertion and removal are O(log n) and never move more than a node.
+	//Keys only need operator<. Iterators and pointers to values are invalidated
+	//by every add or remove.
+	template<typename Key, typename Value>
+	class SortedMap
+	{
+	private:
+		static constexpr size_t NODE_BYTES = 256;
+
+		static constexpr size_t capacityFor(size_t bytesPerElement)
+		{
+			return NODE_BYTES / bytesPerElement < 4 ? 4 : NODE_BYTES / bytesPerElement;
+		}
+
+		static constexpr size_t LEAF_CAPACITY  = capacityFor(sizeof(Key) + sizeof(Value));
+		static constexpr size_t INNER_CAPACITY = capacityFor(sizeof(Key) + sizeof(void*));
+		static constexpr size_t LEAF_MIN_LENGTH  = LEAF_CAPACITY / 2;
+		//A full inner node passes one of its keys up when it splits, so for an even capacity
+		//the two halves can't both get INNER_CAPACITY / 2 keys.
+		static constexpr size_t INNER_MIN_LENGTH = (INNER_CAPACITY - 1) / 2;
+
+		struct alignas(64) Node
+		{
+			bool     m_isLeaf;
+			uint32_t m_length = 0;
+
+			explicit Node(bool isLeaf)
+				: m_isLeaf(isLeaf)
+			{
+				//do nothing
+			}
+		};
+
+		struct Leaf : public Node
+		{
+			Leaf* m_pnext = nullptr;
+			Leaf* m_pprev = nullptr;
+			INTERNAL::Unconstructed<Key>   m_keys[LEAF_CAPACITY];
+			INTERNAL::Unconstructed<Value> m_values[LEAF_CAPACITY];
+
+			Leaf()
+				: Node(true)
+			{
+				//do nothing
+			}
+
+			~Leaf()
+			{
+				for (size_t i = 0; i < this->m_length; i++)
+				{
+					m_keys[i].m_value.~Key();
+					m_values[i].m_value.~Value();
+				}
+			}
+
+			Key& key(size_t index)
+			{
+				return m_keys[index].m_value;
+			}
+
+			Value& value(size_t index)
+			{
+				return m_values[index].m_value;
+			}
+
+			//Moves the entry at from into the unconstructed slot to of other.
+			void moveEntryTo(size_t from, Leaf* other, size_t to)
+			{
+				new (bbe::addressOf(other->m_keys[to].m_value)) Key(std::move(key(from)));
+				new (bbe::addressOf(other->m_values[to].m_value)) Value(std::move(value(from)));
+				key(from).~Key();
+				value(from).~Value();
+			}
+
+			//Opens an unconstructed gap at index.
+			void shiftRight(size_t index)
+			{
+				for (size_t i = this->m_length; i > index; i--)
+				{
+					moveEntryTo(i - 1, this, i);
+				}
+			}
+
+			//Closes the unconstructed gap at index.
+			void shiftLeft(size_t index)
+			{
+				for (size_t i = index; i + 1 < this->m_length; i++)
+				{
+					moveEntryTo(i + 1, this, i);
+				}
+			}
+		};
+
+		struct Inner : public Node
+		{
+			INTERNAL::Unconstructed<Key> m_keys[INNER_CAPACITY];
+			Node* m_children[INNER_CAPACITY + 1];
+
+			Inner()
+				: Node(false)
+			{
+				//do nothing
+			}
+
+			~Inner()
+			{
+				for (size_t i = 0; i < this->m_length; i++)
+				{
+					m_keys[i].m_value.~Key();
+				}
+			}
+
+			Key& key(size_t index)
+			{
+				return m_keys[index].m_value;
+			}
+
+			void moveKeyTo(size_t from, Inner* other, size_t to)
+			{
+				new (bbe::addressOf(other->m_keys[to].m_value)) Key(std::move(key(from)));
+				key(from).~Key();
+			}
+		};
+
+		template <bool isConst>
+		class IteratorBase
+		{
+			friend class SortedMap<Key, Value>;
+		private:
+			Leaf*  m_pleaf;
+			size_t m_index;
+
+			IteratorBase(Leaf* leaf, size_t index)
+				: m_pleaf(leaf), m_index(index)
+			{
+				if (m_pleaf != nullptr && m_index == m_pleaf->m_length)
+				{
+					m_pleaf = m_pleaf->m_pnext;
+					m_index = 0;
+				}
+			}
+
+		public:
+			typedef typename std::conditional<isConst, const Value, Value>::type ValueType;
+
+			//What dereferencing an iterator yields. Keys and values aren't stored
+			//next to each other, so this only points to them.
+			class Entry
+			{
+			private:
+				const Key* m_pkey;
+				ValueType* m_pvalue;
+
+			public:
+				Entry(const Key* key, ValueType* value)
+					: m_pkey(key), m_pvalue(value)
+				{
+					//do nothing
+				}
+
+				const Key& getKey() const
+				{
+					return *m_pkey;
+				}
+
+				ValueType& getValue() const
+				{
+					return *m_pvalue;
+				}
+			};
+
+			const Key& getKey() const
+			{
+				return m_pleaf->key(m_index);
+			}
+
+			ValueType& getValue() const
+			{
+				return m_pleaf->value(m_index);
+			}
+
+			Entry operator*() const
+			{
+				return Entry(bbe::addressOf(getKey()), bbe::addressOf(getValue()));
+			}
+
+			IteratorBase& operator++()
+			{
+				m_index++;
+				if (m_index == m_pleaf->m_length)
+				{
+					m_pleaf = m_pleaf->m_pnext;
+					m_index = 0;
+				}
+				return *this;
+			}
+
+			IteratorBase operator++(int)
+			{
+				IteratorBase copy = *this;
+				operator++();
+				return copy;
+			}
+
+			bool operator==(const IteratorBase& other) const
+			{
+				return m_pleaf == other.m_pleaf && m_index == other.m_index;
+			}
+
+			bool operator!=(const IteratorBase& other) const
+			{
+				return !operator==(other);
+			}
+		};
+
+	public:
+		using Iterator      = IteratorBase<false>;
+		using ConstIterator = IteratorBase<true>;
+
+	private:
+		Node*  m_proot = nullptr;
+		Leaf*  m_pfirstLeaf = nullptr;
+		size_t m_length = 0;
+
+		//Index of the first key that is not less than key.
+		template <typename Keys>
+		static size_t lowerBoundIndex(Keys& keys, size_t length, const Key& key)
+		{
+			size_t low = 0;
+			size_t high = length;
+			while (low < high)
+			{
+				const size_t mid = (low + high) / 2;
+				if (keys[mid].m_value < key)
+				{
+					low = mid + 1;
+				}
+				else
+				{
+					high = mid;
+				}
+			}
+			return low;
+		}
+
+		//Index of the first key that is greater than key.
+		template <typename Keys>
+		static size_t upperBoundIndex(Keys& keys, size_t length, const Key& key)
+		{
+			size_t low = 0;
+			size_t high = length;
+			while (low < high)
+			{
+				const size_t mid = (low + high) / 2;
+				if (key < keys[mid].m_value)
+				{
+					high = mid;
+				}
+				else
+				{
+					low = mid + 1;
+				}
+			}
+			return low;
+		}
+
+		//Child i of an inner node holds the keys k with key(i - 1) <= k < key(i).
+		Leaf* findLeaf(const Key& key) const
+		{
+			Node* node = m_proot;
+			while (!node->m_isLeaf)
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				node = inner->m_children[upperBoundIndex(inner->m_keys, inner->m_length, key)];
+			}
+			return static_cast<Leaf*>(node);
+		}
+
+		static bool isFull(const Node* node)
+		{
+			return node->m_length == (node->m_isLeaf ? LEAF_CAPACITY : INNER_CAPACITY);
+		}
+
+		//Splits the full child at index into two, the new separator goes into parent.
+		static void splitChild(Inner* parent, size_t index)
+		{
+			for (size_t i = parent->m_length; i > index; i--)
+			{
+				parent->moveKeyTo(i - 1, parent, i);
+				parent->m_children[i + 1] = parent->m_children[i];
+			}
+
+			Node* child = parent->m_children[index];
+			if (child->m_isLeaf)
+			{
+				Leaf* left = static_cast<Leaf*>(child);
+				Leaf* right = new Leaf();
+				const size_t keep = LEAF_CAPACITY / 2;
+				for (size_t i = keep; i < left->m_length; i++)
+				{
+					left->moveEntryTo(i, right, i - keep);
+				}
+				right->m_length = left->m_length - keep;
+				left->m_length = keep;
+				right->m_pnext = left->m_pnext;
+				right->m_pprev = left;
+				if (left->m_pnext != nullptr)
+				{
+					left->m_pnext->m_pprev = right;
+				}
+				left->m_pnext = right;
+				new (bbe::addressOf(parent->key(index))) Key(right->key(0));
+				parent->m_children[index + 1] = right;
+			}
+			else
+			{
+				Inner* left = static_cast<Inner*>(child);
+				Inner* right = new Inner();
+				const size_t mid = (INNER_CAPACITY - 1) / 2;
+				for (size_t i = mid + 1; i < left->m_length; i++)
+				{
+					left->moveKeyTo(i, right, i - mid - 1);
+				}
+				for (size_t i = mid + 1; i <= left->m_length; i++)
+				{
+					right->m_children[i - mid - 1] = left->m_children[i];
+				}
+				right->m_length = left->m_length - mid - 1;
+				left->moveKeyTo(mid, parent, index);
+				left->m_length = mid;
+				parent->m_children[index + 1] = right;
+			}
+			parent->m_length++;
+		}
+
+		//Inserts a new entry unless the key exists. Full nodes are split on the way
+		//down, so the leaf always has room and splits never have to go back up.
+		template <typename... arguments>
+		Value& emplaceInternal(const Key& key, bool& outInserted, arguments&&... args)
+		{
+			if (m_proot == nullptr)
+			{
+				m_pfirstLeaf = new Leaf();
+				m_proot = m_pfirstLeaf;
+			}
+			if (isFull(m_proot))
+			{
+				Inner* newRoot = new Inner();
+				newRoot->m_children[0] = m_proot;
+				splitChild(newRoot, 0);
+				m_proot = newRoot;
+			}
+
+			Node* node = m_proot;
+			while (!node->m_isLeaf)
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				size_t index = upperBoundIndex(inner->m_keys, inner->m_length, key);
+				if (isFull(inner->m_children[index]))
+				{
+					splitChild(inner, index);
+					if (!(key < inner->key(index)))
+					{
+						index++;
+					}
+				}
+				node = inner->m_children[index];
+			}
+
+			Leaf* leaf = static_cast<Leaf*>(node);
+			const size_t index = lowerBoundIndex(leaf->m_keys, leaf->m_length, key);
+			if (index < leaf->m_length && !(key < leaf->key(index)))
+			{
+				outInserted = false;
+				return leaf->value(index);
+			}
+			leaf->shiftRight(index);
+			try
+			{
+				new (bbe::addressOf(leaf->m_values[index].m_value)) Value(std::forward<arguments>(args)...);
+			}
+			catch (...)
+			{
+				//The gap counts as an entry while it is closed again.
+				leaf->m_length++;
+				leaf->shiftLeft(index);
+				leaf->m_length--;
+				throw;
+			}
+			new (bbe::addressOf(leaf->m_keys[index].m_value)) Key(key);
+			leaf->m_length++;
+			m_length++;
+			outInserted = true;
+			return leaf->value(index);
+		}
+
+		//Refills the child at index of parent after it dropped below its minimum,
+		//by borrowing from a sibling or merging with one.
+		static void fixUnderflow(Inner* parent, size_t index)
+		{
+			Node* child = parent->m_children[index];
+			Node* leftSibling = index > 0 ? parent->m_children[index - 1] : nullptr;
+			Node* rightSibling = index < parent->m_length ? parent->m_children[index + 1] : nullptr;
+
+			if (child->m_isLeaf)
+			{
+				Leaf* leaf = static_cast<Leaf*>(child);
+				Leaf* left = static_cast<Leaf*>(leftSibling);
+				Leaf* right = static_cast<Leaf*>(rightSibling);
+				if (left != nullptr && left->m_length > LEAF_MIN_LENGTH)
+				{
+					leaf->shiftRight(0);
+					left->moveEntryTo(left->m_length - 1, leaf, 0);
+					left->m_length--;
+					leaf->m_length++;
+					parent->key(index - 1) = leaf->key(0);
+				}
+				else if (right != nullptr && right->m_length > LEAF_MIN_LENGTH)
+				{
+					right->moveEntryTo(0, leaf, leaf->m_length);
+					right->shiftLeft(0);
+					right->m_length--;
+					leaf->m_length++;
+					parent->key(index) = right->key(0);
+				}
+				else
+				{
+					if (left == nullptr)
+					{
+						left = leaf;
+						index++;
+					}
+					else
+					{
+						right = leaf;
+					}
+					//Merge right into left, then drop right and the separator at index - 1.
+					for (size_t i = 0; i < right->m_length; i++)
+					{
+						right->moveEntryTo(i, left, left->m_length + i);
+					}
+					left->m_length += right->m_length;
+					right->m_length = 0;
+					left->m_pnext = right->m_pnext;
+					if (right->m_pnext != nullptr)
+					{
+						right->m_pnext->m_pprev = left;
+					}
+					delete right;
+					removeSeparator(parent, index - 1);
+				}
+			}
+			else
+			{
+				Inner* inner = static_cast<Inner*>(child);
+				Inner* left = static_cast<Inner*>(leftSibling);
+				Inner* right = static_cast<Inner*>(rightSibling);
+				if (left != nullptr && left->m_length > INNER_MIN_LENGTH)
+				{
+					for (size_t i = inner->m_length; i > 0; i--)
+					{
+						inner->moveKeyTo(i - 1, inner, i);
+					}
+					for (size_t i = inner->m_length + 1; i > 0; i--)
+					{
+						inner->m_children[i] = inner->m_children[i - 1];
+					}
+					parent->moveKeyTo(index - 1, inner, 0);
+					inner->m_children[0] = left->m_children[left->m_length];
+					left->moveKeyTo(left->m_length - 1, parent, index - 1);
+					left->m_length--;
+					inner->m_length++;
+				}
+				else if (right != nullptr && right->m_length > INNER_MIN_LENGTH)
+				{
+					parent->moveKeyTo(index, inner, inner->m_length);
+					inner->m_children[inner->m_length + 1] = right->m_children[0];
+					inner->m_length++;
+					right->moveKeyTo(0, parent, index);
+					for (size_t i = 1; i < right->m_length; i++)
+					{
+						right->moveKeyTo(i, right, i - 1);
+					}
+					for (size_t i = 0; i < right->m_length; i++)
+					{
+						right->m_children[i] = right->m_children[i + 1];
+					}
+					right->m_length--;
+				}
+				else
+				{
+					if (left == nullptr)
+					{
+						left = inner;
+						index++;
+					}
+					else
+					{
+						right = inner;
+					}
+					//The separator comes down between the keys of left and right.
+					parent->moveKeyTo(index - 1, left, left->m_length);
+					left->m_length++;
+					for (size_t i = 0; i < right->m_length; i++)
+					{
+						right->moveKeyTo(i, left, left->m_length + i);
+					}
+					for (size_t i = 0; i <= right->m_length; i++)
+					{
+						left->m_children[left->m_length + i] = right->m_children[i];
+					}
+					left->m_length += right->m_length;
+					right->m_length = 0;
+					delete right;
+					closeSeparatorGap(parent, index - 1);
+				}
+			}
+		}
+
+		//Removes the separator at index and the child to its right.
+		static void removeSeparator(Inner* parent, size_t index)
+		{
+			parent->key(index).~Key();
+			closeSeparatorGap(parent, index);
+		}
+
+		//Closes the gap of an already moved out separator at index and drops the child to its right.
+		static void closeSeparatorGap(Inner* parent, size_t index)
+		{
+			for (size_t i = index + 1; i < parent->m_length; i++)
+			{
+				parent->moveKeyTo(i, parent, i - 1);
+			}
+			for (size_t i = index + 1; i < parent->m_length; i++)
+			{
+				parent->m_children[i] = parent->m_children[i + 1];
+			}
+			parent->m_length--;
+		}
+
+		static bool isUnderfull(const Node* node)
+		{
+			return node->m_length < (node->m_isLeaf ? LEAF_MIN_LENGTH : INNER_MIN_LENGTH);
+		}
+
+		bool removeInternal(Node* node, const Key& key)
+		{
+			if (node->m_isLeaf)
+			{
+				Leaf* leaf = static_cast<Leaf*>(node);
+				const size_t index = lowerBoundIndex(leaf->m_keys, leaf->m_length, key);
+				if (index == leaf->m_length || key < leaf->key(index))
+				{
+					return false;
+				}
+				leaf->key(index).~Key();
+				leaf->value(index).~Value();
+				leaf->shiftLeft(index);
+				leaf->m_length--;
+				m_length--;
+				return true;
+			}
+
+			Inner* inner = static_cast<Inner*>(node);
+			const size_t index = upperBoundIndex(inner->m_keys, inner->m_length, key);
+			if (!removeInternal(inner->m_children[index], key))
+			{
+				return false;
+			}
+			if (isUnderfull(inner->m_children[index]))
+			{
+				fixUnderflow(inner, index);
+			}
+			return true;
+		}
+
+		//Removes all entries with from <= key < to below node. Children that only hold keys of the range
+		//are freed as a whole, the leaves at the edges of the range close their gap with a single shift.
+		//The nodes along the edges may be left underfull, refillRange takes care of them afterwards.
+		static size_t removeRangeInternal(Node* node, const Key& from, const Key& to)
+		{
+			if (node->m_isLeaf)
+			{
+				Leaf* leaf = static_cast<Leaf*>(node);
+				const size_t begin = lowerBoundIndex(leaf->m_keys, leaf->m_length, from);
+				const size_t end = lowerBoundIndex(leaf->m_keys, leaf->m_length, to);
+				if (begin >= end)
+				{
+					return 0;
+				}
+				for (size_t i = begin; i < end; i++)
+				{
+					leaf->key(i).~Key();
+					leaf->value(i).~Value();
+				}
+				for (size_t i = end; i < leaf->m_length; i++)
+				{
+					leaf->moveEntryTo(i, leaf, i - (end - begin));
+				}
+				leaf->m_length -= (uint32_t)(end - begin);
+				return end - begin;
+			}
+
+			Inner* inner = static_cast<Inner*>(node);
+			const size_t first = upperBoundIndex(inner->m_keys, inner->m_length, from);
+			const size_t last = lowerBoundIndex(inner->m_keys, inner->m_length, to);
+			size_t amount = 0;
+			if (last > first + 1)
+			{
+				for (size_t i = first + 1; i < last; i++)
+				{
+					amount += destroyNode(inner->m_children[i]);
+				}
+				Leaf* leftLeaf = edgeLeaf(inner->m_children[first], true);
+				Leaf* rightLeaf = edgeLeaf(inner->m_children[last], false);
+				leftLeaf->m_pnext = rightLeaf;
+				rightLeaf->m_pprev = leftLeaf;
+
+				//The separator at last - 1 stays and now divides first and last.
+				const size_t dropped = last - first - 1;
+				for (size_t i = first; i < last - 1; i++)
+				{
+					inner->key(i).~Key();
+				}
+				for (size_t i = last - 1; i < inner->m_length; i++)
+				{
+					inner->moveKeyTo(i, inner, i - dropped);
+				}
+				for (size_t i = last; i <= inner->m_length; i++)
+				{
+					inner->m_children[i - dropped] = inner->m_children[i];
+				}
+				inner->m_length -= (uint32_t)dropped;
+			}
+			amount += removeRangeInternal(inner->m_children[first], from, to);
+			if (last > first)
+			{
+				amount += removeRangeInternal(inner->m_children[first + 1], from, to);
+			}
+			return amount;
+		}
+
+		//Leftmost or rightmost leaf below node.
+		static Leaf* edgeLeaf(Node* node, bool rightmost)
+		{
+			while (!node->m_isLeaf)
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				node = inner->m_children[rightmost ? inner->m_length : 0];
+			}
+			return static_cast<Leaf*>(node);
+		}
+
+		//Refills the underfull nodes removeRangeInternal left below inner and returns whether it changed
+		//anything. Only children whose keys overlap the removed range can be underfull, merges and borrows
+		//keep them overlapping it.
+		static bool refillRange(Inner* inner, const Key& from, const Key& to)
+		{
+			//A child that is left with a single child can't refill that one itself. Fixing the child gives
+			//it siblings, so the passes repeat until nothing changes. Small nodes can need many of them.
+			bool changedAny = false;
+			bool changed = true;
+			while (changed)
+			{
+				changed = false;
+				const size_t first = upperBoundIndex(inner->m_keys, inner->m_length, from);
+				const size_t last = lowerBoundIndex(inner->m_keys, inner->m_length, to);
+				for (size_t i = first; i <= last; i++)
+				{
+					if (!inner->m_children[i]->m_isLeaf)
+					{
+						changed |= refillRange(static_cast<Inner*>(inner->m_children[i]), from, to);
+					}
+				}
+				for (size_t i = last + 1; i > first; i--)
+				{
+					if (i - 1 <= inner->m_length)
+					{
+						changed |= refillChild(inner, i - 1);
+					}
+				}
+				changedAny |= changed;
+			}
+			return changedAny;
+		}
+
+		//Calls fixUnderflow until the child at index is no longer underfull and returns whether it had to.
+		//A child removeRangeInternal emptied may need several borrows, or a merge with a sibling that is
+		//underfull as well.
+		static bool refillChild(Inner* parent, size_t index)
+		{
+			bool changed = false;
+			while (parent->m_length > 0 && isUnderfull(parent->m_children[index]))
+			{
+				const size_t lengthBefore = parent->m_length;
+				fixUnderflow(parent, index);
+				changed = true;
+				if (parent->m_length < lengthBefore && index > 0)
+				{
+					//Merged into its left sibling.
+					index--;
+				}
+			}
+			return changed;
+		}
+
+		//Frees node and everything below it and returns the amount of entries that were in there.
+		static size_t destroyNode(Node* node)
+		{
+			if (node->m_isLeaf)
+			{
+				const size_t amount = node->m_length;
+				delete static_cast<Leaf*>(node);
+				return amount;
+			}
+			else
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				size_t amount = 0;
+				for (size_t i = 0; i <= inner->m_length; i++)
+				{
+					amount += destroyNode(inner->m_children[i]);
+				}
+				delete inner;
+				return amount;
+			}
+		}
+
+		//Checks node below the root and everything below it, see isWellFormed.
+		static bool isWellFormedNode(const Node* node, bool isRoot, size_t depth, size_t& leafDepth)
+		{
+			const size_t minLength = isRoot ? (node->m_isLeaf ? 0 : 1) : (node->m_isLeaf ? LEAF_MIN_LENGTH : INNER_MIN_LENGTH);
+			const size_t capacity = node->m_isLeaf ? LEAF_CAPACITY : INNER_CAPACITY;
+			if (node->m_length < minLength || node->m_length > capacity)
+			{
+				return false;
+			}
+			if (node->m_isLeaf)
+			{
+				if (leafDepth == (size_t)-1)
+				{
+					leafDepth = depth;
+				}
+				return leafDepth == depth;
+			}
+			const Inner* inner = static_cast<const Inner*>(node);
+			for (size_t i = 0; i <= inner->m_length; i++)
+			{
+				if (!isWellFormedNode(inner->m_children[i], false, depth + 1, leafDepth))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	public:
+		SortedMap()
+		{
+			//do nothing
+		}
+
+		SortedMap(const SortedMap& other) //Copy Constructor
+		{
+			for (auto it = other.begin(); it != other.end(); ++it)
+			{
+				add(it.getKey(), it.getValue());
+			}
+		}
+
+		SortedMap(SortedMap&& other) noexcept //Move Constructor
+			: m_proot(other.m_proot), m_pfirstLeaf(other.m_pfirstLeaf), m_length(other.m_length)
+		{
+			other.m_proot = nullptr;
+			other.m_pfirstLeaf = nullptr;
+			other.m_length = 0;
+		}
+
+		SortedMap& operator=(const SortedMap& other) //Copy Assignment
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			for (auto it = other.begin(); it != other.end(); ++it)
+			{
+				add(it.getKey(), it.getValue());
+			}
+			return *this;
+		}
+
+		SortedMap& operator=(SortedMap&& other) noexcept //Move Assignment
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+			clear();
+			m_proot = other.m_proot;
+			m_pfirstLeaf = other.m_pfirstLeaf;
+			m_length = other.m_length;
+			other.m_proot = nullptr;
+			other.m_pfirstLeaf = nullptr;
+			other.m_length = 0;
+			return *this;
+		}
+
+		~SortedMap()
+		{
+			clear();
+		}
+
+		void add(const Key& key, const Value& value)
+		{
+			bool inserted;
+			emplaceInternal(key, inserted, value);
+			if (!inserted)
+			{
+				throw KeyAlreadyUsedException();
+			}
+		}
+
+		template <typename... arguments>
+		Value& emplace(const Key& key, arguments&&... args)
+		{
+			bool inserted;
+			Value& value = emplaceInternal(key, inserted, std::forward<arguments>(args)...);
+			if (!inserted)
+			{
+				throw KeyAlreadyUsedException();
+			}
+			return value;
+		}
+
+		template <typename... arguments>
+		Value& getOrEmplace(const Key& key, arguments&&... args)
+		{
+			bool inserted;
+			return emplaceInternal(key, inserted, std::forward<arguments>(args)...);
+		}
+
+		bool contains(const Key& key) const
+		{
+			return get(key) != nullptr;
+		}
+
+		Value* get(const Key& key)
+		{
+			if (m_proot == nullptr)
+			{
+				return nullptr;
+			}
+			Leaf* leaf = findLeaf(key);
+			const size_t index = lowerBoundIndex(leaf->m_keys, leaf->m_length, key);
+			if (index == leaf->m_length || key < leaf->key(index))
+			{
+				return nullptr;
+			}
+			return bbe::addressOf(leaf->value(index));
+		}
+
+		const Value* get(const Key& key) const
+		{
+			return const_cast<SortedMap*>(this)->get(key);
+		}
+
+		bool remove(const Key& key)
+		{
+			if (m_proot == nullptr || !removeInternal(m_proot, key))
+			{
+				return false;
+			}
+			if (!m_proot->m_isLeaf && m_proot->m_length == 0)
+			{
+				Inner* oldRoot = static_cast<Inner*>(m_proot);
+				m_proot = oldRoot->m_children[0];
+				delete oldRoot;
+			}
+			return true;
+		}
+
+		//Removes all entries with from <= key < to and returns how many there were.
+		//Erases whole leaves and subtrees at once and rebalances only along the edges of the range.
+		size_t removeRange(const Key& from, const Key& to)
+		{
+			if (m_proot == nullptr || !(from < to))
+			{
+				return 0;
+			}
+			const size_t amount = removeRangeInternal(m_proot, from, to);
+			while (!m_proot->m_isLeaf)
+			{
+				refillRange(static_cast<Inner*>(m_proot), from, to);
+				if (m_proot->m_length > 0)
+				{
+					break;
+				}
+				//A root with a single child goes away. That child could not be refilled by
+				//its parent, so the new root gets another round.
+				while (!m_proot->m_isLeaf && m_proot->m_length == 0)
+				{
+					Inner* oldRoot = static_cast<Inner*>(m_proot);
+					m_proot = oldRoot->m_children[0];
+					delete oldRoot;
+				}
+			}
+			m_length -= amount;
+			return amount;
+		}
+
+		void clear()
+		{
+			if (m_proot != nullptr)
+			{
+				destroyNode(m_proot);
+			}
+			m_proot = nullptr;
+			m_pfirstLeaf = nullptr;
+			m_length = 0;
+		}
+
+		//True if all leaves have the same depth and every node but the root is at least half full.
+		//Walks the whole tree, meant for tests.
+		bool isWellFormed() const
+		{
+			if (m_proot == nullptr)
+			{
+				return true;
+			}
+			size_t leafDepth = (size_t)-1;
+			return isWellFormedNode(m_proot, true, 0, leafDepth);
+		}
+
+		size_t getLength() const
+		{
+			return m_length;
+		}
+
+		bool isEmpty() const
+		{
+			return m_length == 0;
+		}
+
+		//First entry whose key is not less than key.
+		Iterator lowerBound(const Key& key)
+		{
+			if (m_proot == nullptr)
+			{
+				return end();
+			}
+			Leaf* leaf = findLeaf(key);
+			return Iterator(leaf, lowerBoundIndex(leaf->m_keys, leaf->m_length, key));
+		}
+
+		ConstIterator lowerBound(const Key& key) const
+		{
+			if (m_proot == nullptr)
+			{
+				return end();
+			}
+			Leaf* leaf = findLeaf(key);
+			return ConstIterator(leaf, lowerBoundIndex(leaf->m_keys, leaf->m_length, key));
+		}
+
+		//First entry whose key is greater than key.
+		Iterator upperBound(const Key& key)
+		{
+			if (m_proot == nullptr)
+			{
+				return end();
+			}
+			Leaf* leaf = findLeaf(key);
+			return Iterator(leaf, upperBoundIndex(leaf->m_keys, leaf->m_length, key));
+		}
+
+		ConstIterator upperBound(const Key& key) const
+		{
+			if (m_proot == nullptr)
+			{
+				return end();
+			}
+			Leaf* leaf = findLeaf(key);
+			return ConstIterator(leaf, upperBoundIndex(leaf->m_keys, leaf->m_length, key));
+		}
+
+		Iterator begin()
+		{
+			return Iterator(m_pfirstLeaf, 0);
+		}
+
+		Iterator end()
+		{
+			return Iterator(nullptr, 0);
+		}
+
+		ConstIterator begin() const
+		{
+			return ConstIterator(m_pfirstLeaf, 0);
+		}
+
+		ConstIterator end() const
+		{
+			return ConstIterator(nullptr, 0);
+		}
+	};
+}
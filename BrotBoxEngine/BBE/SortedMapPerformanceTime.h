@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../BBE/SortedMap.h"
+#include "../BBE/List.h"
+#include "../BBE/Random.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		void sortedMapPrintInsertionSpeed()
+		{
+			for (int amountOfKeys : { 10000, 100000 })
+			{
+				List<int> keys;
+				Random rand;
+				rand.setSeed(42);
+				for (int i = 0; i < amountOfKeys; i++)
+				{
+					keys.add(rand.randomInt(0x7FFFFFFF));
+				}
+
+				//Random order insertion followed by removal of every second key, like a free list under load.
+				List<int, true> list;
+				CPUWatch listWatch;
+				for (int key : keys)
+				{
+					list.add(key);
+				}
+				for (size_t i = 0; i < keys.getLength(); i += 2)
+				{
+					list.removeSingle(keys[i]);
+				}
+				const double listTime = listWatch.getTimeExpiredSeconds();
+
+				SortedMap<int, int> map;
+				CPUWatch mapWatch;
+				for (int key : keys)
+				{
+					map.getOrEmplace(key, key);
+				}
+				for (size_t i = 0; i < keys.getLength(); i += 2)
+				{
+					map.remove(keys[i]);
+				}
+				const double mapTime = mapWatch.getTimeExpiredSeconds();
+
+				std::cout << amountOfKeys << " keys: List<int, true> " << listTime << "s, SortedMap " << mapTime << "s" << std::endl;
+			}
+		}
+	}
+}
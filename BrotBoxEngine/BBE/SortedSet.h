@@ -0,0 +1,125 @@
+#pragma once
+
+#include "../BBE/SortedMap.h"
+#include "../BBE/EmptyClass.h"
+
+namespace bbe
+{
+	//Ordered set, a SortedMap without values.
+	template<typename Key>
+	class SortedSet
+	{
+	private:
+		typedef SortedMap<Key, Empty> Map;
+		Map m_map;
+
+	public:
+		class Iterator
+		{
+			friend class SortedSet<Key>;
+		private:
+			typename Map::ConstIterator m_it;
+
+			explicit Iterator(typename Map::ConstIterator it)
+				: m_it(it)
+			{
+				//do nothing
+			}
+
+		public:
+			const Key& operator*() const
+			{
+				return m_it.getKey();
+			}
+
+			const Key* operator->() const
+			{
+				return bbe::addressOf(m_it.getKey());
+			}
+
+			Iterator& operator++()
+			{
+				++m_it;
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator copy = *this;
+				++m_it;
+				return copy;
+			}
+
+			bool operator==(const Iterator& other) const
+			{
+				return m_it == other.m_it;
+			}
+
+			bool operator!=(const Iterator& other) const
+			{
+				return !operator==(other);
+			}
+		};
+
+		//Returns false if the key was already in the set.
+		bool add(const Key& key)
+		{
+			const size_t lengthBefore = m_map.getLength();
+			m_map.getOrEmplace(key);
+			return m_map.getLength() != lengthBefore;
+		}
+
+		bool contains(const Key& key) const
+		{
+			return m_map.contains(key);
+		}
+
+		bool remove(const Key& key)
+		{
+			return m_map.remove(key);
+		}
+
+		//Removes all keys with from <= key < to and returns how many there were.
+		size_t removeRange(const Key& from, const Key& to)
+		{
+			return m_map.removeRange(from, to);
+		}
+
+		void clear()
+		{
+			m_map.clear();
+		}
+
+		size_t getLength() const
+		{
+			return m_map.getLength();
+		}
+
+		bool isEmpty() const
+		{
+			return m_map.isEmpty();
+		}
+
+		//First key that is not less than key.
+		Iterator lowerBound(const Key& key) const
+		{
+			return Iterator(m_map.lowerBound(key));
+		}
+
+		//First key that is greater than key.
+		Iterator upperBound(const Key& key) const
+		{
+			return Iterator(m_map.upperBound(key));
+		}
+
+		Iterator begin() const
+		{
+			return Iterator(m_map.begin());
+		}
+
+		Iterator end() const
+		{
+			return Iterator(m_map.end());
+		}
+	};
+}
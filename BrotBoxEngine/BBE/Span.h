@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace bbe
+{
+	//Non owning view of contiguous elements, e.g. a column of an SoAList.
+	template <typename T>
+	class Span
+	{
+	private:
+		T* m_pdata = nullptr;
+		std::size_t m_length = 0;
+
+	public:
+		Span() = default;
+
+		Span(T* data, std::size_t length)
+			: m_pdata(data), m_length(length)
+		{
+			//do nothing
+		}
+
+		//Allows passing a Span<T> where a Span<const T> is expected.
+		template <typename U, typename = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>>
+		Span(const Span<U>& other)
+			: m_pdata(other.getRaw()), m_length(other.getLength())
+		{
+			//do nothing
+		}
+
+		T& operator[](std::size_t index) const
+		{
+			return m_pdata[index];
+		}
+
+		T* getRaw() const
+		{
+			return m_pdata;
+		}
+
+		std::size_t getLength() const
+		{
+			return m_length;
+		}
+
+		bool isEmpty() const
+		{
+			return m_length == 0;
+		}
+
+		T* begin() const
+		{
+			return m_pdata;
+		}
+
+		T* end() const
+		{
+			return m_pdata + m_length;
+		}
+	};
+}
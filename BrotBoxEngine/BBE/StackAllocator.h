@@ -8,6 +8,7 @@
 #include "../BBE/STLCapsule.h"
 #include "../BBE/Exceptions.h"
 #include "../BBE/Math.h"
+#include "../BBE/AllocatorTelemetry.h"
 
 namespace bbe
 {
@@ -78,6 +79,8 @@ namespace bbe
 		
 		List<INTERNAL::StackAllocatorDestructor> m_destructors;
 
+		AllocatorTelemetry m_telemetry{ "StackAllocator" };
+
 		template<typename U>
 		inline typename std::enable_if<std::is_trivially_destructible<U>::value>::type
 			addDestructorToList(U* object)
@@ -103,6 +106,7 @@ namespace bbe
 			}
 			m_data = m_parentAllocator->allocate(m_length);
 			m_head = m_data;
+			m_telemetry.setCapacityBytes(m_length * sizeof(T));
 		}
 
 		~StackAllocator()
@@ -138,6 +142,7 @@ namespace bbe
 			if (newHeadPointer <= m_data + m_length)
 			{
 				U* returnPointer = reinterpret_cast<U*>(allocationLocation);
+				m_telemetry.onAllocation((newHeadPointer - m_head) * sizeof(T));
 				m_head = newHeadPointer;
 				for (std::size_t i = 0; i < amountOfObjects; i++)
 				{
@@ -149,6 +154,7 @@ namespace bbe
 			}
 			else
 			{
+				m_telemetry.onFailedAllocation();
 				throw AllocatorOutOfMemoryException();
 			}
 		}
@@ -166,15 +172,43 @@ namespace bbe
 			T* newHeadPointer = allocationLocation + amountOfBytes;
 			if (newHeadPointer <= m_data + m_length)
 			{
+				m_telemetry.onAllocation((newHeadPointer - m_head) * sizeof(T));
 				m_head = newHeadPointer;
 				return allocationLocation;
 			}
 			else
 			{
+				m_telemetry.onFailedAllocation();
 				throw AllocatorOutOfMemoryException();
 			}
 		}
 
+		bool canAllocate(std::size_t amountOfBytes, std::size_t alignment = 1) const
+		{
+			const T* allocationLocation = (const T*)Math::nextMultiple(alignment, (std::size_t)m_head);
+			return allocationLocation + amountOfBytes <= m_data + m_length;
+		}
+
+		std::size_t getUsedBytes() const
+		{
+			return (m_head - m_data) * sizeof(T);
+		}
+
+		std::size_t getCapacity() const
+		{
+			return m_length * sizeof(T);
+		}
+
+		AllocatorTelemetry& getTelemetry()
+		{
+			return m_telemetry;
+		}
+
+		const AllocatorTelemetry& getTelemetry() const
+		{
+			return m_telemetry;
+		}
+
 		StackAllocatorMarker<T> getMarker()
 		{
 			return StackAllocatorMarker<T>(m_head, m_destructors.getLength());
@@ -182,6 +216,7 @@ namespace bbe
 		
 		void deallocateToMarker(StackAllocatorMarker<T> sam)
 		{
+			m_telemetry.onDeallocation((m_head - sam.m_markerValue) * sizeof(T));
 			m_head = sam.m_markerValue;
 			while (m_destructors.getLength() > sam.m_destructorHandle)
 			{
@@ -192,6 +227,7 @@ namespace bbe
 
 		void deallocateAll()
 		{
+			m_telemetry.onDeallocation(getUsedBytes());
 			m_head = m_data;
 			while (m_destructors.getLength() > 0)
 			{
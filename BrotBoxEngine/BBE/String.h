@@ -4,6 +4,7 @@
 #include <cwchar>
 #include <stdlib.h>
 #include <iostream>
+#include <atomic>
 #include "../BBE/NewDeleteAllocator.h"
 #include "../BBE/DynamicArray.h"
 #include "../BBE/Array.h"
@@ -15,6 +16,8 @@ namespace bbe
 {
 
 	std::size_t utf8len(const char* ptr);		//Length of a utf8 encoded string.
+	std::size_t utf8len(const char* ptr, std::size_t lengthBytes);	//Same, but for a buffer that is not null terminated. Counts 16 bytes at a time.
+	bool utf8IsValid(const char* ptr, std::size_t lengthBytes);	//Checks for truncated, overlong and out of range sequences as well as surrogates. Skips ASCII 16 bytes at a time.
 	std::size_t utf8charlen(const char* ptr);	//Length in byte of a single utf8 char.
 	bool utf8IsStartOfChar(const char* ptr);
 	const char* utf8GetStartAddrOfCodePoint(const char* ptr);
@@ -28,25 +31,109 @@ namespace bbe
 	int utf8Distance(const char* ptr1, const char* ptr2);
 
 	class Utf8String;
+	class Utf8StringSplitView;
 
+	//Non owning view of utf8 encoded bytes, e.g. a part of a Utf8String or of a file
+	//buffer. The bytes are not null terminated. The viewed memory must outlive the view.
 	class Utf8StringView
 	{
-		friend class Utf8String;
 	private:
-		const Utf8String* m_pstring = nullptr;
-		std::size_t m_start = 0;
-		std::size_t m_end = 0;
+		const char* m_pdata = nullptr;
+		std::size_t m_lengthBytes = 0;
 
+	public:
 		Utf8StringView();
-		Utf8StringView(const Utf8String& string, std::size_t m_start, std::size_t m_end);
+		/*nonexplicit*/ Utf8StringView(const char* data);
+		Utf8StringView(const char* data, std::size_t lengthBytes);
+		/*nonexplicit*/ Utf8StringView(const Utf8String& string);
+
+		bool operator==(const Utf8StringView& other) const;
+		bool operator!=(const Utf8StringView& other) const;
+
+		friend std::ostream& operator<<(std::ostream &os, const Utf8StringView &view);
+
+		Utf8StringView trimView() const;
+		Utf8StringSplitView splitView(const Utf8StringView& splitAt) const;
+
+		//Byte offset of the first occurrence of string at or after startByte, -1 if there is none.
+		int64_t searchBytes(const Utf8StringView& string, std::size_t startByte = 0) const;
+		bool startsWith(const Utf8StringView& string) const;
+
+		//base is 2 to 36, or 0 to pick it from the prefix like strtol does. Throws IllegalArgumentException otherwise.
+		long   toLong  (int base = 10) const;
+		double toDouble() const;
+		float  toFloat () const;
+
+		const char* getRaw() const;		//Not null terminated!
+		std::size_t getLength     () const;
+		std::size_t getLengthBytes() const;
+		bool isEmpty() const;
+	};
+
+	//Lazy result of splitView. Iterating it yields the same tokens as Utf8String::split,
+	//including empty ones, without copying anything.
+	class Utf8StringSplitView
+	{
+	private:
+		Utf8StringView m_string;
+		Utf8StringView m_splitAt;
+
+	public:
+		class Iterator
+		{
+			friend class Utf8StringSplitView;
+		private:
+			const char* m_ptokenStart = nullptr;	//nullptr once the iterator reached the end.
+			const char* m_ptokenEnd = nullptr;
+			const char* m_pend = nullptr;
+			Utf8StringView m_splitAt;
+
+			Iterator(const Utf8StringView& string, const Utf8StringView& splitAt);
+			Iterator();
+
+			void findTokenEnd();
+
+		public:
+			Utf8StringView operator*() const;
+			Iterator& operator++();
+			bool operator==(const Iterator& other) const;
+			bool operator!=(const Iterator& other) const;
+		};
+
+		Utf8StringSplitView(const Utf8StringView& string, const Utf8StringView& splitAt);
+
+		Iterator begin() const;
+		Iterator end() const;
+	};
+
+	//Pulls tokens one by one out of a string. Tokens are separated by runs of
+	//whitespace, or of any of the given delimiter chars, so there are no empty tokens.
+	//
+	//  Utf8StringTokenizer tokenizer(line);
+	//  Utf8StringView token;
+	//  while (tokenizer.next(token)) { ... }
+	class Utf8StringTokenizer
+	{
+	private:
+		const char* m_pcurrent;
+		const char* m_pend;
+		Utf8StringView m_delimiters;
+
+		bool isDelimiter(const char* ptr, std::size_t charLength, bool isComplete) const;
+
+	public:
+		explicit Utf8StringTokenizer(const Utf8StringView& string);
+		Utf8StringTokenizer(const Utf8StringView& string, const Utf8StringView& delimiters);
 
-		std::size_t getEnd() const;
+		bool next(Utf8StringView& outToken);
+		Utf8StringView getRemaining() const;
 	};
 
 	class Utf8String
 	{
 	private:
 		static constexpr size_t BBE_UTF8STRING_SSOSIZE = 16;
+		static constexpr size_t BBE_UTF8STRING_BREADCRUMB_DISTANCE = 64;
 
 		union
 		{
@@ -54,11 +141,22 @@ namespace bbe
 			char  m_ssoData[BBE_UTF8STRING_SSOSIZE];
 		} m_UNION;
 		bool        m_usesSSO  = true;
+		bool        m_isAscii  = true;	//Every code point is a single byte, so code point indices are byte offsets.
 		std::size_t m_length   = 0;
 		std::size_t m_capacity = 0;
 
+		//Byte offset of every BBE_UTF8STRING_BREADCRUMB_DISTANCE-th code point, so that indexing
+		//a non ASCII string walks at most that many code points. nullptr until the first lookup
+		//that needs it, which publishes it atomically, so const methods stay safe to call from
+		//several threads. Every mutation (including calls to the non const getRaw) frees it.
+		mutable std::atomic<std::size_t*> m_pbreadcrumbs{ nullptr };
+
 		void growIfNeeded(std::size_t newSize);
 		void initializeFromCharArr(const char *data);
+		void onContentChanged(std::size_t lengthBytes);
+		void dropBreadcrumbs();
+		const std::size_t* getBreadcrumbs() const;
+		std::size_t getByteOffsetOfCodePoint(std::size_t index) const;	//index may be getLength(), which is the end of the string.
 
 	public:
 		Utf8String();
@@ -74,6 +172,8 @@ namespace bbe
 		explicit Utf8String(long               number);
 		explicit Utf8String(unsigned int       number);
 
+		explicit Utf8String(const Utf8StringView& view);
+
 		Utf8String(const Utf8String&  other);//Copy Constructor
 		Utf8String(Utf8String&& other);      //Move Constructor
 
@@ -130,6 +230,7 @@ namespace bbe
 
 		bbe::Utf8String trim       () const;
 		void            trimInPlace();
+		bbe::Utf8StringView trimView() const;
 
 		bbe::Utf8String substring       (std::size_t start, std::size_t end = -1) const;
 		void            substringInPlace(std::size_t start, std::size_t end = -1);
@@ -140,6 +241,7 @@ namespace bbe
 
 		DynamicArray<Utf8String> split(const Utf8String& splitAt) const;
 		DynamicArray<Utf8String> split(const char*       splitAt) const;
+		Utf8StringSplitView splitView(const Utf8StringView& splitAt) const;
 
 		bool contains(const char*       string) const;
 		bool contains(const Utf8String& string) const;
@@ -167,12 +269,15 @@ namespace bbe
 		size_t getLength     () const;
 		size_t getLengthBytes() const;
 		size_t getCapacity   () const;
+		bool   isAscii       () const;
 
 		Utf8String leftFill(char c, size_t length);
 	};
 
 	typedef Utf8String String;
 
+	template<>
+	uint32_t hash(const Utf8StringView &t);
 	template<>
 	uint32_t hash(const String &t);
 }
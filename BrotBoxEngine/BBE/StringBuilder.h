@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../BBE/String.h"
+#include <cstddef>
+
+namespace bbe
+{
+	//Growable, reusable char buffer for building strings piece by piece. Numbers are
+	//formatted with std::to_chars on the stack and copied in, so once the capacity is
+	//big enough (see reserve) appending and formatting never allocate. Clearing keeps
+	//the capacity, which makes a long lived builder ideal for per frame text.
+	//
+	//  builder.clear();
+	//  builder.appendFormat("FPS: {} ({}ms)", fps, frameTime);
+	//  drawText(builder.getRaw());
+	class StringBuilder
+	{
+	private:
+		static constexpr std::size_t STRING_BUILDER_MIN_CAPACITY = 64;
+
+		char*       m_pdata = nullptr;
+		std::size_t m_lengthBytes = 0;
+		std::size_t m_capacity = 0;
+
+		void growIfNeeded(std::size_t additionalBytes);
+
+		template <typename T>
+		StringBuilder& appendInteger(T number);
+
+		template <typename T>
+		StringBuilder& appendFloatingPoint(T number, int precision);
+
+		//Appends fmt up to the next {} and returns a pointer behind it, or nullptr if there is none.
+		const char* appendUntilPlaceholder(const char* fmt);
+
+		void appendFormatInternal(const char* fmt)
+		{
+			while ((fmt = appendUntilPlaceholder(fmt)) != nullptr)
+			{
+				append("{}");
+			}
+		}
+
+		template <typename Arg, typename... Args>
+		void appendFormatInternal(const char* fmt, const Arg& arg, const Args&... args)
+		{
+			fmt = appendUntilPlaceholder(fmt);
+			if (fmt != nullptr)
+			{
+				append(arg);
+				appendFormatInternal(fmt, args...);
+			}
+		}
+
+	public:
+		StringBuilder();
+		explicit StringBuilder(std::size_t capacityBytes);
+
+		StringBuilder(const StringBuilder&  other); //Copy Constructor
+		StringBuilder(StringBuilder&& other);       //Move Constructor
+		StringBuilder& operator=(const StringBuilder&  other); //Copy Assignment
+		StringBuilder& operator=(StringBuilder&& other);       //Move Assignment
+
+		~StringBuilder();
+
+		StringBuilder& append(const char* string);
+		StringBuilder& append(const Utf8StringView& string);
+		StringBuilder& append(const Utf8String& string);
+		StringBuilder& append(char c);
+		StringBuilder& append(bool value);
+		StringBuilder& append(int                number);
+		StringBuilder& append(unsigned int       number);
+		StringBuilder& append(long               number);
+		StringBuilder& append(unsigned long      number);
+		StringBuilder& append(long long          number);
+		StringBuilder& append(unsigned long long number);
+		StringBuilder& append(float              number);	//Shortest representation that reads back to the same value.
+		StringBuilder& append(double             number);
+		StringBuilder& appendFixed(float  number, int decimals);	//Always fixed notation, even for 1e300.
+		StringBuilder& appendFixed(double number, int decimals);
+
+		//Appends fmt with every {} replaced by the next argument, e.g.
+		//appendFormat("img{}.png", frameNumber). Placeholders without an argument stay as they are.
+		template <typename... Args>
+		StringBuilder& appendFormat(const char* fmt, const Args&... args)
+		{
+			appendFormatInternal(fmt, args...);
+			return *this;
+		}
+
+		//Like appendFormat, but replaces the current content.
+		template <typename... Args>
+		StringBuilder& format(const char* fmt, const Args&... args)
+		{
+			clear();
+			return appendFormat(fmt, args...);
+		}
+
+		void clear();
+		void reserve(std::size_t capacityBytes);
+
+		const char*    getRaw() const;	//Always null terminated.
+		Utf8StringView getView() const;
+		Utf8String     toString() const;
+
+		std::size_t getLengthBytes() const;
+		std::size_t getCapacity() const;
+		bool isEmpty() const;
+	};
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "../BBE/String.h"
+#include "../BBE/Hash.h"
+#include <cstddef>
+#include <stdint.h>
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		//FNV-1a, simple enough to be evaluated at compile time. Only used to look strings up in the intern table.
+		constexpr uint64_t stringIdHash(const char* data, std::size_t lengthBytes)
+		{
+			uint64_t _hash = 0xcbf29ce484222325ull;
+			for (std::size_t i = 0; i < lengthBytes; i++)
+			{
+				_hash ^= static_cast<unsigned char>(data[i]);
+				_hash *= 0x100000001b3ull;
+			}
+			return _hash;
+		}
+	}
+
+	//A string literal together with its intern table hash. Declared constexpr,
+	//the hash is computed by the compiler, so turning it into a StringId only
+	//costs a table lookup and a single string comparison.
+	//
+	//  static constexpr StringIdLiteral PLAYER_TEXTURE("textures/player.png");
+	//  StringId id(PLAYER_TEXTURE);
+	class StringIdLiteral
+	{
+	private:
+		const char* m_pdata;
+		std::size_t m_lengthBytes;
+		uint64_t    m_hash;
+
+	public:
+		template<std::size_t N>
+		constexpr StringIdLiteral(const char (&literal)[N])
+			: m_pdata(literal), m_lengthBytes(N - 1), m_hash(INTERNAL::stringIdHash(literal, N - 1))
+		{
+			//do nothing
+		}
+
+		constexpr const char* getRaw() const
+		{
+			return m_pdata;
+		}
+
+		constexpr std::size_t getLengthBytes() const
+		{
+			return m_lengthBytes;
+		}
+
+		constexpr uint64_t getHash() const
+		{
+			return m_hash;
+		}
+	};
+
+	//A string stored once in a global, thread safe intern table and referred to
+	//by a 32 bit index. Equal strings always get the same id, so comparing and
+	//hashing StringIds never touches the text. Ids are handed out in the order
+	//the strings are first seen, so operator< is not alphabetical. Interned
+	//strings live until the program ends.
+	class StringId
+	{
+	private:
+		uint32_t m_id = 0;	//0 is the empty string.
+
+		static uint32_t intern(const char* data, std::size_t lengthBytes, uint64_t _hash);
+
+	public:
+		StringId() = default;
+		StringId(const char* string);
+		StringId(const Utf8StringView& string);
+		StringId(const Utf8String& string);
+		StringId(const StringIdLiteral& literal);
+
+		bool operator==(const StringId& other) const
+		{
+			return m_id == other.m_id;
+		}
+
+		bool operator!=(const StringId& other) const
+		{
+			return m_id != other.m_id;
+		}
+
+		bool operator<(const StringId& other) const
+		{
+			return m_id < other.m_id;
+		}
+
+		uint32_t getId() const
+		{
+			return m_id;
+		}
+
+		bool isEmpty() const
+		{
+			return m_id == 0;
+		}
+
+		//The interned text. Null terminated, stays valid for the rest of the program.
+		const char*    getRaw() const;
+		Utf8StringView getView() const;
+		Utf8String     toString() const;
+
+		//Amount of distinct strings in the table, including the empty string.
+		static std::size_t getAmountOfInternedStrings();
+	};
+
+	std::ostream& operator<<(std::ostream& os, const StringId& id);
+
+	template<>
+	inline uint32_t hash(const StringId& t)
+	{
+		return hash(t.getId());
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../BBE/StringId.h"
+#include "../BBE/String.h"
+#include "../BBE/HashMap.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		void stringIdPrintLookupSpeed()
+		{
+			//Asset lookups by path, as done every frame by a resource cache.
+			constexpr int AMOUNT_OF_ASSETS = 1000;
+			constexpr int AMOUNT_OF_LOOKUPS = 1000000;
+			List<bbe::String> paths;
+			List<StringId> ids;
+			HashMap<bbe::String, int> stringMap;
+			HashMap<StringId, int> idMap;
+			for (int i = 0; i < AMOUNT_OF_ASSETS; i++)
+			{
+				paths.add(bbe::String("assets/textures/environment/terrain/variant_") + i + ".png");
+				ids.add(StringId(paths.last()));
+				stringMap.add(paths.last(), i);
+				idMap.add(ids.last(), i);
+			}
+
+			int64_t sink = 0;
+			CPUWatch stringWatch;
+			for (int i = 0; i < AMOUNT_OF_LOOKUPS; i++)
+			{
+				sink += *stringMap.get(paths[(i * 7) % AMOUNT_OF_ASSETS]);
+			}
+			const double stringTime = stringWatch.getTimeExpiredSeconds();
+
+			CPUWatch idWatch;
+			for (int i = 0; i < AMOUNT_OF_LOOKUPS; i++)
+			{
+				sink += *idMap.get(ids[(i * 7) % AMOUNT_OF_ASSETS]);
+			}
+			const double idTime = idWatch.getTimeExpiredSeconds();
+
+			CPUWatch internWatch;
+			for (int i = 0; i < AMOUNT_OF_LOOKUPS; i++)
+			{
+				sink += StringId(paths[(i * 7) % AMOUNT_OF_ASSETS]).getId();
+			}
+			const double internTime = internWatch.getTimeExpiredSeconds();
+
+			std::cout << AMOUNT_OF_LOOKUPS << " lookups: HashMap<String> " << stringTime << "s, HashMap<StringId> " << idTime << "s, interning again " << internTime << "s (" << sink << ")" << std::endl;
+		}
+	}
+}
@@ -5,6 +5,7 @@
 #include "../BBE/UtilTest.h"
 #include "../BBE/CPUWatch.h"
 #include "../BBE/String.h"
+#include "../BBE/StringBuilder.h"
 #include <string>
 #include <vector>
 
@@ -19,8 +20,8 @@ namespace bbe {
 			int numRuns = 0;
 			while (true) {
 				CPUWatch allocationWatch;
-				bbe::String a(L"Hallo ");
-				bbe::String b(L"Welt");
+				bbe::String a("Hallo ");
+				bbe::String b("Welt");
 				for (int i = 0; i < 10000000; i++) {
 					a += b;
 				}
@@ -53,5 +54,113 @@ namespace bbe {
 			}
 
 		}
+
+		void stringSpeedSplit() {
+			bbe::String file;
+			for (int i = 0; i < 100000; i++) {
+				file += "someKey=";
+				file += i;
+				file += ".5\n";
+			}
+
+			CPUWatch splitWatch;
+			double splitSum = 0;
+			auto lines = file.split("\n");
+			for (size_t i = 0; i < lines.getLength(); i++) {
+				auto keyValue = lines[i].split("=");
+				if (keyValue.getLength() == 2) {
+					splitSum += keyValue[1].toDouble();
+				}
+			}
+			const double splitTime = splitWatch.getTimeExpiredSeconds();
+
+			CPUWatch splitViewWatch;
+			double splitViewSum = 0;
+			for (bbe::Utf8StringView line : file.splitView("\n")) {
+				const int64_t separator = line.searchBytes("=");
+				if (separator != -1) {
+					splitViewSum += bbe::Utf8StringView(line.getRaw() + separator + 1, line.getLengthBytes() - separator - 1).toDouble();
+				}
+			}
+			const double splitViewTime = splitViewWatch.getTimeExpiredSeconds();
+
+			std::cout << "split: " << splitTime << "s (" << splitSum << ")" << std::endl;
+			std::cout << "splitView: " << splitViewTime << "s (" << splitViewSum << ")" << std::endl;
+		}
+
+		void stringSpeedFileName() {
+			const char* path = "screenshots/img";
+			constexpr uint64_t frames = 1000000;
+
+			CPUWatch stringWatch;
+			size_t stringBytes = 0;
+			for (uint64_t frame = 0; frame < frames; frame++) {
+				stringBytes += (bbe::String(path) + frame + ".png").getLengthBytes();
+			}
+			const double stringTime = stringWatch.getTimeExpiredSeconds();
+
+			CPUWatch builderWatch;
+			size_t builderBytes = 0;
+			bbe::StringBuilder builder;
+			for (uint64_t frame = 0; frame < frames; frame++) {
+				builderBytes += builder.format("{}{}.png", path, frame).getLengthBytes();
+			}
+			const double builderTime = builderWatch.getTimeExpiredSeconds();
+
+			std::cout << "String operator+: " << stringTime << "s (" << stringBytes << ")" << std::endl;
+			std::cout << "StringBuilder: " << builderTime << "s (" << builderBytes << ")" << std::endl;
+		}
+
+		void stringSpeedIndexing() {
+			bbe::String text;
+			for (int i = 0; i < 2000; i++) {
+				text += u8"Gr\u00FC\u00DFe ";
+			}
+
+			//Walking from the start for every code point, like operator[] did before the breadcrumbs.
+			CPUWatch walkWatch;
+			size_t walkSum = 0;
+			for (size_t i = 0; i < text.getLength(); i++) {
+				const char* ptr = text.getRaw();
+				for (size_t k = 0; k < i; k++) {
+					ptr = bbe::utf8GetNextChar(ptr);
+				}
+				walkSum += static_cast<unsigned char>(*ptr);
+			}
+			const double walkTime = walkWatch.getTimeExpiredSeconds();
+
+			CPUWatch indexWatch;
+			size_t indexSum = 0;
+			for (size_t i = 0; i < text.getLength(); i++) {
+				indexSum += static_cast<unsigned char>(text[i]);
+			}
+			const double indexTime = indexWatch.getTimeExpiredSeconds();
+
+			CPUWatch lengthWatch;
+			size_t lengthSum = 0;
+			for (int i = 0; i < 10000; i++) {
+				lengthSum += bbe::utf8len(text.getRaw() + (i & 7), text.getLengthBytes() - 8);
+			}
+			const double lengthTime = lengthWatch.getTimeExpiredSeconds();
+
+			//One byte at a time, like utf8len did before it counted blocks of bytes.
+			CPUWatch lengthBytewiseWatch;
+			size_t lengthBytewiseSum = 0;
+			for (int i = 0; i < 10000; i++) {
+				const char* ptr = text.getRaw() + (i & 7);
+				const size_t lengthBytes = text.getLengthBytes() - 8;
+				for (size_t k = 0; k < lengthBytes; k++) {
+					if ((ptr[k] & 0xC0) != 0x80) {
+						lengthBytewiseSum++;
+					}
+				}
+			}
+			const double lengthBytewiseTime = lengthBytewiseWatch.getTimeExpiredSeconds();
+
+			std::cout << "walking from the start: " << walkTime << "s (" << walkSum << ")" << std::endl;
+			std::cout << "operator[]: " << indexTime << "s (" << indexSum << ")" << std::endl;
+			std::cout << "10000 utf8len of " << text.getLengthBytes() << " bytes: " << lengthTime << "s (" << lengthSum << ")" << std::endl;
+			std::cout << "10000 bytewise counts of " << text.getLengthBytes() << " bytes: " << lengthBytewiseTime << "s (" << lengthBytewiseSum << ")" << std::endl;
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../BBE/Math.h"
+#include "../BBE/VectorBatch.h"
+#include "../BBE/Simd.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <cmath>
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		//The lookup table that Math::sin used to be, 64k doubles per function filled on startup.
+		class TrigLookupTable
+		{
+		private:
+			static constexpr std::size_t TABLE_SIZE = 1024 * 64;
+			List<double> m_sinTable;
+
+		public:
+			TrigLookupTable()
+			{
+				m_sinTable.resizeCapacityAndLength(TABLE_SIZE);
+				for (std::size_t i = 0; i < TABLE_SIZE; i++)
+				{
+					m_sinTable[i] = std::sin((double)i / TABLE_SIZE * Math::TAU);
+				}
+			}
+
+			float sin(double val) const
+			{
+				val = Math::mod(val, Math::TAU);
+				return (float)m_sinTable[(std::size_t)(val / Math::TAU * TABLE_SIZE)];
+			}
+		};
+
+		void trigPrintSpeedAndAccuracy()
+		{
+			constexpr size_t AMOUNT_OF_VALUES = 100000;
+			constexpr int ITERATIONS = 200;
+
+			const TrigLookupTable table;
+			List<float> values;
+			for (size_t i = 0; i < AMOUNT_OF_VALUES; i++)
+			{
+				//Covers [-100, 100] with values that are not multiples of the table step.
+				values.add((float)i * (200.f / AMOUNT_OF_VALUES) - 100.f + 0.000123f);
+			}
+			List<float> out = values;
+			const Span<const float> span(values.getRaw(), values.getLength());
+
+			std::cout << AMOUNT_OF_VALUES << " values in [-100, 100], " << ITERATIONS << " iterations" << std::endl;
+			{
+				double tableError = 0;
+				double polynomialError = 0;
+				for (size_t i = 0; i < values.getLength(); i++)
+				{
+					const double expected = std::sin((double)values[i]);
+					tableError = Math::max(tableError, Math::abs(table.sin(values[i]) - expected));
+					polynomialError = Math::max(polynomialError, Math::abs(Math::sin(values[i]) - expected));
+				}
+				std::cout << "    Max error of sin, table: " << tableError << ", polynomial: " << polynomialError << std::endl;
+			}
+
+			float sink = 0;
+			CPUWatch tableWatch;
+			for (int k = 0; k < ITERATIONS; k++)
+			{
+				for (size_t i = 0; i < values.getLength(); i++)
+				{
+					out[i] = table.sin(values[i]);
+				}
+				sink += out[k];
+			}
+			std::cout << "    table:           " << tableWatch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+
+			CPUWatch stdWatch;
+			for (int k = 0; k < ITERATIONS; k++)
+			{
+				for (size_t i = 0; i < values.getLength(); i++)
+				{
+					out[i] = std::sin(values[i]);
+				}
+				sink += out[k];
+			}
+			std::cout << "    std::sin(float): " << stdWatch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+
+			CPUWatch polynomialWatch;
+			for (int k = 0; k < ITERATIONS; k++)
+			{
+				for (size_t i = 0; i < values.getLength(); i++)
+				{
+					out[i] = Math::sin(values[i]);
+				}
+				sink += out[k];
+			}
+			std::cout << "    Math::sin:       " << polynomialWatch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+
+			const SimdLevel supported = getSimdLevel();
+			for (SimdLevel level : { SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				if (level > supported) continue;
+				setSimdLevel(level);
+				const char* name = level == SimdLevel::SCALAR ? "scalar" : (level == SimdLevel::SSE2 ? "SSE2  " : "AVX2  ");
+
+				CPUWatch batchWatch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					Math::sin(span, Span<float>(out.getRaw(), out.getLength()));
+					sink += out[k];
+				}
+				std::cout << "    batch " << name << ":    " << batchWatch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+			}
+			setSimdLevel(supported);
+		}
+	}
+}
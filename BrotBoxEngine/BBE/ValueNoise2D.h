@@ -2,13 +2,14 @@
 
 #include "../BBE/List.h"
 #include "../BBE/DynamicArray.h"
+#include "../BBE/Grid2D.h"
 
 namespace bbe
 {
 	class ValueNoise2D
 	{
 	private:
-		float *m_pdata      = nullptr;
+		Grid2D<float> m_precalculated;
 		int    m_width      = 0;
 		int    m_height     = 0;
 		bool   m_wasCreated = false;
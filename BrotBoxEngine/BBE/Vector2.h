@@ -2,6 +2,7 @@
 
 #include "BBE/Math.h"
 #include "BBE/Exceptions.h"
+#include "BBE/Hash.h"
 
 namespace bbe
 {
@@ -355,5 +356,18 @@ namespace bbe
 		}
 	};
 
-	using Vector2 = Vector2_t<float>;
+	using Vector2  = Vector2_t<float>;
+	using Vector2i = Vector2_t<int32_t>;
+
+	template<>
+	inline uint32_t hash(const Vector2 &t)
+	{
+		return hashCombine(hash(t.x), hash(t.y));
+	}
+
+	template<>
+	inline uint32_t hash(const Vector2i &t)
+	{
+		return hashCombine(hash(t.x), hash(t.y));
+	}
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../BBE/Hash.h"
 
 namespace bbe
 {
@@ -117,4 +118,7 @@ namespace bbe
 		Vector3 zzy() const;
 		Vector3 zzz() const;
 	};
+
+	template<>
+	uint32_t hash(const Vector3 &t);
 }
\ No newline at end of file
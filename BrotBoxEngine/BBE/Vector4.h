@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../BBE/Simd.h"
 
 namespace bbe
 {
@@ -7,7 +8,9 @@ namespace bbe
 	using Vector2 = Vector2_t<float>;
 	class Vector3;
 
-	class Vector4
+	//16 byte aligned so that the arithmetic below can load and store a whole Vector4 with one
+	//aligned SSE instruction. The size stays 4 floats, arrays of Vector4 are still tightly packed.
+	class alignas(16) Vector4
 	{
 	public:
 		float x;
@@ -384,4 +387,141 @@ namespace bbe
 		Vector4 wwww() const;
 
 	};
+
+	namespace INTERNAL
+	{
+#ifdef BBE_USE_SSE2
+		inline __m128 loadVector4(const Vector4& vec)
+		{
+			return _mm_load_ps(&vec.x);
+		}
+
+		inline Vector4 storeVector4(__m128 value)
+		{
+			Vector4 retVal;
+			_mm_store_ps(&retVal.x, value);
+			return retVal;
+		}
+#endif
+	}
+
+	//The constructors and the arithmetic are inline, they are on the hot path of every transformation.
+	//The SSE and the scalar versions perform the same IEEE operations per component, so both give bit identical results.
+	inline Vector4::Vector4()
+		: x(0), y(0), z(0), w(0)
+	{
+	}
+
+	inline Vector4::Vector4(float xyzw)
+		: x(xyzw), y(xyzw), z(xyzw), w(xyzw)
+	{
+	}
+
+	inline Vector4::Vector4(float xyz, float w)
+		: x(xyz), y(xyz), z(xyz), w(w)
+	{
+	}
+
+	inline Vector4::Vector4(float x, float y, float z, float w)
+		: x(x), y(y), z(z), w(w)
+	{
+	}
+
+	inline Vector4& Vector4::operator+=(const Vector4& other)
+	{
+#ifdef BBE_USE_SSE2
+		_mm_store_ps(&x, _mm_add_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		this->x += other.x;
+		this->y += other.y;
+		this->z += other.z;
+		this->w += other.w;
+#endif
+		return *this;
+	}
+
+	inline Vector4& Vector4::operator-=(const Vector4& other)
+	{
+#ifdef BBE_USE_SSE2
+		_mm_store_ps(&x, _mm_sub_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		this->x -= other.x;
+		this->y -= other.y;
+		this->z -= other.z;
+		this->w -= other.w;
+#endif
+		return *this;
+	}
+
+	inline Vector4& Vector4::operator*=(const Vector4& other)
+	{
+#ifdef BBE_USE_SSE2
+		_mm_store_ps(&x, _mm_mul_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		this->x *= other.x;
+		this->y *= other.y;
+		this->z *= other.z;
+		this->w *= other.w;
+#endif
+		return *this;
+	}
+
+	inline Vector4& Vector4::operator/=(const Vector4& other)
+	{
+#ifdef BBE_USE_SSE2
+		_mm_store_ps(&x, _mm_div_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		this->x /= other.x;
+		this->y /= other.y;
+		this->z /= other.z;
+		this->w /= other.w;
+#endif
+		return *this;
+	}
+
+	inline Vector4 Vector4::operator+(const Vector4& other) const
+	{
+#ifdef BBE_USE_SSE2
+		return INTERNAL::storeVector4(_mm_add_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
+#endif
+	}
+
+	inline Vector4 Vector4::operator-(const Vector4& other) const
+	{
+#ifdef BBE_USE_SSE2
+		return INTERNAL::storeVector4(_mm_sub_ps(INTERNAL::loadVector4(*this), INTERNAL::loadVector4(other)));
+#else
+		return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
+#endif
+	}
+
+	inline Vector4 Vector4::operator-() const
+	{
+#ifdef BBE_USE_SSE2
+		//Flipping the sign bit is exactly what the scalar negation does, including for 0 and NaN.
+		return INTERNAL::storeVector4(_mm_xor_ps(INTERNAL::loadVector4(*this), _mm_set1_ps(-0.0f)));
+#else
+		return Vector4(-x, -y, -z, -w);
+#endif
+	}
+
+	inline Vector4 Vector4::operator*(float scalar) const
+	{
+#ifdef BBE_USE_SSE2
+		return INTERNAL::storeVector4(_mm_mul_ps(INTERNAL::loadVector4(*this), _mm_set1_ps(scalar)));
+#else
+		return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
+#endif
+	}
+
+	inline Vector4 Vector4::operator/(float scalar) const
+	{
+#ifdef BBE_USE_SSE2
+		return INTERNAL::storeVector4(_mm_div_ps(INTERNAL::loadVector4(*this), _mm_set1_ps(scalar)));
+#else
+		return Vector4(x / scalar, y / scalar, z / scalar, w / scalar);
+#endif
+	}
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../BBE/Vector2.h"
+#include "../BBE/Vector3.h"
+#include "../BBE/Matrix4.h"
+#include "../BBE/Span.h"
+#include "../BBE/List.h"
+
+namespace bbe
+{
+	namespace Math
+	{
+		//Batch kernels that process whole arrays of vectors per call, e.g. all vertices of a shape in
+		//a collision test. They use SSE2 or AVX2, picked at runtime (see getSimdLevel), and compute
+		//every element with the same operations as the matching scalar operator, so the results are
+		//bit identical to a plain loop. The output span must be at least as long as the input span
+		//and may be the input itself.
+
+		struct ProjectionRange
+		{
+			float min;
+			float max;
+		};
+
+		//out[i] = vectors[i] * other
+		void dot(Span<const Vector2> vectors, const Vector2& other, Span<float> out);
+		void dot(Span<const Vector3> vectors, const Vector3& other, Span<float> out);
+
+		//The smallest and biggest dot product of the points with axis. For normalized axes that is
+		//the shadow of the points on the axis, as needed for separating axis tests. Throws if points is empty.
+		//A NaN dot product is skipped, unless it belongs to the first point, then min and max are NaN.
+		ProjectionRange projectRange(Span<const Vector2> points, const Vector2& axis);
+		ProjectionRange projectRange(Span<const Vector3> points, const Vector3& axis);
+
+		//out[i] = points[i].project(projection)
+		void project(Span<const Vector2> points, const Vector2& projection, Span<Vector2> out);
+		void project(Span<const Vector3> points, const Vector3& projection, Span<Vector3> out);
+		bbe::List<Vector2> project(const bbe::List<Vector2>& points, const Vector2& projection);
+		bbe::List<Vector3> project(const bbe::List<Vector3>& points, const Vector3& projection);
+
+		//out[i] = matrix * points[i], including the division by w. Vector2s are treated as (x, y, 0, 1).
+		void transformPoints(const Matrix4& matrix, Span<const Vector2> points, Span<Vector2> out);
+		void transformPoints(const Matrix4& matrix, Span<const Vector3> points, Span<Vector3> out);
+
+		//out[i] = sin(values[i]) and cos(values[i]), 4 (SSE2) or 8 (AVX2) values at a time. The
+		//results are bit identical to the scalar sin and cos in Math.h, so the same error bounds apply.
+		void sin(Span<const float> values, Span<float> out);
+		void cos(Span<const float> values, Span<float> out);
+		void sincos(Span<const float> values, Span<float> outSin, Span<float> outCos);
+	}
+}
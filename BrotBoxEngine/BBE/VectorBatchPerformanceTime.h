@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../BBE/VectorBatch.h"
+#include "../BBE/Simd.h"
+#include "../BBE/List.h"
+#include "../BBE/CPUWatch.h"
+#include <iostream>
+
+namespace bbe {
+	namespace test {
+		void vectorBatchPrintSpeed()
+		{
+			constexpr size_t AMOUNT_OF_POINTS = 10000;
+			constexpr int ITERATIONS = 1000;
+
+			List<Vector2> points2;
+			List<Vector3> points3;
+			for (size_t i = 0; i < AMOUNT_OF_POINTS; i++)
+			{
+				points2.add(Vector2((float)(i % 101), (float)(i % 37)));
+				points3.add(Vector3((float)(i % 101), (float)(i % 37), (float)(i % 13)));
+			}
+			const Span<const Vector2> span2(points2.getRaw(), points2.getLength());
+			const Span<const Vector3> span3(points3.getRaw(), points3.getLength());
+			List<Vector2> out2 = points2;
+			List<Vector3> out3 = points3;
+			const Vector2 axis2 = Vector2(1, 2).normalize();
+			const Vector3 axis3 = Vector3(1, 2, 3).normalize();
+			const Matrix4 matrix = Matrix4::createTransform(Vector3(1, 2, 3), Vector3(2), Vector3(0, 0, 1), 0.5f);
+
+			std::cout << AMOUNT_OF_POINTS << " points, " << ITERATIONS << " iterations" << std::endl;
+			{
+				//What Shape::project did per axis: project every point into a new list, then dot it with the axis.
+				float sink = 0;
+				CPUWatch watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					List<Vector2> projections;
+					projections.resizeCapacityAndLength(points2.getLength());
+					for (size_t i = 0; i < points2.getLength(); i++)
+					{
+						projections[i] = points2[i].project(axis2);
+					}
+					float min = projections[0] * axis2;
+					for (size_t i = 1; i < projections.getLength(); i++)
+					{
+						const float dot = projections[i] * axis2;
+						min = dot < min ? dot : min;
+					}
+					sink += min;
+				}
+				std::cout << "    Vector2 range, project and dot per point: " << watch.getTimeExpiredSeconds() << "s (" << sink << ")" << std::endl;
+			}
+
+			const SimdLevel supported = getSimdLevel();
+			for (SimdLevel level : { SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				if (level > supported) continue;
+				setSimdLevel(level);
+				const char* name = level == SimdLevel::SCALAR ? "scalar" : (level == SimdLevel::SSE2 ? "SSE2" : "AVX2");
+
+				float sink = 0;
+				CPUWatch rangeWatch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					sink += Math::projectRange(span2, axis2).min;
+				}
+				const double rangeTime = rangeWatch.getTimeExpiredSeconds();
+
+				CPUWatch range3Watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					sink += Math::projectRange(span3, axis3).min;
+				}
+				const double range3Time = range3Watch.getTimeExpiredSeconds();
+
+				CPUWatch transformWatch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					Math::transformPoints(matrix, span2, Span<Vector2>(out2.getRaw(), out2.getLength()));
+					sink += out2[k].x;
+				}
+				const double transformTime = transformWatch.getTimeExpiredSeconds();
+
+				CPUWatch transform3Watch;
+				for (int k = 0; k < ITERATIONS; k++)
+				{
+					Math::transformPoints(matrix, span3, Span<Vector3>(out3.getRaw(), out3.getLength()));
+					sink += out3[k].x;
+				}
+				const double transform3Time = transform3Watch.getTimeExpiredSeconds();
+
+				std::cout << "    " << name << ": Vector2 range " << rangeTime << "s, Vector3 range " << range3Time
+					<< "s, Vector2 transform " << transformTime << "s, Vector3 transform " << transform3Time << "s (" << sink << ")" << std::endl;
+			}
+			setSimdLevel(supported);
+		}
+	}
+}
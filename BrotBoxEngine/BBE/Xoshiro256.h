@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+#include <ctime>
+#include "../BBE/Hash.h"
+
+namespace bbe
+{
+	//xoshiro256** by David Blackman and Sebastiano Vigna, see: https://prng.di.unimi.it/
+	//32 bytes of state, a period of 2^256 - 1 and a few nanoseconds per 64 bit output. Unlike the
+	//Mersenne Twister, seeding is constant time. Also usable as a std UniformRandomBitGenerator.
+	class Xoshiro256StarStar
+	{
+	private:
+		uint64_t m_state[4];
+
+		static constexpr uint64_t rotl(uint64_t x, int k)
+		{
+			return (x << k) | (x >> (64 - k));
+		}
+
+	public:
+		using result_type = uint64_t;
+
+		Xoshiro256StarStar()
+		{
+			std::time_t timeStamp = std::time(nullptr);
+			setSeed((uint64_t)timeStamp);
+		}
+
+		explicit Xoshiro256StarStar(uint64_t seed)
+		{
+			setSeed(seed);
+		}
+
+		//Expands the seed with splitmix64, as recommended by the authors. Every seed, including 0, gives a valid state.
+		void setSeed(uint64_t seed)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				seed += 0x9E3779B97F4A7C15ull;
+				m_state[i] = INTERNAL::hashMix64(seed);
+			}
+		}
+
+		uint64_t next()
+		{
+			const uint64_t retVal = rotl(m_state[1] * 5, 7) * 9;
+			const uint64_t t = m_state[1] << 17;
+
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+
+			m_state[2] ^= t;
+			m_state[3] = rotl(m_state[3], 45);
+
+			return retVal;
+		}
+
+		//Advances the generator by 2^128 outputs. Copies of one generator that are jumped 0, 1, 2, ...
+		//times produce non overlapping sequences, e.g. one for each thread.
+		void jump()
+		{
+			static constexpr uint64_t JUMP[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+			uint64_t newState[4] = { 0, 0, 0, 0 };
+			for (int i = 0; i < 4; i++)
+			{
+				for (int b = 0; b < 64; b++)
+				{
+					if (JUMP[i] & (1ull << b))
+					{
+						for (int k = 0; k < 4; k++)
+						{
+							newState[k] ^= m_state[k];
+						}
+					}
+					next();
+				}
+			}
+			for (int k = 0; k < 4; k++)
+			{
+				m_state[k] = newState[k];
+			}
+		}
+
+		static constexpr uint64_t (min)()
+		{
+			return 0;
+		}
+
+		static constexpr uint64_t (max)()
+		{
+			return 0xFFFFFFFFFFFFFFFFull;
+		}
+
+		uint64_t operator()()
+		{
+			return next();
+		}
+	};
+}
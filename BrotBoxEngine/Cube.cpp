@@ -245,7 +245,7 @@ bbe::List<bbe::Vector3> bbe::Cube::getNormals() const
 	return retVal;
 }
 
-void bbe::Cube::getVertices(bbe::List<bbe::Vector3>& outVertices) const
+void bbe::Cube::getVertices(VertexList& outVertices) const
 {
 	outVertices.clear();
 
@@ -0,0 +1,133 @@
+#include "BBE/FrameArena.h"
+#include "BBE/Math.h"
+
+static bbe::FrameArena* currentArena = nullptr;
+
+static bbe::StackAllocator<bbe::byte>* newBlock(std::size_t size)
+{
+	bbe::StackAllocator<bbe::byte>* block = new bbe::StackAllocator<bbe::byte>(size);
+	block->getTelemetry().setName("FrameArena");
+	return block;
+}
+
+bbe::FrameArena::FrameArena(std::size_t size)
+	: m_blockSize(size)
+{
+	if (m_blockSize == 0)
+	{
+		throw IllegalArgumentException();
+	}
+	for (Buffer& buffer : m_buffers)
+	{
+		buffer.add(newBlock(m_blockSize));
+	}
+}
+
+bbe::FrameArena::~FrameArena()
+{
+	if (currentArena == this)
+	{
+		currentArena = nullptr;
+	}
+	for (Buffer& buffer : m_buffers)
+	{
+		destroyBuffer(buffer);
+	}
+}
+
+bbe::StackAllocator<bbe::byte>& bbe::FrameArena::getBlock(std::size_t amountOfBytes, std::size_t alignment)
+{
+	Buffer& buffer = m_buffers[m_currentBuffer];
+	if (!buffer.last()->canAllocate(amountOfBytes, alignment))
+	{
+		const std::size_t blockSize = Math::max(buffer.last()->getCapacity() * 2, amountOfBytes + alignment);
+		buffer.add(newBlock(blockSize));
+	}
+	return *buffer.last();
+}
+
+void* bbe::FrameArena::allocate(std::size_t amountOfBytes, std::size_t alignment)
+{
+	return getBlock(amountOfBytes, alignment).allocate(amountOfBytes, alignment);
+}
+
+void bbe::FrameArena::deallocate(void* /*data*/, std::size_t /*amountOfBytes*/)
+{
+	//Memory is only reclaimed as a whole when the buffer is reset.
+}
+
+void bbe::FrameArena::resetBuffer(Buffer& buffer)
+{
+	m_peakUsedBytes = Math::max(m_peakUsedBytes, getUsedBytes(buffer));
+
+	if (buffer.getLength() == 1)
+	{
+		buffer[0]->deallocateAll();
+		return;
+	}
+
+	std::size_t capacity = 0;
+	for (StackAllocator<byte>* block : buffer)
+	{
+		capacity += block->getCapacity();
+	}
+	destroyBuffer(buffer);
+	m_blockSize = Math::max(m_blockSize, capacity);
+	buffer.add(newBlock(m_blockSize));
+}
+
+void bbe::FrameArena::destroyBuffer(Buffer& buffer)
+{
+	for (StackAllocator<byte>* block : buffer)
+	{
+		block->deallocateAll();
+		delete block;
+	}
+	buffer.clear();
+}
+
+std::size_t bbe::FrameArena::getUsedBytes(const Buffer& buffer) const
+{
+	std::size_t usedBytes = 0;
+	for (const StackAllocator<byte>* block : buffer)
+	{
+		usedBytes += block->getUsedBytes();
+	}
+	return usedBytes;
+}
+
+void bbe::FrameArena::endFrame()
+{
+	m_currentBuffer = 1 - m_currentBuffer;
+	resetBuffer(m_buffers[m_currentBuffer]);
+}
+
+std::size_t bbe::FrameArena::getUsedBytes() const
+{
+	return getUsedBytes(m_buffers[m_currentBuffer]);
+}
+
+std::size_t bbe::FrameArena::getCapacity() const
+{
+	std::size_t capacity = 0;
+	for (const StackAllocator<byte>* block : m_buffers[m_currentBuffer])
+	{
+		capacity += block->getCapacity();
+	}
+	return capacity;
+}
+
+std::size_t bbe::FrameArena::getPeakUsedBytes() const
+{
+	return Math::max(m_peakUsedBytes, getUsedBytes());
+}
+
+void bbe::FrameArena::makeCurrent()
+{
+	currentArena = this;
+}
+
+bbe::FrameArena* bbe::FrameArena::getCurrent()
+{
+	return currentArena;
+}
@@ -30,9 +30,6 @@ void bbe::Game::start(int windowWidth, int windowHeight, const char* title)
 	}
 	m_started = true;
 
-	std::cout << "Starting math" << std::endl;
-	bbe::Math::INTERNAL::startMath();
-
 	std::cout << "Creating window" << std::endl;
 	m_pwindow = new Window(windowWidth, windowHeight, title);
 
@@ -44,6 +41,8 @@ void bbe::Game::start(int windowWidth, int windowHeight, const char* title)
 	m_soundManager.init();
 #endif
 
+	m_frameArena.makeCurrent();
+
 	std::cout << "Calling onStart()" << std::endl;
 	onStart();
 
@@ -61,7 +60,8 @@ void bbe::Game::start(int windowWidth, int windowHeight, const char* title)
 			
 			if (screenshotRenderingPath)
 			{
-				screenshot((bbe::String(screenshotRenderingPath) + m_frameNumber + ".png").getRaw());
+				m_screenshotPath.format("{}{}.png", screenshotRenderingPath, m_frameNumber);
+				screenshot(m_screenshotPath.getRaw());
 			}
 		}
 
@@ -93,6 +93,8 @@ void bbe::Game::frame()
 	m_pwindow->postDraw();
 	bbe::Profiler::INTERNAL::setCPUTime(sw.getTimeExpiredNanoseconds() / 1000.f / 1000.f / 1000.f);
 	m_pwindow->waitEndDraw();
+	m_frameArena.endFrame();
+	bbe::Profiler::INTERNAL::endFrame();
 }
 
 void bbe::Game::shutdown()
@@ -276,6 +278,11 @@ bbe::PhysWorld* bbe::Game::getPhysWorld()
 	return &m_physWorld;
 }
 
+bbe::FrameArena& bbe::Game::getFrameArena()
+{
+	return m_frameArena;
+}
+
 void bbe::Game::screenshot(const bbe::String &path)
 {
 	m_pwindow->screenshot(path);
@@ -0,0 +1,112 @@
+#include "BBE/Hash.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//See: https://github.com/wangyi-fudan/wyhash
+//Changes to the original algorithm:
+//  1. Only the default secret is supported
+//  2. Unaligned reads are done with memcpy and assume a little endian machine
+
+static constexpr uint64_t WYHASH_SECRET[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+static inline void wymum(uint64_t* a, uint64_t* b)
+{
+#if defined(__SIZEOF_INT128__)
+	const __uint128_t r = static_cast<__uint128_t>(*a) * *b;
+	*a = static_cast<uint64_t>(r);
+	*b = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	*a = _umul128(*a, *b, b);
+#else
+	const uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+	const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+	uint64_t c = t < rl;
+	const uint64_t lo = t + (rm1 << 32);
+	c += lo < t;
+	*a = lo;
+	*b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static inline uint64_t wymix(uint64_t a, uint64_t b)
+{
+	wymum(&a, &b);
+	return a ^ b;
+}
+
+static inline uint64_t wyr8(const unsigned char* p)
+{
+	uint64_t v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+static inline uint64_t wyr4(const unsigned char* p)
+{
+	uint32_t v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static inline uint64_t wyr3(const unsigned char* p, std::size_t k)
+{
+	return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+
+uint64_t bbe::hashBytes(const void* data, std::size_t length, uint64_t seed)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	seed ^= wymix(seed ^ WYHASH_SECRET[0], WYHASH_SECRET[1]);
+	uint64_t a;
+	uint64_t b;
+	if (length <= 16)
+	{
+		if (length >= 4)
+		{
+			a = (wyr4(p) << 32) | wyr4(p + ((length >> 3) << 2));
+			b = (wyr4(p + length - 4) << 32) | wyr4(p + length - 4 - ((length >> 3) << 2));
+		}
+		else if (length > 0)
+		{
+			a = wyr3(p, length);
+			b = 0;
+		}
+		else
+		{
+			a = 0;
+			b = 0;
+		}
+	}
+	else
+	{
+		std::size_t i = length;
+		if (i > 48)
+		{
+			uint64_t see1 = seed;
+			uint64_t see2 = seed;
+			do
+			{
+				seed = wymix(wyr8(p) ^ WYHASH_SECRET[1], wyr8(p + 8) ^ seed);
+				see1 = wymix(wyr8(p + 16) ^ WYHASH_SECRET[2], wyr8(p + 24) ^ see1);
+				see2 = wymix(wyr8(p + 32) ^ WYHASH_SECRET[3], wyr8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16)
+		{
+			seed = wymix(wyr8(p) ^ WYHASH_SECRET[1], wyr8(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = wyr8(p + i - 16);
+		b = wyr8(p + i - 8);
+	}
+	a ^= WYHASH_SECRET[1];
+	b ^= seed;
+	wymum(&a, &b);
+	return wymix(a ^ WYHASH_SECRET[0] ^ length, b ^ WYHASH_SECRET[1]);
+}
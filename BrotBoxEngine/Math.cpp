@@ -2,27 +2,47 @@
 #include "BBE/Vector2.h"
 #include "BBE/Vector3.h"
 #include "BBE/Vector4.h"
+#include "BBE/SmallList.h"
 #include <cmath>
+#include <cstring>
 
-double bbe::Math::INTERNAL::sinTable[TABLE_SIZES] = {};
-double bbe::Math::INTERNAL::cosTable[TABLE_SIZES] = {};
-double bbe::Math::INTERNAL::tanTable[TABLE_SIZES] = {};
-
-#ifdef _DEBUG
-static bool isMathInitialized()
+namespace bbe
 {
-	return bbe::Math::INTERNAL::cosTable[0] == 1.0f;
-}
-#endif
-
-static void throwIfUninitializedAndDebug()
-{
-#ifdef _DEBUG
-	if (!isMathInitialized())
+	namespace Math
 	{
-		throw bbe::NotInitializedException();
+		namespace INTERNAL
+		{
+			//Returns r = val - quadrant * PI/2 with r in [-PI/4, PI/4] and the lowest two bits of the quadrant.
+			static float reduceTrigArgument(float val, uint32_t& outQuadrant)
+			{
+				const float shifted = val * TRIG_TWO_OVER_PI + TRIG_ROUND_MAGIC;
+				const float quadrant = shifted - TRIG_ROUND_MAGIC;
+				//The last mantissa bits of shifted are the quadrant. Unlike a cast this is defined for NaN and huge values.
+				uint32_t shiftedBits;
+				memcpy(&shiftedBits, &shifted, sizeof(shiftedBits));
+				outQuadrant = shiftedBits & 3;
+				return ((val - quadrant * TRIG_PI_OVER_2_PART1) - quadrant * TRIG_PI_OVER_2_PART2) - quadrant * TRIG_PI_OVER_2_PART3;
+			}
+
+			static bool needsSlowTrigPath(float val)
+			{
+				//Also true for NaN.
+				return !(std::fabs(val) <= TRIG_FAST_REDUCTION_LIMIT);
+			}
+
+			static float sinPolynomial(float r)
+			{
+				const float r2 = r * r;
+				return ((TRIG_SIN_3 * r2 + TRIG_SIN_2) * r2 + TRIG_SIN_1) * r2 * r + r;
+			}
+
+			static float cosPolynomial(float r)
+			{
+				const float r2 = r * r;
+				return ((TRIG_COS_3 * r2 + TRIG_COS_2) * r2 + TRIG_COS_1) * r2 * r2 - 0.5f * r2 + 1.0f;
+			}
+		}
 	}
-#endif
 }
 
 double bbe::Math::pow(double base, double expo)
@@ -30,13 +50,16 @@ double bbe::Math::pow(double base, double expo)
 	return ::pow(base, expo);
 }
 
-double bbe::Math::cos(double val)
+float bbe::Math::cos(float val)
 {
-	throwIfUninitializedAndDebug();
-	if (val == INFINITY_POSITIVE || val == INFINITY_NEGATIVE) return 0;
-	val = bbe::Math::mod(val, TAU);
-	int index = (int)(val / TAU * INTERNAL::TABLE_SIZES);
-	return INTERNAL::cosTable[index];
+	if (INTERNAL::needsSlowTrigPath(val))
+	{
+		return std::cos(val);
+	}
+	uint32_t quadrant;
+	const float r = INTERNAL::reduceTrigArgument(val, quadrant);
+	const float retVal = (quadrant & 1) ? INTERNAL::sinPolynomial(r) : INTERNAL::cosPolynomial(r);
+	return ((quadrant + 1) & 2) ? -retVal : retVal;
 }
 
 float bbe::Math::acos(float val)
@@ -44,13 +67,40 @@ float bbe::Math::acos(float val)
 	return ::acos(val);
 }
 
-double bbe::Math::sin(double val)
+float bbe::Math::sin(float val)
 {
-	throwIfUninitializedAndDebug();
-	if (val == INFINITY_POSITIVE || val == INFINITY_NEGATIVE) return 0;
-	val = bbe::Math::mod(val, TAU);
-	int index = (int)(val / TAU * INTERNAL::TABLE_SIZES);
-	return INTERNAL::sinTable[index];
+	if (INTERNAL::needsSlowTrigPath(val))
+	{
+		return std::sin(val);
+	}
+	uint32_t quadrant;
+	const float r = INTERNAL::reduceTrigArgument(val, quadrant);
+	const float retVal = (quadrant & 1) ? INTERNAL::cosPolynomial(r) : INTERNAL::sinPolynomial(r);
+	return (quadrant & 2) ? -retVal : retVal;
+}
+
+void bbe::Math::sincos(float val, float& outSin, float& outCos)
+{
+	if (INTERNAL::needsSlowTrigPath(val))
+	{
+		outSin = std::sin(val);
+		outCos = std::cos(val);
+		return;
+	}
+	uint32_t quadrant;
+	const float r = INTERNAL::reduceTrigArgument(val, quadrant);
+	const float sin = INTERNAL::sinPolynomial(r);
+	const float cos = INTERNAL::cosPolynomial(r);
+	outSin = (quadrant & 1) ? cos : sin;
+	outCos = (quadrant & 1) ? sin : cos;
+	if (quadrant & 2)
+	{
+		outSin = -outSin;
+	}
+	if ((quadrant + 1) & 2)
+	{
+		outCos = -outCos;
+	}
 }
 
 float bbe::Math::asin(float val)
@@ -58,12 +108,12 @@ float bbe::Math::asin(float val)
 	return ::asin(val);
 }
 
-double bbe::Math::tan(double val)
+float bbe::Math::tan(float val)
 {
-	throwIfUninitializedAndDebug();
-	val = bbe::Math::mod(val, TAU);
-	int index = (int)(val / TAU * INTERNAL::TABLE_SIZES);
-	return INTERNAL::tanTable[index];
+	float sin;
+	float cos;
+	sincos(val, sin, cos);
+	return sin / cos;
 }
 
 float bbe::Math::atan(float val)
@@ -402,7 +452,8 @@ bbe::List<bbe::Vector2> bbe::Math::getConvexHull(const bbe::List<bbe::Vector2>&
 {
 	if (points.getLength() < 3) return {};
 
-	auto copy = points;
+	//Both temporaries stay inline for the small point sets this is usually called with.
+	bbe::SmallList<bbe::Vector2, 32> copy(points);
 	copy.sort([](const bbe::Vector2& a, const bbe::Vector2& b)
 		{
 			if (a.x < b.x) return true;
@@ -413,7 +464,7 @@ bbe::List<bbe::Vector2> bbe::Math::getConvexHull(const bbe::List<bbe::Vector2>&
 			}
 		});
 
-	bbe::List<bbe::Vector2> retVal;
+	bbe::SmallList<bbe::Vector2, 32> retVal;
 	retVal.add(copy[0]);
 	retVal.add(copy[1]);
 	for (size_t i = 2; i < copy.getLength(); i++)
@@ -442,7 +493,7 @@ bbe::List<bbe::Vector2> bbe::Math::getConvexHull(const bbe::List<bbe::Vector2>&
 	}
 	if (retVal.getLength() > 0) retVal.removeIndex(retVal.getLength() - 1);
 
-	return retVal;
+	return retVal.toList();
 }
 
 const bbe::Vector2* bbe::Math::getClosest(const bbe::Vector2& pos, const bbe::List<bbe::Vector2>& points)
@@ -780,14 +831,3 @@ bbe::Vector4 bbe::Math::interpolateHermite(Vector4 a, Vector4 b, float t, Vector
 		interpolateHermite(a.w, b.w, t, tangent1.w, tangent2.w)
 	);
 }
-
-void bbe::Math::INTERNAL::startMath()
-{
-	for (std::size_t i = 0; i < INTERNAL::TABLE_SIZES; i++)
-	{
-		float val = (float)i / INTERNAL::TABLE_SIZES * TAU;
-		sinTable[i] = ::sin(val);
-		cosTable[i] = ::cos(val);
-		tanTable[i] = ::tan(val);
-	}
-}
@@ -2,39 +2,6 @@
 #include "BBE/Math.h"
 #include "BBE/Exceptions.h"
 
-bbe::Matrix4::Matrix4()
-{
-	static_assert(sizeof(Matrix4) == sizeof(float) * 16, "The size of a Matrix4 must be sizeof(float) * 16!");
-
-	m_cols[0].x = 1;
-	m_cols[0].y = 0;
-	m_cols[0].z = 0;
-	m_cols[0].w = 0;
-
-	m_cols[1].x = 0;
-	m_cols[1].y = 1;
-	m_cols[1].z = 0;
-	m_cols[1].w = 0;
-
-	m_cols[2].x = 0;
-	m_cols[2].y = 0;
-	m_cols[2].z = 1;
-	m_cols[2].w = 0;
-
-	m_cols[3].x = 0;
-	m_cols[3].y = 0;
-	m_cols[3].z = 0;
-	m_cols[3].w = 1;
-}
-
-bbe::Matrix4::Matrix4(const Vector4 & col0, const Vector4 & col1, const Vector4 & col2, const Vector4 & col3)
-{
-	m_cols[0] = col0;
-	m_cols[1] = col1;
-	m_cols[2] = col2;
-	m_cols[3] = col3;
-}
-
 bbe::Matrix4 bbe::Matrix4::createTranslationMatrix(const Vector3 & translation)
 {
 	Matrix4 retVal;
@@ -54,8 +21,9 @@ bbe::Matrix4 bbe::Matrix4::createRotationMatrix(float radians, const Vector3 & r
 	float x = nra.x;
 	float y = nra.y;
 	float z = nra.z;
-	float cos = Math::cos(radians);
-	float sin = Math::sin(radians);
+	float sin;
+	float cos;
+	Math::sincos(radians, sin, cos);
 
 	Matrix4 retVal;
 	retVal.m_cols[0].x = cos + x * x * (1 - cos);
@@ -201,16 +169,6 @@ const float & bbe::Matrix4::operator[](int index) const
 	return data[index];
 }
 
-bbe::Vector4 bbe::Matrix4::operator*(const Vector4 & other) const
-{
-	return Vector4(
-		m_cols[0].x * other.x + m_cols[1].x * other.y + m_cols[2].x * other.z + m_cols[3].x * other.w,
-		m_cols[0].y * other.x + m_cols[1].y * other.y + m_cols[2].y * other.z + m_cols[3].y * other.w,
-		m_cols[0].z * other.x + m_cols[1].z * other.y + m_cols[2].z * other.z + m_cols[3].z * other.w,
-		m_cols[0].w * other.x + m_cols[1].w * other.y + m_cols[2].w * other.z + m_cols[3].w * other.w
-	);
-}
-
 bbe::Vector4 bbe::Matrix4::getColumn(int colIndex) const
 {
 	if (colIndex < 0 || colIndex > 3)
@@ -255,31 +213,6 @@ bbe::Matrix4 bbe::Matrix4::extractRotation() const
 	);
 }
 
-bbe::Matrix4 bbe::Matrix4::operator*(const Matrix4 &other) const
-{
-	Matrix4 retVal;
-	retVal.m_cols[0].x = m_cols[0].x * other.m_cols[0].x + m_cols[1].x * other.m_cols[0].y + m_cols[2].x * other.m_cols[0].z + m_cols[3].x * other.m_cols[0].w;
-	retVal.m_cols[1].x = m_cols[0].x * other.m_cols[1].x + m_cols[1].x * other.m_cols[1].y + m_cols[2].x * other.m_cols[1].z + m_cols[3].x * other.m_cols[1].w;
-	retVal.m_cols[2].x = m_cols[0].x * other.m_cols[2].x + m_cols[1].x * other.m_cols[2].y + m_cols[2].x * other.m_cols[2].z + m_cols[3].x * other.m_cols[2].w;
-	retVal.m_cols[3].x = m_cols[0].x * other.m_cols[3].x + m_cols[1].x * other.m_cols[3].y + m_cols[2].x * other.m_cols[3].z + m_cols[3].x * other.m_cols[3].w;
-																					 				   				   				 				 
-	retVal.m_cols[0].y = m_cols[0].y * other.m_cols[0].x + m_cols[1].y * other.m_cols[0].y + m_cols[2].y * other.m_cols[0].z + m_cols[3].y * other.m_cols[0].w;
-	retVal.m_cols[1].y = m_cols[0].y * other.m_cols[1].x + m_cols[1].y * other.m_cols[1].y + m_cols[2].y * other.m_cols[1].z + m_cols[3].y * other.m_cols[1].w;
-	retVal.m_cols[2].y = m_cols[0].y * other.m_cols[2].x + m_cols[1].y * other.m_cols[2].y + m_cols[2].y * other.m_cols[2].z + m_cols[3].y * other.m_cols[2].w;
-	retVal.m_cols[3].y = m_cols[0].y * other.m_cols[3].x + m_cols[1].y * other.m_cols[3].y + m_cols[2].y * other.m_cols[3].z + m_cols[3].y * other.m_cols[3].w;
-																					 				   				   				 				 
-	retVal.m_cols[0].z = m_cols[0].z * other.m_cols[0].x + m_cols[1].z * other.m_cols[0].y + m_cols[2].z * other.m_cols[0].z + m_cols[3].z * other.m_cols[0].w;
-	retVal.m_cols[1].z = m_cols[0].z * other.m_cols[1].x + m_cols[1].z * other.m_cols[1].y + m_cols[2].z * other.m_cols[1].z + m_cols[3].z * other.m_cols[1].w;
-	retVal.m_cols[2].z = m_cols[0].z * other.m_cols[2].x + m_cols[1].z * other.m_cols[2].y + m_cols[2].z * other.m_cols[2].z + m_cols[3].z * other.m_cols[2].w;
-	retVal.m_cols[3].z = m_cols[0].z * other.m_cols[3].x + m_cols[1].z * other.m_cols[3].y + m_cols[2].z * other.m_cols[3].z + m_cols[3].z * other.m_cols[3].w;
-																					 				   				   				 				 
-	retVal.m_cols[0].w = m_cols[0].w * other.m_cols[0].x + m_cols[1].w * other.m_cols[0].y + m_cols[2].w * other.m_cols[0].z + m_cols[3].w * other.m_cols[0].w;
-	retVal.m_cols[1].w = m_cols[0].w * other.m_cols[1].x + m_cols[1].w * other.m_cols[1].y + m_cols[2].w * other.m_cols[1].z + m_cols[3].w * other.m_cols[1].w;
-	retVal.m_cols[2].w = m_cols[0].w * other.m_cols[2].x + m_cols[1].w * other.m_cols[2].y + m_cols[2].w * other.m_cols[2].z + m_cols[3].w * other.m_cols[2].w;
-	retVal.m_cols[3].w = m_cols[0].w * other.m_cols[3].x + m_cols[1].w * other.m_cols[3].y + m_cols[2].w * other.m_cols[3].z + m_cols[3].w * other.m_cols[3].w;
-	return retVal;
-}
-
 bbe::Vector3 bbe::Matrix4::operator*(const Vector3 & other) const
 {
 	Vector4 retVal(other, 1);
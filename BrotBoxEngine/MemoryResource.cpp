@@ -0,0 +1,115 @@
+#include "BBE/MemoryResource.h"
+#include "BBE/Exceptions.h"
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		template <std::size_t ALIGNMENT>
+		struct MemoryResourceAlignedBlock
+		{
+			alignas(ALIGNMENT) byte data[ALIGNMENT];
+		};
+
+		template <std::size_t ALIGNMENT>
+		static void* gpaAllocateAligned(GeneralPurposeAllocator& gpa, std::size_t amountOfBytes)
+		{
+			typedef MemoryResourceAlignedBlock<ALIGNMENT> Block;
+			const std::size_t amountOfBlocks = (amountOfBytes + sizeof(Block) - 1) / sizeof(Block);
+			return gpa.allocateObjectsAligned<Block, ALIGNMENT>(amountOfBlocks).getRaw();
+		}
+
+		template <std::size_t ALIGNMENT>
+		static void gpaDeallocateAligned(GeneralPurposeAllocator& gpa, void* data, std::size_t amountOfBytes)
+		{
+			typedef MemoryResourceAlignedBlock<ALIGNMENT> Block;
+			const std::size_t amountOfBlocks = (amountOfBytes + sizeof(Block) - 1) / sizeof(Block);
+			GeneralPurposeAllocator::GeneralPurposeAllocatorPointer<Block> pointer(static_cast<Block*>(data), amountOfBlocks);
+			gpa.deallocate(pointer);
+		}
+	}
+}
+
+void* bbe::StackAllocatorMemoryResource::do_allocate(std::size_t amountOfBytes, std::size_t alignment)
+{
+	return m_parentAllocator->allocate(amountOfBytes, alignment);
+}
+
+void bbe::StackAllocatorMemoryResource::do_deallocate(void* /*data*/, std::size_t /*amountOfBytes*/, std::size_t /*alignment*/)
+{
+	//Memory is only reclaimed by resetting the StackAllocator.
+}
+
+bool bbe::StackAllocatorMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+bbe::StackAllocatorMemoryResource::StackAllocatorMemoryResource(StackAllocator<byte>& parentAllocator)
+	: m_parentAllocator(bbe::addressOf(parentAllocator))
+{
+	//do nothing
+}
+
+bbe::StackAllocator<bbe::byte>& bbe::StackAllocatorMemoryResource::getParentAllocator() const
+{
+	return *m_parentAllocator;
+}
+
+void* bbe::GeneralPurposeAllocatorMemoryResource::do_allocate(std::size_t amountOfBytes, std::size_t alignment)
+{
+	if (amountOfBytes == 0)
+	{
+		amountOfBytes = 1;
+	}
+	switch (alignment)
+	{
+	case   1: return INTERNAL::gpaAllocateAligned<  1>(*m_parentAllocator, amountOfBytes);
+	case   2: return INTERNAL::gpaAllocateAligned<  2>(*m_parentAllocator, amountOfBytes);
+	case   4: return INTERNAL::gpaAllocateAligned<  4>(*m_parentAllocator, amountOfBytes);
+	case   8: return INTERNAL::gpaAllocateAligned<  8>(*m_parentAllocator, amountOfBytes);
+	case  16: return INTERNAL::gpaAllocateAligned< 16>(*m_parentAllocator, amountOfBytes);
+	case  32: return INTERNAL::gpaAllocateAligned< 32>(*m_parentAllocator, amountOfBytes);
+	case  64: return INTERNAL::gpaAllocateAligned< 64>(*m_parentAllocator, amountOfBytes);
+	case 128: return INTERNAL::gpaAllocateAligned<128>(*m_parentAllocator, amountOfBytes);
+	default:
+		throw IllegalArgumentException();
+	}
+}
+
+void bbe::GeneralPurposeAllocatorMemoryResource::do_deallocate(void* data, std::size_t amountOfBytes, std::size_t alignment)
+{
+	if (amountOfBytes == 0)
+	{
+		amountOfBytes = 1;
+	}
+	switch (alignment)
+	{
+	case   1: INTERNAL::gpaDeallocateAligned<  1>(*m_parentAllocator, data, amountOfBytes); break;
+	case   2: INTERNAL::gpaDeallocateAligned<  2>(*m_parentAllocator, data, amountOfBytes); break;
+	case   4: INTERNAL::gpaDeallocateAligned<  4>(*m_parentAllocator, data, amountOfBytes); break;
+	case   8: INTERNAL::gpaDeallocateAligned<  8>(*m_parentAllocator, data, amountOfBytes); break;
+	case  16: INTERNAL::gpaDeallocateAligned< 16>(*m_parentAllocator, data, amountOfBytes); break;
+	case  32: INTERNAL::gpaDeallocateAligned< 32>(*m_parentAllocator, data, amountOfBytes); break;
+	case  64: INTERNAL::gpaDeallocateAligned< 64>(*m_parentAllocator, data, amountOfBytes); break;
+	case 128: INTERNAL::gpaDeallocateAligned<128>(*m_parentAllocator, data, amountOfBytes); break;
+	default:
+		throw IllegalArgumentException();
+	}
+}
+
+bool bbe::GeneralPurposeAllocatorMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+bbe::GeneralPurposeAllocatorMemoryResource::GeneralPurposeAllocatorMemoryResource(GeneralPurposeAllocator& parentAllocator)
+	: m_parentAllocator(bbe::addressOf(parentAllocator))
+{
+	//do nothing
+}
+
+bbe::GeneralPurposeAllocator& bbe::GeneralPurposeAllocatorMemoryResource::getParentAllocator() const
+{
+	return *m_parentAllocator;
+}
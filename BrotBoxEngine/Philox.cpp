@@ -0,0 +1,290 @@
+#include "BBE/Philox.h"
+#include "BBE/Simd.h"
+
+#ifdef BBE_CAN_DISPATCH_AVX2
+#include <immintrin.h>
+#endif
+
+static constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+static constexpr uint32_t PHILOX_W0 = 0x9E3779B9; //Weyl sequence to bump the key after every round.
+static constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+static constexpr int PHILOX_ROUNDS = 10;
+static constexpr float PHILOX_FLOAT_STEP = 1.0f / 16777216.0f;
+
+static inline float philoxToFloat(uint32_t value)
+{
+	return (float)(value >> 8) * PHILOX_FLOAT_STEP;
+}
+
+//Either output may be nullptr.
+static inline void philoxStore(uint32_t value, std::size_t i, uint32_t* outBits, float* outFloats)
+{
+	if (outBits != nullptr)
+	{
+		outBits[i] = value;
+	}
+	if (outFloats != nullptr)
+	{
+		outFloats[i] = philoxToFloat(value);
+	}
+}
+
+static void philoxBlock(const uint32_t key[2], const uint32_t stream[2], uint64_t blockIndex, uint32_t out[4])
+{
+	uint32_t c0 = (uint32_t)blockIndex;
+	uint32_t c1 = (uint32_t)(blockIndex >> 32);
+	uint32_t c2 = stream[0];
+	uint32_t c3 = stream[1];
+	uint32_t k0 = key[0];
+	uint32_t k1 = key[1];
+	for (int round = 0; round < PHILOX_ROUNDS; round++)
+	{
+		if (round > 0)
+		{
+			k0 += PHILOX_W0;
+			k1 += PHILOX_W1;
+		}
+		const uint64_t product0 = (uint64_t)PHILOX_M0 * c0;
+		const uint64_t product1 = (uint64_t)PHILOX_M1 * c2;
+		c0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;
+		c1 = (uint32_t)product1;
+		c2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+		c3 = (uint32_t)product0;
+	}
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+	out[3] = c3;
+}
+
+//Values firstIndex to firstIndex + length - 1, one block at a time.
+static void philoxFillScalar(const uint32_t key[2], const uint32_t stream[2], uint64_t firstIndex, std::size_t length, uint32_t* outBits, float* outFloats)
+{
+	std::size_t i = 0;
+	while (i < length)
+	{
+		const uint64_t index = firstIndex + i;
+		uint32_t block[4];
+		philoxBlock(key, stream, index / 4, block);
+		for (uint32_t word = (uint32_t)(index % 4); word < 4 && i < length; word++, i++)
+		{
+			philoxStore(block[word], i, outBits, outFloats);
+		}
+	}
+}
+
+//The SIMD kernels evaluate one block per lane, transpose the results into block order and return the
+//amount of blocks they did. They do the same integer operations as philoxBlock.
+#ifdef BBE_USE_SSE2
+static inline void philoxMulSse2(__m128i a, __m128i m, __m128i& hi, __m128i& lo)
+{
+	const __m128i even = _mm_mul_epu32(a, m);
+	const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+	lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+static inline void philoxStoreSse2(__m128i value, uint32_t* outBits, float* outFloats)
+{
+	if (outBits != nullptr)
+	{
+		_mm_storeu_si128((__m128i*)outBits, value);
+	}
+	if (outFloats != nullptr)
+	{
+		_mm_storeu_ps(outFloats, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(value, 8)), _mm_set1_ps(PHILOX_FLOAT_STEP)));
+	}
+}
+
+static std::size_t philoxSse2(const uint32_t key[2], const uint32_t stream[2], uint64_t firstBlock, std::size_t blocks, uint32_t* outBits, float* outFloats)
+{
+	const __m128i m0 = _mm_set1_epi32((int)PHILOX_M0);
+	const __m128i m1 = _mm_set1_epi32((int)PHILOX_M1);
+	std::size_t b = 0;
+	for (; b + 4 <= blocks; b += 4)
+	{
+		const uint64_t block = firstBlock + b;
+		__m128i c0 = _mm_set_epi32((int)(uint32_t)(block + 3), (int)(uint32_t)(block + 2), (int)(uint32_t)(block + 1), (int)(uint32_t)block);
+		__m128i c1 = _mm_set_epi32((int)(uint32_t)((block + 3) >> 32), (int)(uint32_t)((block + 2) >> 32), (int)(uint32_t)((block + 1) >> 32), (int)(uint32_t)(block >> 32));
+		__m128i c2 = _mm_set1_epi32((int)stream[0]);
+		__m128i c3 = _mm_set1_epi32((int)stream[1]);
+		uint32_t k0 = key[0];
+		uint32_t k1 = key[1];
+		for (int round = 0; round < PHILOX_ROUNDS; round++)
+		{
+			if (round > 0)
+			{
+				k0 += PHILOX_W0;
+				k1 += PHILOX_W1;
+			}
+			__m128i hi0, lo0, hi1, lo1;
+			philoxMulSse2(c0, m0, hi0, lo0);
+			philoxMulSse2(c2, m1, hi1, lo1);
+			c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), _mm_set1_epi32((int)k0));
+			c1 = lo1;
+			c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), _mm_set1_epi32((int)k1));
+			c3 = lo0;
+		}
+		const __m128i t0 = _mm_unpacklo_epi32(c0, c1);
+		const __m128i t1 = _mm_unpacklo_epi32(c2, c3);
+		const __m128i t2 = _mm_unpackhi_epi32(c0, c1);
+		const __m128i t3 = _mm_unpackhi_epi32(c2, c3);
+		const std::size_t offset = b * 4;
+		philoxStoreSse2(_mm_unpacklo_epi64(t0, t1), outBits ? outBits + offset      : nullptr, outFloats ? outFloats + offset      : nullptr);
+		philoxStoreSse2(_mm_unpackhi_epi64(t0, t1), outBits ? outBits + offset + 4  : nullptr, outFloats ? outFloats + offset + 4  : nullptr);
+		philoxStoreSse2(_mm_unpacklo_epi64(t2, t3), outBits ? outBits + offset + 8  : nullptr, outFloats ? outFloats + offset + 8  : nullptr);
+		philoxStoreSse2(_mm_unpackhi_epi64(t2, t3), outBits ? outBits + offset + 12 : nullptr, outFloats ? outFloats + offset + 12 : nullptr);
+	}
+	return b;
+}
+#endif
+
+#ifdef BBE_CAN_DISPATCH_AVX2
+BBE_TARGET_AVX2 static inline void philoxMulAvx2(__m256i a, __m256i m, __m256i& hi, __m256i& lo)
+{
+	const __m256i even = _mm256_mul_epu32(a, m);
+	const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+	lo = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm256_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	hi = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)), _mm256_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+BBE_TARGET_AVX2 static inline void philoxStoreAvx2(__m256i value, uint32_t* outBits, float* outFloats)
+{
+	if (outBits != nullptr)
+	{
+		_mm256_storeu_si256((__m256i*)outBits, value);
+	}
+	if (outFloats != nullptr)
+	{
+		_mm256_storeu_ps(outFloats, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(value, 8)), _mm256_set1_ps(PHILOX_FLOAT_STEP)));
+	}
+}
+
+BBE_TARGET_AVX2 static std::size_t philoxAvx2(const uint32_t key[2], const uint32_t stream[2], uint64_t firstBlock, std::size_t blocks, uint32_t* outBits, float* outFloats)
+{
+	const __m256i m0 = _mm256_set1_epi32((int)PHILOX_M0);
+	const __m256i m1 = _mm256_set1_epi32((int)PHILOX_M1);
+	const __m256i laneOffsets = _mm256_set_epi64x(3, 2, 1, 0);
+	std::size_t b = 0;
+	for (; b + 8 <= blocks; b += 8)
+	{
+		//Blocks 0-3 in the low and 4-7 in the high half, each half transposes like the SSE2 kernel.
+		const uint64_t block = firstBlock + b;
+		const __m256i low = _mm256_add_epi64(_mm256_set1_epi64x((long long)block), laneOffsets);
+		const __m256i high = _mm256_add_epi64(_mm256_set1_epi64x((long long)(block + 4)), laneOffsets);
+		const __m256i counters0 = _mm256_permute2x128_si256(low, high, 0x20); //block 0 1 | 4 5
+		const __m256i counters1 = _mm256_permute2x128_si256(low, high, 0x31); //block 2 3 | 6 7
+		//Separate the 32 bit halves of the 64 bit counters.
+		const __m256i evens = _mm256_shuffle_epi32(counters0, _MM_SHUFFLE(3, 1, 2, 0)); //lo0 lo1 hi0 hi1 | lo4 lo5 hi4 hi5
+		const __m256i odds = _mm256_shuffle_epi32(counters1, _MM_SHUFFLE(3, 1, 2, 0));  //lo2 lo3 hi2 hi3 | lo6 lo7 hi6 hi7
+		__m256i c0 = _mm256_unpacklo_epi64(evens, odds);
+		__m256i c1 = _mm256_unpackhi_epi64(evens, odds);
+		__m256i c2 = _mm256_set1_epi32((int)stream[0]);
+		__m256i c3 = _mm256_set1_epi32((int)stream[1]);
+		uint32_t k0 = key[0];
+		uint32_t k1 = key[1];
+		for (int round = 0; round < PHILOX_ROUNDS; round++)
+		{
+			if (round > 0)
+			{
+				k0 += PHILOX_W0;
+				k1 += PHILOX_W1;
+			}
+			__m256i hi0, lo0, hi1, lo1;
+			philoxMulAvx2(c0, m0, hi0, lo0);
+			philoxMulAvx2(c2, m1, hi1, lo1);
+			c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32((int)k0));
+			c1 = lo1;
+			c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32((int)k1));
+			c3 = lo0;
+		}
+		const __m256i t0 = _mm256_unpacklo_epi32(c0, c1);
+		const __m256i t1 = _mm256_unpacklo_epi32(c2, c3);
+		const __m256i t2 = _mm256_unpackhi_epi32(c0, c1);
+		const __m256i t3 = _mm256_unpackhi_epi32(c2, c3);
+		const __m256i r0 = _mm256_unpacklo_epi64(t0, t1); //block 0 | 4
+		const __m256i r1 = _mm256_unpackhi_epi64(t0, t1); //block 1 | 5
+		const __m256i r2 = _mm256_unpacklo_epi64(t2, t3); //block 2 | 6
+		const __m256i r3 = _mm256_unpackhi_epi64(t2, t3); //block 3 | 7
+		const std::size_t offset = b * 4;
+		philoxStoreAvx2(_mm256_permute2x128_si256(r0, r1, 0x20), outBits ? outBits + offset      : nullptr, outFloats ? outFloats + offset      : nullptr);
+		philoxStoreAvx2(_mm256_permute2x128_si256(r2, r3, 0x20), outBits ? outBits + offset + 8  : nullptr, outFloats ? outFloats + offset + 8  : nullptr);
+		philoxStoreAvx2(_mm256_permute2x128_si256(r0, r1, 0x31), outBits ? outBits + offset + 16 : nullptr, outFloats ? outFloats + offset + 16 : nullptr);
+		philoxStoreAvx2(_mm256_permute2x128_si256(r2, r3, 0x31), outBits ? outBits + offset + 24 : nullptr, outFloats ? outFloats + offset + 24 : nullptr);
+	}
+	return b;
+}
+#endif
+
+static std::size_t philoxSimd(const uint32_t key[2], const uint32_t stream[2], uint64_t firstBlock, std::size_t blocks, uint32_t* outBits, float* outFloats)
+{
+	switch (bbe::getSimdLevel())
+	{
+#ifdef BBE_CAN_DISPATCH_AVX2
+	case bbe::SimdLevel::AVX2:
+		return philoxAvx2(key, stream, firstBlock, blocks, outBits, outFloats);
+#endif
+#ifdef BBE_USE_SSE2
+	case bbe::SimdLevel::SSE2:
+		return philoxSse2(key, stream, firstBlock, blocks, outBits, outFloats);
+#endif
+	default:
+		return 0;
+	}
+}
+
+//Either output may be nullptr. The values before the first and after the last whole block are done by the scalar code.
+static void philoxFill(const uint32_t key[2], const uint32_t stream[2], uint64_t firstIndex, std::size_t length, uint32_t* outBits, float* outFloats)
+{
+	std::size_t done = (std::size_t)((4 - firstIndex % 4) % 4);
+	if (done > length)
+	{
+		done = length;
+	}
+	philoxFillScalar(key, stream, firstIndex, done, outBits, outFloats);
+
+	const std::size_t blocks = (length - done) / 4;
+	if (blocks > 0)
+	{
+		const std::size_t blocksDone = philoxSimd(key, stream, (firstIndex + done) / 4, blocks, outBits ? outBits + done : nullptr, outFloats ? outFloats + done : nullptr);
+		done += blocksDone * 4;
+	}
+
+	philoxFillScalar(key, stream, firstIndex + done, length - done, outBits ? outBits + done : nullptr, outFloats ? outFloats + done : nullptr);
+}
+
+bbe::Philox4x32::Philox4x32(uint64_t seed, uint64_t stream)
+{
+	m_key[0] = (uint32_t)seed;
+	m_key[1] = (uint32_t)(seed >> 32);
+	m_stream[0] = (uint32_t)stream;
+	m_stream[1] = (uint32_t)(stream >> 32);
+}
+
+void bbe::Philox4x32::getBlock(uint64_t blockIndex, uint32_t outValues[4]) const
+{
+	philoxBlock(m_key, m_stream, blockIndex, outValues);
+}
+
+uint32_t bbe::Philox4x32::getUInt(uint64_t index) const
+{
+	uint32_t block[4];
+	philoxBlock(m_key, m_stream, index / 4, block);
+	return block[index % 4];
+}
+
+float bbe::Philox4x32::getFloat(uint64_t index) const
+{
+	return philoxToFloat(getUInt(index));
+}
+
+void bbe::Philox4x32::fill(uint64_t firstIndex, Span<uint32_t> out) const
+{
+	philoxFill(m_key, m_stream, firstIndex, out.getLength(), out.getRaw(), nullptr);
+}
+
+void bbe::Philox4x32::fill(uint64_t firstIndex, Span<float> out) const
+{
+	philoxFill(m_key, m_stream, firstIndex, out.getLength(), nullptr, out.getRaw());
+}
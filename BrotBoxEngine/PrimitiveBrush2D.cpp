@@ -435,6 +435,11 @@ void bbe::PrimitiveBrush2D::fillLine(const Line2& line, float lineWidth)
 }
 
 void bbe::PrimitiveBrush2D::fillLineStrip(const bbe::List<bbe::Vector2> &points, bool closed, float lineWidth)
+{
+	fillLineStrip(bbe::Span<const bbe::Vector2>(points.getRaw(), points.getLength()), closed, lineWidth);
+}
+
+void bbe::PrimitiveBrush2D::fillLineStrip(bbe::Span<const bbe::Vector2> points, bool closed, float lineWidth)
 {
 	for (size_t i = 1; i < points.getLength(); i++)
 	{
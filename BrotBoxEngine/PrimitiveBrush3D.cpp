@@ -178,7 +178,7 @@ void bbe::PrimitiveBrush3D::drawTerrain(const Terrain& terrain)
 	public:
 		Matrix4 mat;
 		float height;
-	}pushConts;
+	}pushConts;	//Padded to the alignment of Matrix4, only the first sizeof(Matrix4) + sizeof(float) bytes are pushed.
 
 	class PushContsFragmentShader
 	{
@@ -195,7 +195,7 @@ void bbe::PrimitiveBrush3D::drawTerrain(const Terrain& terrain)
 
 	pushConts.height = terrain.getMaxHeight();
 	pushConts.mat = terrain.m_transform;
-	vkCmdPushConstants(m_currentCommandBuffer, m_layoutTerrain, VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, sizeof(PushContsFragmentShader), sizeof(PushConts), &(pushConts));
+	vkCmdPushConstants(m_currentCommandBuffer, m_layoutTerrain, VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT, sizeof(PushContsFragmentShader), sizeof(Matrix4) + sizeof(float), &(pushConts));
 	vkCmdPushConstants(m_currentCommandBuffer, m_layoutTerrain, VK_SHADER_STAGE_VERTEX_BIT, 108, sizeof(float), &terrain.m_patchSize);
 
 	vkCmdPushConstants(m_currentCommandBuffer, m_layoutTerrain, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(PushContsFragmentShader), &(pushContsFragmenShader));
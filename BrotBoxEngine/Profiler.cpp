@@ -1,4 +1,6 @@
 #include "BBE/Profiler.h"
+#include "BBE/AllocatorTelemetry.h"
+#include "imgui.h"
 
 static float renderTime = 0;
 static float cpuTime = 0;
@@ -13,6 +15,54 @@ float bbe::Profiler::getCPUTime()
 	return cpuTime;
 }
 
+static void addAllocatorStatistics(const bbe::AllocatorTelemetry& telemetry, void* userData)
+{
+	bbe::Profiler::AllocatorStatistics statistics;
+	statistics.name = telemetry.getName();
+	statistics.liveBytes = telemetry.getLiveBytes();
+	statistics.peakBytes = telemetry.getPeakBytes();
+	statistics.capacityBytes = telemetry.getCapacityBytes();
+	statistics.amountOfAllocations = telemetry.getAmountOfAllocations();
+	statistics.amountOfDeallocations = telemetry.getAmountOfDeallocations();
+	statistics.amountOfFailedAllocations = telemetry.getAmountOfFailedAllocations();
+	statistics.amountOfAllocationsLastFrame = telemetry.getAmountOfAllocationsLastFrame();
+	static_cast<bbe::List<bbe::Profiler::AllocatorStatistics>*>(userData)->add(statistics);
+}
+
+bbe::List<bbe::Profiler::AllocatorStatistics> bbe::Profiler::getAllocatorStatistics()
+{
+	bbe::List<AllocatorStatistics> retVal;
+	bbe::INTERNAL::forEachAllocatorTelemetry(addAllocatorStatistics, &retVal);
+	return retVal;
+}
+
+void bbe::Profiler::drawAllocatorStatisticsWindow()
+{
+	const bbe::List<AllocatorStatistics> statistics = getAllocatorStatistics();
+	ImGui::Begin("Allocators");
+	ImGui::Columns(8, "AllocatorColumns");
+	ImGui::Separator();
+	for (const char* header : { "Name", "Live Bytes", "Peak Bytes", "Capacity", "Allocations", "Deallocations", "Failed", "Last Frame" })
+	{
+		ImGui::TextUnformatted(header);
+		ImGui::NextColumn();
+	}
+	ImGui::Separator();
+	for (const AllocatorStatistics& s : statistics)
+	{
+		ImGui::TextUnformatted(s.name.getRaw()); ImGui::NextColumn();
+		ImGui::Text("%zu", s.liveBytes); ImGui::NextColumn();
+		ImGui::Text("%zu", s.peakBytes); ImGui::NextColumn();
+		ImGui::Text("%zu", s.capacityBytes); ImGui::NextColumn();
+		ImGui::Text("%zu", s.amountOfAllocations); ImGui::NextColumn();
+		ImGui::Text("%zu", s.amountOfDeallocations); ImGui::NextColumn();
+		ImGui::Text("%zu", s.amountOfFailedAllocations); ImGui::NextColumn();
+		ImGui::Text("%zu", s.amountOfAllocationsLastFrame); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+	ImGui::End();
+}
+
 void bbe::Profiler::INTERNAL::setRenderTime(float time)
 {
 	renderTime = time;
@@ -22,3 +72,8 @@ void bbe::Profiler::INTERNAL::setCPUTime(float time)
 {
 	cpuTime = time;
 }
+
+void bbe::Profiler::INTERNAL::endFrame()
+{
+	bbe::INTERNAL::endAllocatorTelemetryFrame();
+}
@@ -112,7 +112,7 @@ bbe::Vector2 bbe::Rectangle::getCenter() const
 	);
 }
 
-void bbe::Rectangle::getVertices(bbe::List<bbe::Vector2>& outVertices) const
+void bbe::Rectangle::getVertices(VertexList& outVertices) const
 {
 	outVertices.clear();
 
@@ -115,7 +115,7 @@ bbe::Vector2 bbe::RectangleRotated::getCenter() const
 		m_y + m_height/2.0f);
 }
 
-void bbe::RectangleRotated::getVertices(bbe::List<bbe::Vector2>& outVertices) const
+void bbe::RectangleRotated::getVertices(VertexList& outVertices) const
 {
 	outVertices.clear();
 
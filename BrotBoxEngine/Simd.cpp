@@ -0,0 +1,65 @@
+#include "BBE/Simd.h"
+#include <atomic>
+
+#if defined(BBE_CAN_DISPATCH_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		static SimdLevel detectSimdLevel()
+		{
+#if defined(BBE_CAN_DISPATCH_AVX2) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+			__cpuid(info, 0);
+			if (osSavesYmm && info[0] >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				if ((info[1] & (1 << 5)) != 0)
+				{
+					return SimdLevel::AVX2;
+				}
+			}
+#elif defined(BBE_CAN_DISPATCH_AVX2)
+			//Also checks that the OS saves the AVX registers.
+			if (__builtin_cpu_supports("avx2"))
+			{
+				return SimdLevel::AVX2;
+			}
+#endif
+#ifdef BBE_USE_SSE2
+			return SimdLevel::SSE2;
+#else
+			return SimdLevel::SCALAR;
+#endif
+		}
+
+		static SimdLevel getSupportedSimdLevel()
+		{
+			static const SimdLevel supported = detectSimdLevel();
+			return supported;
+		}
+
+		static std::atomic<SimdLevel>& getCurrentSimdLevel()
+		{
+			static std::atomic<SimdLevel> current(getSupportedSimdLevel());
+			return current;
+		}
+	}
+}
+
+bbe::SimdLevel bbe::getSimdLevel()
+{
+	return INTERNAL::getCurrentSimdLevel().load(std::memory_order_relaxed);
+}
+
+void bbe::setSimdLevel(SimdLevel level)
+{
+	const SimdLevel supported = INTERNAL::getSupportedSimdLevel();
+	INTERNAL::getCurrentSimdLevel().store(level > supported ? supported : level, std::memory_order_relaxed);
+}
@@ -1,7 +1,10 @@
 #include "BBE/String.h"
 #include "BBE/DataType.h"
 #include "BBE/Exceptions.h"
+#include "BBE/Simd.h"
 #include <string>
+#include <charconv>
+#include <limits>
 
 void bbe::Utf8String::growIfNeeded(std::size_t newSize)
 {
@@ -27,8 +30,12 @@ void bbe::Utf8String::growIfNeeded(std::size_t newSize)
 
 void bbe::Utf8String::initializeFromCharArr(const char* data)
 {
-	m_length = utf8len(data);
+	if (data == nullptr)
+	{
+		throw NullPointerException();
+	}
 	auto amountOfByte = strlen(data);
+	m_length = utf8len(data, amountOfByte);
 
 	if(amountOfByte < BBE_UTF8STRING_SSOSIZE - 1)
 	{
@@ -43,6 +50,80 @@ void bbe::Utf8String::initializeFromCharArr(const char* data)
 		m_usesSSO = false;
 		m_capacity = amountOfByte + 1;
 	}
+	onContentChanged(amountOfByte);
+}
+
+void bbe::Utf8String::onContentChanged(std::size_t lengthBytes)
+{
+	m_isAscii = m_length == lengthBytes;
+	dropBreadcrumbs();
+}
+
+void bbe::Utf8String::dropBreadcrumbs()
+{
+	//Only called by mutators, which must not run concurrently with anything else on this string.
+	std::size_t* breadcrumbs = m_pbreadcrumbs.load(std::memory_order_relaxed);
+	if (breadcrumbs != nullptr)
+	{
+		delete[] breadcrumbs;
+		m_pbreadcrumbs.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+const std::size_t* bbe::Utf8String::getBreadcrumbs() const
+{
+	std::size_t* breadcrumbs = m_pbreadcrumbs.load(std::memory_order_acquire);
+	if (breadcrumbs != nullptr)
+	{
+		return breadcrumbs;
+	}
+
+	breadcrumbs = new std::size_t[m_length / BBE_UTF8STRING_BREADCRUMB_DISTANCE + 1];
+	const char* raw = getRaw();
+	std::size_t codePoint = 0;
+	for (std::size_t i = 0; raw[i] != 0; i++)
+	{
+		if ((raw[i] & 0b11000000) != 0b10000000)
+		{
+			if (codePoint % BBE_UTF8STRING_BREADCRUMB_DISTANCE == 0)
+			{
+				breadcrumbs[codePoint / BBE_UTF8STRING_BREADCRUMB_DISTANCE] = i;
+			}
+			codePoint++;
+		}
+	}
+
+	std::size_t* published = nullptr;
+	if (!m_pbreadcrumbs.compare_exchange_strong(published, breadcrumbs, std::memory_order_acq_rel, std::memory_order_acquire))
+	{
+		//Another thread built the same breadcrumbs first.
+		delete[] breadcrumbs;
+		return published;
+	}
+	return breadcrumbs;
+}
+
+std::size_t bbe::Utf8String::getByteOffsetOfCodePoint(std::size_t index) const
+{
+	if (m_isAscii)
+	{
+		return index;
+	}
+
+	const char* raw = getRaw();
+	std::size_t offset = 0;
+	std::size_t codePoint = 0;
+	if (index >= BBE_UTF8STRING_BREADCRUMB_DISTANCE)
+	{
+		const std::size_t breadcrumb = index / BBE_UTF8STRING_BREADCRUMB_DISTANCE;
+		offset = getBreadcrumbs()[breadcrumb];
+		codePoint = breadcrumb * BBE_UTF8STRING_BREADCRUMB_DISTANCE;
+	}
+	for (; codePoint < index; codePoint++)
+	{
+		offset += utf8charlen(raw + offset);
+	}
+	return offset;
 }
 
 bbe::Utf8String::Utf8String()
@@ -57,6 +138,15 @@ bbe::Utf8String::Utf8String(const char* data)
 	initializeFromCharArr(data);
 }
 
+//Large enough for any 64 bit integer including sign and null terminator.
+static constexpr size_t INTEGER_BUFFER_SIZE = 24;
+
+template <typename T>
+static void integerToChars(char (&buffer)[INTEGER_BUFFER_SIZE], T number)
+{
+	*std::to_chars(buffer, buffer + INTEGER_BUFFER_SIZE - 1, number).ptr = 0;
+}
+
 bbe::Utf8String::Utf8String(char c)
 {
 	char arr[] = { c, 0 };
@@ -72,13 +162,17 @@ bbe::Utf8String::Utf8String(double number)
 bbe::Utf8String::Utf8String(int number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
 }
 
 bbe::Utf8String::Utf8String(long long number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
 }
 
 bbe::Utf8String::Utf8String(long double number)
@@ -96,25 +190,52 @@ bbe::Utf8String::Utf8String(float number)
 bbe::Utf8String::Utf8String(unsigned long long number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
 }
 
 bbe::Utf8String::Utf8String(unsigned long number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
 }
 
 bbe::Utf8String::Utf8String(long number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
 }
 
 bbe::Utf8String::Utf8String(unsigned int number)
 {
 	//UNTESTED
-	initializeFromCharArr(std::to_string(number).c_str());
+	char buffer[INTEGER_BUFFER_SIZE];
+	integerToChars(buffer, number);
+	initializeFromCharArr(buffer);
+}
+
+bbe::Utf8String::Utf8String(const Utf8StringView& view)
+{
+	m_length = view.getLength();
+	if (view.getLengthBytes() < BBE_UTF8STRING_SSOSIZE - 1)
+	{
+		m_usesSSO = true;
+		m_capacity = BBE_UTF8STRING_SSOSIZE;
+	}
+	else
+	{
+		m_UNION.m_pdata = new char[view.getLengthBytes() + 1];
+		m_usesSSO = false;
+		m_capacity = view.getLengthBytes() + 1;
+	}
+	memcpy(getRaw(), view.getRaw(), view.getLengthBytes());
+	getRaw()[view.getLengthBytes()] = 0;
+	onContentChanged(view.getLengthBytes());
 }
 
 bbe::Utf8String::Utf8String(const Utf8String& other)//Copy Constructor
@@ -127,6 +248,7 @@ bbe::Utf8String::Utf8String(Utf8String&& other) //Move Constructor
 {
 	//UNTESTED
 	m_length = other.m_length;
+	m_isAscii = other.m_isAscii;
 	m_usesSSO = other.m_usesSSO;
 	if (m_usesSSO)
 	{
@@ -139,6 +261,7 @@ bbe::Utf8String::Utf8String(Utf8String&& other) //Move Constructor
 		m_capacity = other.m_capacity;
 		other.m_UNION.m_pdata = nullptr;
 	}
+	m_pbreadcrumbs.store(other.m_pbreadcrumbs.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
 	other.m_length = 0;
 }
 
@@ -164,6 +287,7 @@ bbe::Utf8String& bbe::Utf8String::operator=(Utf8String &&other)//Move Assignment
 	}
 	
 	m_length = other.m_length;
+	m_isAscii = other.m_isAscii;
 	m_usesSSO = other.m_usesSSO;
 	if (m_usesSSO)
 	{
@@ -176,6 +300,8 @@ bbe::Utf8String& bbe::Utf8String::operator=(Utf8String &&other)//Move Assignment
 		m_capacity = other.m_capacity;
 		other.m_UNION.m_pdata = nullptr;
 	}
+	dropBreadcrumbs();
+	m_pbreadcrumbs.store(other.m_pbreadcrumbs.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
 	other.m_length = 0;
 	return *this;
 }
@@ -188,6 +314,7 @@ bbe::Utf8String::~Utf8String()
 		delete[] m_UNION.m_pdata;
 		m_UNION.m_pdata = nullptr;
 	}
+	dropBreadcrumbs();
 }
 
 bool bbe::Utf8String::operator==(const Utf8String& other) const
@@ -209,17 +336,350 @@ namespace bbe
 bbe::Utf8StringView::Utf8StringView()
 {
 }
-bbe::Utf8StringView::Utf8StringView(const Utf8String& string, std::size_t m_start, std::size_t m_end)
-	:m_pstring(&string), m_start(m_start), m_end(m_end)
+bbe::Utf8StringView::Utf8StringView(const char* data)
+	:m_pdata(data), m_lengthBytes(strlen(data))
+{
+}
+bbe::Utf8StringView::Utf8StringView(const char* data, std::size_t lengthBytes)
+	:m_pdata(data), m_lengthBytes(lengthBytes)
+{
+}
+bbe::Utf8StringView::Utf8StringView(const Utf8String& string)
+	:m_pdata(string.getRaw()), m_lengthBytes(string.getLengthBytes())
+{
+}
+
+bool bbe::Utf8StringView::operator==(const Utf8StringView& other) const
+{
+	return m_lengthBytes == other.m_lengthBytes && (m_lengthBytes == 0 || memcmp(m_pdata, other.m_pdata, m_lengthBytes) == 0);
+}
+
+bool bbe::Utf8StringView::operator!=(const Utf8StringView& other) const
+{
+	return !operator==(other);
+}
+
+namespace bbe
+{
+	std::ostream& operator<<(std::ostream& os, const bbe::Utf8StringView& view)
+	{
+		return os.write(view.getRaw(), view.getLengthBytes());
+	}
+}
+
+//Views aren't null terminated and may end in the middle of a code point. Returns the length of the
+//code point at ptr if it fits before end, otherwise (and for bytes that can't start a code point)
+//the byte is treated as one opaque char of length 1 and outIsComplete is false.
+static std::size_t utf8CharLengthWithin(const char* ptr, const char* end, bool& outIsComplete)
+{
+	const bbe::byte lead = static_cast<bbe::byte>(*ptr);
+	std::size_t length = 0;
+	if      ((lead & 0b10000000) == 0b00000000) length = 1;
+	else if ((lead & 0b11100000) == 0b11000000) length = 2;
+	else if ((lead & 0b11110000) == 0b11100000) length = 3;
+	else if ((lead & 0b11111000) == 0b11110000) length = 4;
+	if (length == 0 || length > static_cast<std::size_t>(end - ptr))
+	{
+		outIsComplete = false;
+		return 1;
+	}
+	outIsComplete = true;
+	return length;
+}
+
+static bool utf8IsWhitespaceWithin(const char* ptr, const char* end)
+{
+	bool isComplete;
+	utf8CharLengthWithin(ptr, end, isComplete);
+	//utf8IsWhitespace only reads as many bytes as the lead byte announces.
+	return isComplete && bbe::utf8IsWhitespace(ptr);
+}
+
+bbe::Utf8StringView bbe::Utf8StringView::trimView() const
+{
+	const char* start = m_pdata;
+	const char* end = m_pdata + m_lengthBytes;
+	while (start < end && utf8IsWhitespaceWithin(start, end))
+	{
+		bool isComplete;
+		start += utf8CharLengthWithin(start, end, isComplete);
+	}
+	while (end > start)
+	{
+		const char* lastChar = end - 1;
+		while (lastChar > start && !utf8IsStartOfChar(lastChar))
+		{
+			lastChar--;
+		}
+		//Stray continuation bytes or a cut off sequence at the end are not whitespace.
+		bool isComplete;
+		if (lastChar + utf8CharLengthWithin(lastChar, end, isComplete) != end || !utf8IsWhitespaceWithin(lastChar, end))
+		{
+			break;
+		}
+		end = lastChar;
+	}
+	return Utf8StringView(start, end - start);
+}
+
+bbe::Utf8StringSplitView bbe::Utf8StringView::splitView(const Utf8StringView& splitAt) const
+{
+	return Utf8StringSplitView(*this, splitAt);
+}
+
+int64_t bbe::Utf8StringView::searchBytes(const Utf8StringView& string, std::size_t startByte) const
+{
+	if (string.m_lengthBytes == 0 || string.m_lengthBytes > m_lengthBytes)
+	{
+		return -1;
+	}
+	const char* const lastStart = m_pdata + m_lengthBytes - string.m_lengthBytes;
+	for (const char* ptr = m_pdata + startByte; ptr <= lastStart; ptr++)
+	{
+		//memchr finds the candidates for the first byte much faster than a byte by byte loop.
+		ptr = static_cast<const char*>(memchr(ptr, string.m_pdata[0], lastStart - ptr + 1));
+		if (ptr == nullptr)
+		{
+			return -1;
+		}
+		if (memcmp(ptr, string.m_pdata, string.m_lengthBytes) == 0)
+		{
+			return ptr - m_pdata;
+		}
+	}
+	return -1;
+}
+
+bool bbe::Utf8StringView::startsWith(const Utf8StringView& string) const
+{
+	return string.m_lengthBytes <= m_lengthBytes && (string.m_lengthBytes == 0 || memcmp(m_pdata, string.m_pdata, string.m_lengthBytes) == 0);
+}
+
+//Mimics strtol and strtod, which skip leading whitespace and accept a plus sign,
+//but the view isn't null terminated, so std::from_chars does the parsing.
+static const char* skipNumberPrefix(const char* ptr, const char* end)
+{
+	while (ptr < end && (*ptr == ' ' || (*ptr >= '\t' && *ptr <= '\r')))
+	{
+		ptr++;
+	}
+	if (ptr < end && *ptr == '+' && (ptr + 1 == end || ptr[1] != '-'))
+	{
+		ptr++;
+	}
+	return ptr;
+}
+
+long bbe::Utf8StringView::toLong(int base) const
+{
+	if (base != 0 && (base < 2 || base > 36))
+	{
+		throw IllegalArgumentException();
+	}
+	const char* end = m_pdata + m_lengthBytes;
+	const char* ptr = skipNumberPrefix(m_pdata, end);
+	const bool negative = ptr < end && *ptr == '-';
+	if (negative)
+	{
+		ptr++;
+	}
+	const bool hexPrefix = end - ptr >= 2 && ptr[0] == '0' && (ptr[1] == 'x' || ptr[1] == 'X');
+	if (base == 0)
+	{
+		//Like strtol: 0x selects hexadecimal, a leading 0 octal.
+		base = hexPrefix ? 16 : (ptr < end && *ptr == '0' ? 8 : 10);
+	}
+	if (base == 16 && hexPrefix)
+	{
+		ptr += 2;
+	}
+
+	//from_chars doesn't accept a prefix after the sign, so the sign is applied here.
+	unsigned long magnitude = 0;
+	if (std::from_chars(ptr, end, magnitude, base).ec != std::errc())
+	{
+		return 0;
+	}
+	if (negative)
+	{
+		return magnitude - 1 <= (unsigned long)std::numeric_limits<long>::max() ? -(long)(magnitude - 1) - 1 : 0;
+	}
+	return magnitude <= (unsigned long)std::numeric_limits<long>::max() ? (long)magnitude : 0;
+}
+
+double bbe::Utf8StringView::toDouble() const
+{
+	const char* end = m_pdata + m_lengthBytes;
+	double value = 0;
+	if (std::from_chars(skipNumberPrefix(m_pdata, end), end, value).ec != std::errc())
+	{
+		return 0;
+	}
+	return value;
+}
+
+float bbe::Utf8StringView::toFloat() const
+{
+	const char* end = m_pdata + m_lengthBytes;
+	float value = 0;
+	if (std::from_chars(skipNumberPrefix(m_pdata, end), end, value).ec != std::errc())
+	{
+		return 0;
+	}
+	return value;
+}
+
+const char* bbe::Utf8StringView::getRaw() const
+{
+	return m_pdata;
+}
+
+std::size_t bbe::Utf8StringView::getLength() const
+{
+	return utf8len(m_pdata, m_lengthBytes);
+}
+
+std::size_t bbe::Utf8StringView::getLengthBytes() const
+{
+	return m_lengthBytes;
+}
+
+bool bbe::Utf8StringView::isEmpty() const
+{
+	return m_lengthBytes == 0;
+}
+
+bbe::Utf8StringSplitView::Iterator::Iterator()
+{
+}
+
+bbe::Utf8StringSplitView::Iterator::Iterator(const Utf8StringView& string, const Utf8StringView& splitAt)
+	:m_ptokenStart(string.getRaw()), m_pend(string.getRaw() + string.getLengthBytes()), m_splitAt(splitAt)
 {
+	if (m_ptokenStart == nullptr)
+	{
+		//A default constructed view still splits into one empty token.
+		m_ptokenStart = "";
+		m_pend = m_ptokenStart;
+	}
+	findTokenEnd();
+}
+
+void bbe::Utf8StringSplitView::Iterator::findTokenEnd()
+{
+	const int64_t found = Utf8StringView(m_ptokenStart, m_pend - m_ptokenStart).searchBytes(m_splitAt);
+	m_ptokenEnd = found == -1 ? m_pend : m_ptokenStart + found;
 }
-std::size_t bbe::Utf8StringView::getEnd() const
+
+bbe::Utf8StringView bbe::Utf8StringSplitView::Iterator::operator*() const
 {
-	if (m_end == (std::size_t) - 1)
+	return Utf8StringView(m_ptokenStart, m_ptokenEnd - m_ptokenStart);
+}
+
+bbe::Utf8StringSplitView::Iterator& bbe::Utf8StringSplitView::Iterator::operator++()
+{
+	if (m_ptokenEnd == m_pend)
 	{
-		return m_pstring->getLength();
+		m_ptokenStart = nullptr;
+		m_ptokenEnd = nullptr;
+		m_pend = nullptr;
+		return *this;
 	}
-	return m_end;
+	m_ptokenStart = m_ptokenEnd + m_splitAt.getLengthBytes();
+	findTokenEnd();
+	return *this;
+}
+
+bool bbe::Utf8StringSplitView::Iterator::operator==(const Iterator& other) const
+{
+	return m_ptokenStart == other.m_ptokenStart;
+}
+
+bool bbe::Utf8StringSplitView::Iterator::operator!=(const Iterator& other) const
+{
+	return !operator==(other);
+}
+
+bbe::Utf8StringSplitView::Utf8StringSplitView(const Utf8StringView& string, const Utf8StringView& splitAt)
+	:m_string(string), m_splitAt(splitAt)
+{
+}
+
+bbe::Utf8StringSplitView::Iterator bbe::Utf8StringSplitView::begin() const
+{
+	return Iterator(m_string, m_splitAt);
+}
+
+bbe::Utf8StringSplitView::Iterator bbe::Utf8StringSplitView::end() const
+{
+	return Iterator();
+}
+
+bbe::Utf8StringTokenizer::Utf8StringTokenizer(const Utf8StringView& string)
+	:m_pcurrent(string.getRaw()), m_pend(string.getRaw() + string.getLengthBytes())
+{
+}
+
+bbe::Utf8StringTokenizer::Utf8StringTokenizer(const Utf8StringView& string, const Utf8StringView& delimiters)
+	:m_pcurrent(string.getRaw()), m_pend(string.getRaw() + string.getLengthBytes()), m_delimiters(delimiters)
+{
+}
+
+bool bbe::Utf8StringTokenizer::isDelimiter(const char* ptr, std::size_t charLength, bool isComplete) const
+{
+	if (m_delimiters.isEmpty())
+	{
+		return isComplete && utf8IsWhitespace(ptr);
+	}
+	const char* delimiter = m_delimiters.getRaw();
+	const char* delimitersEnd = delimiter + m_delimiters.getLengthBytes();
+	while (delimiter < delimitersEnd)
+	{
+		bool isDelimiterComplete;
+		const std::size_t delimiterLength = utf8CharLengthWithin(delimiter, delimitersEnd, isDelimiterComplete);
+		if (delimiterLength == charLength && isDelimiterComplete == isComplete && memcmp(delimiter, ptr, charLength) == 0)
+		{
+			return true;
+		}
+		delimiter += delimiterLength;
+	}
+	return false;
+}
+
+bool bbe::Utf8StringTokenizer::next(Utf8StringView& outToken)
+{
+	bool isComplete = false;
+	std::size_t charLength = 0;
+	while (m_pcurrent < m_pend)
+	{
+		charLength = utf8CharLengthWithin(m_pcurrent, m_pend, isComplete);
+		if (!isDelimiter(m_pcurrent, charLength, isComplete))
+		{
+			break;
+		}
+		m_pcurrent += charLength;
+	}
+	if (m_pcurrent >= m_pend)
+	{
+		return false;
+	}
+	const char* tokenStart = m_pcurrent;
+	do
+	{
+		m_pcurrent += charLength;
+		if (m_pcurrent >= m_pend)
+		{
+			break;
+		}
+		charLength = utf8CharLengthWithin(m_pcurrent, m_pend, isComplete);
+	} while (!isDelimiter(m_pcurrent, charLength, isComplete));
+	outToken = Utf8StringView(tokenStart, m_pcurrent - tokenStart);
+	return true;
+}
+
+bbe::Utf8StringView bbe::Utf8StringTokenizer::getRemaining() const
+{
+	return Utf8StringView(m_pcurrent, m_pend - m_pcurrent);
 }
 
 bool bbe::Utf8String::operator!=(const Utf8String& other) const
@@ -383,19 +843,20 @@ bbe::Utf8String& bbe::Utf8String::operator+=(const bbe::Utf8String& other)
 	growIfNeeded(totalLength + 1);
 	memcpy(getRaw() + oldLength, other.getRaw(), other.getLengthBytes());
 	getRaw()[totalLength] = 0;
+	onContentChanged(totalLength);
 
 	return *this;
 }
 
 bbe::Utf8String& bbe::Utf8String::operator+=(const bbe::Utf8StringView& other)
 {
-	//UNTESTED
-	const size_t totalLength = getLengthBytes() + other.getEnd() - other.m_start;
+	const size_t totalLength = getLengthBytes() + other.getLengthBytes();
 	const size_t oldLength = getLengthBytes();
-	m_length = getLength() + other.getEnd() - other.m_start + 1;
+	m_length = getLength() + other.getLength();
 	growIfNeeded(totalLength + 1);
-	memcpy(getRaw() + oldLength, other.m_pstring->getRaw() + other.m_start, other.getEnd() - other.m_start);
+	memcpy(getRaw() + oldLength, other.getRaw(), other.getLengthBytes());
 	getRaw()[totalLength] = 0;
+	onContentChanged(totalLength);
 
 	return *this;
 }
@@ -474,6 +935,11 @@ bbe::Utf8String bbe::Utf8String::trim() const
 	return copy;
 }
 
+bbe::Utf8StringView bbe::Utf8String::trimView() const
+{
+	return Utf8StringView(*this).trimView();
+}
+
 void bbe::Utf8String::trimInPlace()
 {
 	//UNTESTED
@@ -502,36 +968,47 @@ bbe::Utf8String bbe::Utf8String::substring(std::size_t start, std::size_t end) c
 
 void bbe::Utf8String::substringInPlace(size_t start, size_t end)
 {
-	//UNTESTED
+	//end is inclusive here.
+	if (m_length == 0)
+	{
+		return;
+	}
 	if(end > m_length - 1)
 	{
 		end = m_length - 1;
 	}
 	auto raw = getRaw();
-	if (start != 0 || end != m_length)
+	if (end == 0 || start > end) //Special Case, if the string only contains whitespace
+	{ 
+		m_length = 0;
+		raw[m_length] = 0;
+		onContentChanged(0);
+	}
+	else
 	{
-		if (end == 0) //Special Case, if the string only contains whitespace
-		{ 
-			m_length = 0;
-			raw[m_length] = 0;
-		}
-		else
-		{
-			std::size_t sizeOfSubstringInByte = 0;
-			for(std::size_t i = start; i<=end; i++)
-			{
-				sizeOfSubstringInByte += utf8charlen(&(*this)[i]);
-			}
-			memmove(raw, &raw[start], sizeOfSubstringInByte);
-			raw[sizeOfSubstringInByte] = 0;
-			m_length = end - start + 1;
-		}
+		const std::size_t startByte = getByteOffsetOfCodePoint(start);
+		const std::size_t endByte = getByteOffsetOfCodePoint(end + 1);
+		const std::size_t sizeOfSubstringInByte = endByte - startByte;
+		memmove(raw, &raw[startByte], sizeOfSubstringInByte);
+		raw[sizeOfSubstringInByte] = 0;
+		m_length = end - start + 1;
+		onContentChanged(sizeOfSubstringInByte);
 	}
 }
 
 bbe::Utf8StringView bbe::Utf8String::substringView(std::size_t start, std::size_t end) const
 {
-	return bbe::Utf8StringView(*this, start, end);
+	if (end > m_length)
+	{
+		end = m_length;
+	}
+	if (start > end)
+	{
+		start = end;
+	}
+	const std::size_t startByte = getByteOffsetOfCodePoint(start);
+	const std::size_t endByte = getByteOffsetOfCodePoint(end);
+	return bbe::Utf8StringView(getRaw() + startByte, endByte - startByte);
 }
 
 size_t bbe::Utf8String::count(const Utf8String& countand) const
@@ -561,42 +1038,19 @@ size_t bbe::Utf8String::count(const char* countand) const
 
 bbe::DynamicArray<bbe::Utf8String> bbe::Utf8String::split(const bbe::Utf8String& splitAt) const
 {
-	//UNTESTED
-	//TODO this method is a little mess. Clean it up!
-	size_t counted = count(splitAt);
-	if (counted == 0)
+	const Utf8StringSplitView tokens = splitView(splitAt);
+	size_t amountOfTokens = 0;
+	for (auto it = tokens.begin(); it != tokens.end(); ++it)
 	{
-		DynamicArray<Utf8String> retVal(1);
-		retVal[0] = getRaw();
-		return retVal;
+		amountOfTokens++;
 	}
-	DynamicArray<Utf8String> retVal(counted + 1);
-	auto previousFinding = getRaw();
-	for (size_t i = 0; i < retVal.getLength() - 1; i++)
+	DynamicArray<Utf8String> retVal(amountOfTokens);
+	size_t i = 0;
+	for (Utf8StringView token : tokens)
 	{
-		const char *currentFinding = strstr(previousFinding, splitAt.getRaw());
-		Utf8String currentString;
-		size_t currentStringLength = currentFinding - previousFinding;
-		currentString.m_usesSSO = false; //TODO make this better! current string could use SSO!
-		currentString.m_UNION.m_pdata = new char[currentStringLength + 1];
-		memcpy(currentString.m_UNION.m_pdata, previousFinding, currentStringLength);
-		currentString.m_UNION.m_pdata[currentStringLength] = 0;
-		currentString.m_length = currentStringLength;
-
-		retVal[i] = currentString;
-
-		previousFinding = currentFinding + splitAt.getLength();
+		retVal[i] = Utf8String(token);
+		i++;
 	}
-
-	Utf8String currentString;
-	size_t currentStringLength = m_UNION.m_pdata + m_length - previousFinding;
-	currentString.m_usesSSO = false; //TODO make this better! current string could use SSO!
-	currentString.m_UNION.m_pdata = new char[currentStringLength + 1];
-	memcpy(currentString.m_UNION.m_pdata, previousFinding, currentStringLength);
-	currentString.m_UNION.m_pdata[currentStringLength] = 0;
-	currentString.m_length = currentStringLength;
-	retVal[retVal.getLength() - 1] = currentString;
-
 	return retVal;
 }
 
@@ -606,6 +1060,11 @@ bbe::DynamicArray<bbe::Utf8String> bbe::Utf8String::split(const char* splitAt) c
 	return split(bbe::Utf8String(splitAt));
 }
 
+bbe::Utf8StringSplitView bbe::Utf8String::splitView(const Utf8StringView& splitAt) const
+{
+	return Utf8StringView(*this).splitView(splitAt);
+}
+
 bool bbe::Utf8String::contains(const char* string) const
 {
 	//UNTESTED
@@ -621,13 +1080,18 @@ bool bbe::Utf8String::contains(const Utf8String &string) const
 int64_t bbe::Utf8String::search(const char* string, int64_t startIndex) const
 {
 	//UNTESTED
-	const char* firstOcc = strstr(getRaw() + startIndex, string);
+	if (startIndex < 0 || static_cast<std::size_t>(startIndex) > m_length)
+	{
+		return -1;
+	}
+	const char* raw = getRaw();
+	const char* firstOcc = strstr(raw + getByteOffsetOfCodePoint(startIndex), string);
 	if(firstOcc == nullptr)
 	{
 		return -1;
 	}
 
-	return utf8Distance(getRaw(), firstOcc);
+	return utf8len(raw, firstOcc - raw);
 }
 
 int64_t bbe::Utf8String::search(const Utf8String &string, int64_t startIndex) const
@@ -659,17 +1123,14 @@ const char& bbe::Utf8String::operator[](std::size_t index) const
 	{
 		throw IllegalIndexException();
 	}
-	const char* ptr = getRaw();
-	for(size_t i = 0; i<index; i++)
-	{
-		ptr = bbe::utf8GetNextChar(ptr);
-	}
-	return *ptr;
+	return getRaw()[getByteOffsetOfCodePoint(index)];
 }
 
 char* bbe::Utf8String::getRaw()
 {
 	//UNTESTED
+	//The caller might change the bytes.
+	dropBreadcrumbs();
 	if(m_usesSSO)
 	{
 		return m_UNION.m_ssoData;
@@ -760,6 +1221,11 @@ std::size_t bbe::Utf8String::getCapacity() const
 	return m_capacity;
 }
 
+bool bbe::Utf8String::isAscii() const
+{
+	return m_isAscii;
+}
+
 bbe::Utf8String bbe::Utf8String::leftFill(char c, size_t length)
 {
 	bbe::String retVal = "";
@@ -779,28 +1245,15 @@ bbe::Utf8String bbe::Utf8String::leftFill(char c, size_t length)
 
 
 template<>
-uint32_t bbe::hash(const bbe::String & t)
+uint32_t bbe::hash(const bbe::Utf8StringView & t)
 {
-	//UNTESTED
-	//This function is based on the djb2 hashing algorithm by Dan Bernstein
-	//See: http://www.cse.yorku.ca/~oz/hash.html
-	//Changes to the original algorithm:
-	//  1. A 32 bit hash is used instead of a 64 bit hash
-	//  2. Only the first 128 chars are used for hashing
-	//  3. wchar_t is used instead of char
-	uint32_t _hash = 5381;
-	size_t length = t.getLength();
-	if (length > 128)
-	{
-		length = 128;
-	}
-
-	for (size_t i = 0; i < length; i++)
-	{
-		_hash = ((_hash << 5) + _hash) + t[i];
-	}
+	return bbe::INTERNAL::hashFold(bbe::hashBytes(t.getRaw(), t.getLengthBytes()));
+}
 
-	return _hash;
+template<>
+uint32_t bbe::hash(const bbe::String & t)
+{
+	return bbe::INTERNAL::hashFold(bbe::hashBytes(t.getRaw(), t.getLengthBytes()));
 }
 
 std::size_t bbe::utf8len(const char* ptr)
@@ -809,17 +1262,114 @@ std::size_t bbe::utf8len(const char* ptr)
 	{
 		throw NullPointerException();
 	}
-	std::size_t len = 0;
-	const byte* bptr = reinterpret_cast<const byte*>(ptr);
-	while(*bptr != (byte)0b00000000)
+	return utf8len(ptr, strlen(ptr));
+}
+
+std::size_t bbe::utf8len(const char* ptr, std::size_t lengthBytes)
+{
+	//Every byte except the continuation bytes (0b10xxxxxx) starts a code point.
+	std::size_t continuationBytes = 0;
+	std::size_t i = 0;
+#ifdef BBE_USE_SSE2
+	//As signed chars continuation bytes are exactly the ones smaller than -64 (0b11000000).
+	const __m128i threshold = _mm_set1_epi8(-64);
+	while (lengthBytes - i >= 16)
+	{
+		//Per byte counters, summed up before they can overflow.
+		__m128i counters = _mm_setzero_si128();
+		std::size_t blocks = (lengthBytes - i) / 16;
+		if (blocks > 255)
+		{
+			blocks = 255;
+		}
+		for (std::size_t k = 0; k < blocks; k++)
+		{
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + i));
+			counters = _mm_sub_epi8(counters, _mm_cmplt_epi8(bytes, threshold));
+			i += 16;
+		}
+		const __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+		continuationBytes += static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) + static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+	}
+#else
+	while (lengthBytes - i >= 8)
+	{
+		uint64_t word;
+		memcpy(&word, ptr + i, 8);
+		//Bit 7 set and bit 6 cleared. The shift moves bit 6 of every byte onto its bit 7.
+		const uint64_t continuations = (word & ~(word << 1) & 0x8080808080808080ull) >> 7;
+		continuationBytes += (continuations * 0x0101010101010101ull) >> 56;
+		i += 8;
+	}
+#endif
+	for (; i < lengthBytes; i++)
+	{
+		if ((ptr[i] & 0b11000000) == 0b10000000)
+		{
+			continuationBytes++;
+		}
+	}
+	return lengthBytes - continuationBytes;
+}
+
+bool bbe::utf8IsValid(const char* ptr, std::size_t lengthBytes)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(ptr);
+	std::size_t i = 0;
+	while (i < lengthBytes)
 	{
-		if(((*bptr) & (byte)0b11000000) != (byte)0b10000000)
+#ifdef BBE_USE_SSE2
+		if (lengthBytes - i >= 16 && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i))) == 0)
 		{
-			len++;
+			i += 16;
+			continue;
 		}
-		bptr++;
+#else
+		if (lengthBytes - i >= 8)
+		{
+			uint64_t word;
+			memcpy(&word, bytes + i, 8);
+			if ((word & 0x8080808080808080ull) == 0)
+			{
+				i += 8;
+				continue;
+			}
+		}
+#endif
+		const unsigned char lead = bytes[i];
+		if (lead < 0x80)
+		{
+			i++;
+			continue;
+		}
+
+		std::size_t charLength;
+		uint32_t codePoint;
+		uint32_t minCodePoint;
+		if      ((lead & 0b11100000) == 0b11000000) { charLength = 2; codePoint = lead & 0b00011111; minCodePoint = 0x80;    }
+		else if ((lead & 0b11110000) == 0b11100000) { charLength = 3; codePoint = lead & 0b00001111; minCodePoint = 0x800;   }
+		else if ((lead & 0b11111000) == 0b11110000) { charLength = 4; codePoint = lead & 0b00000111; minCodePoint = 0x10000; }
+		else return false;
+
+		if (lengthBytes - i < charLength)
+		{
+			return false;
+		}
+		for (std::size_t k = 1; k < charLength; k++)
+		{
+			if ((bytes[i + k] & 0b11000000) != 0b10000000)
+			{
+				return false;
+			}
+			codePoint = (codePoint << 6) | (bytes[i + k] & 0b00111111);
+		}
+		if (codePoint < minCodePoint || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+		{
+			return false;
+		}
+		i += charLength;
 	}
-	return len;
+	return true;
 }
 
 std::size_t bbe::utf8charlen(const char* ptr)
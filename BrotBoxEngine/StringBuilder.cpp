@@ -0,0 +1,266 @@
+#include "BBE/StringBuilder.h"
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+//Enough for any integer and for the shortest representation of any double.
+static constexpr std::size_t NUMBER_BUFFER_SIZE = 64;
+
+void bbe::StringBuilder::growIfNeeded(std::size_t additionalBytes)
+{
+	const std::size_t neededCapacity = m_lengthBytes + additionalBytes + 1;
+	if (neededCapacity > m_capacity)
+	{
+		std::size_t newCapacity = m_capacity < STRING_BUILDER_MIN_CAPACITY ? STRING_BUILDER_MIN_CAPACITY : m_capacity * 2;
+		while (newCapacity < neededCapacity)
+		{
+			newCapacity *= 2;
+		}
+		reserve(newCapacity);
+	}
+}
+
+template <typename T>
+bbe::StringBuilder& bbe::StringBuilder::appendInteger(T number)
+{
+	char buffer[NUMBER_BUFFER_SIZE];
+	const char* end = std::to_chars(buffer, buffer + NUMBER_BUFFER_SIZE, number).ptr;
+	return append(Utf8StringView(buffer, end - buffer));
+}
+
+template <typename T>
+bbe::StringBuilder& bbe::StringBuilder::appendFloatingPoint(T number, int precision)
+{
+	if (precision < 0)
+	{
+		char buffer[NUMBER_BUFFER_SIZE];
+		const char* end = std::to_chars(buffer, buffer + NUMBER_BUFFER_SIZE, number).ptr;
+		return append(Utf8StringView(buffer, end - buffer));
+	}
+
+	//Fixed notation of huge values needs every integer digit (309 for doubles), so it is
+	//written straight into the builder instead of a stack buffer. Sign, digits, point, decimals.
+	const std::size_t maxLengthBytes = 1 + (std::numeric_limits<T>::max_exponent10 + 1) + 1 + static_cast<std::size_t>(precision);
+	growIfNeeded(maxLengthBytes);
+	char* begin = m_pdata + m_lengthBytes;
+	const char* end = std::to_chars(begin, begin + maxLengthBytes, number, std::chars_format::fixed, precision).ptr;
+	m_lengthBytes = end - m_pdata;
+	m_pdata[m_lengthBytes] = 0;
+	return *this;
+}
+
+const char* bbe::StringBuilder::appendUntilPlaceholder(const char* fmt)
+{
+	const char* placeholder = strstr(fmt, "{}");
+	if (placeholder == nullptr)
+	{
+		append(fmt);
+		return nullptr;
+	}
+	append(Utf8StringView(fmt, placeholder - fmt));
+	return placeholder + 2;
+}
+
+bbe::StringBuilder::StringBuilder()
+{
+	//do nothing
+}
+
+bbe::StringBuilder::StringBuilder(std::size_t capacityBytes)
+{
+	reserve(capacityBytes);
+}
+
+bbe::StringBuilder::StringBuilder(const StringBuilder& other)
+{
+	append(other.getView());
+}
+
+bbe::StringBuilder::StringBuilder(StringBuilder&& other)
+	: m_pdata(other.m_pdata), m_lengthBytes(other.m_lengthBytes), m_capacity(other.m_capacity)
+{
+	other.m_pdata = nullptr;
+	other.m_lengthBytes = 0;
+	other.m_capacity = 0;
+}
+
+bbe::StringBuilder& bbe::StringBuilder::operator=(const StringBuilder& other)
+{
+	if (this != &other)
+	{
+		clear();
+		append(other.getView());
+	}
+	return *this;
+}
+
+bbe::StringBuilder& bbe::StringBuilder::operator=(StringBuilder&& other)
+{
+	if (this != &other)
+	{
+		delete[] m_pdata;
+		m_pdata = other.m_pdata;
+		m_lengthBytes = other.m_lengthBytes;
+		m_capacity = other.m_capacity;
+		other.m_pdata = nullptr;
+		other.m_lengthBytes = 0;
+		other.m_capacity = 0;
+	}
+	return *this;
+}
+
+bbe::StringBuilder::~StringBuilder()
+{
+	delete[] m_pdata;
+	m_pdata = nullptr;
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(const char* string)
+{
+	return append(Utf8StringView(string));
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(const Utf8StringView& string)
+{
+	const std::size_t lengthBytes = string.getLengthBytes();
+	const char* source = string.getRaw();
+	//The string may point into this builder (e.g. builder.append(builder.getView())), growing would free it.
+	const bool isOwnData = m_pdata != nullptr && source >= m_pdata && source < m_pdata + m_capacity;
+	const std::size_t sourceOffset = isOwnData ? source - m_pdata : 0;
+	growIfNeeded(lengthBytes);
+	if (isOwnData)
+	{
+		source = m_pdata + sourceOffset;
+	}
+	if (lengthBytes > 0)
+	{
+		memcpy(m_pdata + m_lengthBytes, source, lengthBytes);
+	}
+	m_lengthBytes += lengthBytes;
+	m_pdata[m_lengthBytes] = 0;
+	return *this;
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(const Utf8String& string)
+{
+	return append(Utf8StringView(string));
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(char c)
+{
+	return append(Utf8StringView(&c, 1));
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(bool value)
+{
+	return append(value ? "true" : "false");
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(int number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(unsigned int number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(long number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(unsigned long number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(long long number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(unsigned long long number)
+{
+	return appendInteger(number);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(float number)
+{
+	return appendFloatingPoint(number, -1);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::append(double number)
+{
+	return appendFloatingPoint(number, -1);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::appendFixed(float number, int decimals)
+{
+	return appendFloatingPoint(number, decimals);
+}
+
+bbe::StringBuilder& bbe::StringBuilder::appendFixed(double number, int decimals)
+{
+	return appendFloatingPoint(number, decimals);
+}
+
+void bbe::StringBuilder::clear()
+{
+	m_lengthBytes = 0;
+	if (m_pdata != nullptr)
+	{
+		m_pdata[0] = 0;
+	}
+}
+
+void bbe::StringBuilder::reserve(std::size_t capacityBytes)
+{
+	if (capacityBytes <= m_capacity)
+	{
+		return;
+	}
+	char* newData = new char[capacityBytes];
+	if (m_pdata != nullptr)
+	{
+		memcpy(newData, m_pdata, m_lengthBytes + 1);
+		delete[] m_pdata;
+	}
+	else
+	{
+		newData[0] = 0;
+	}
+	m_pdata = newData;
+	m_capacity = capacityBytes;
+}
+
+const char* bbe::StringBuilder::getRaw() const
+{
+	return m_pdata != nullptr ? m_pdata : "";
+}
+
+bbe::Utf8StringView bbe::StringBuilder::getView() const
+{
+	return Utf8StringView(getRaw(), m_lengthBytes);
+}
+
+bbe::Utf8String bbe::StringBuilder::toString() const
+{
+	return Utf8String(getView());
+}
+
+std::size_t bbe::StringBuilder::getLengthBytes() const
+{
+	return m_lengthBytes;
+}
+
+std::size_t bbe::StringBuilder::getCapacity() const
+{
+	return m_capacity;
+}
+
+bool bbe::StringBuilder::isEmpty() const
+{
+	return m_lengthBytes == 0;
+}
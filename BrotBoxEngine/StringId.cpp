@@ -0,0 +1,180 @@
+#include "BBE/StringId.h"
+#include "BBE/List.h"
+#include "BBE/HashMap.h"
+#include <cstring>
+#include <mutex>
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		static constexpr std::size_t STRING_ID_TEXT_BLOCK_SIZE = 4096;
+		static constexpr uint32_t    STRING_ID_NO_NEXT = 0;	//The empty string is always first, so it is never the next entry of a chain.
+
+		struct StringIdEntry
+		{
+			const char* m_pdata;
+			std::size_t m_lengthBytes;
+			uint64_t    m_hash;
+			uint32_t    m_nextWithSameHash;
+		};
+
+		struct StringIdTable
+		{
+			std::mutex mutex;
+			List<StringIdEntry> entries;
+			HashMap<uint64_t, uint32_t> firstEntryByHash;	//Entries with the same 64 bit hash are chained through m_nextWithSameHash.
+
+			//The text is copied into blocks that never move, so handed out pointers stay valid.
+			List<char*> textBlocks;
+			std::size_t textBlockUsed = STRING_ID_TEXT_BLOCK_SIZE;
+
+			StringIdTable()
+			{
+				const uint64_t emptyHash = stringIdHash("", 0);
+				entries.add(StringIdEntry{ "", 0, emptyHash, STRING_ID_NO_NEXT });
+				firstEntryByHash.add(emptyHash, 0);
+			}
+
+			~StringIdTable()
+			{
+				for (std::size_t i = 0; i < textBlocks.getLength(); i++)
+				{
+					delete[] textBlocks[i];
+				}
+			}
+
+			const char* storeText(const char* data, std::size_t lengthBytes)
+			{
+				const std::size_t neededBytes = lengthBytes + 1;
+				char* text = nullptr;
+				if (neededBytes > STRING_ID_TEXT_BLOCK_SIZE / 4)
+				{
+					//Big strings get their own block, so that the current block isn't wasted.
+					text = new char[neededBytes];
+					textBlocks.add(text);
+				}
+				else
+				{
+					if (textBlockUsed + neededBytes > STRING_ID_TEXT_BLOCK_SIZE)
+					{
+						textBlocks.add(new char[STRING_ID_TEXT_BLOCK_SIZE]);
+						textBlockUsed = 0;
+					}
+					text = textBlocks.last() + textBlockUsed;
+					textBlockUsed += neededBytes;
+				}
+				memcpy(text, data, lengthBytes);
+				text[lengthBytes] = 0;
+				return text;
+			}
+		};
+
+		//Function local static so that StringIds in other static objects can be
+		//created regardless of the initialization order.
+		static StringIdTable& getStringIdTable()
+		{
+			static StringIdTable table;
+			return table;
+		}
+	}
+}
+
+uint32_t bbe::StringId::intern(const char* data, std::size_t lengthBytes, uint64_t _hash)
+{
+	INTERNAL::StringIdTable& table = INTERNAL::getStringIdTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	uint32_t* first = table.firstEntryByHash.get(_hash);
+	if (first != nullptr)
+	{
+		uint32_t id = *first;
+		while (true)
+		{
+			const INTERNAL::StringIdEntry& entry = table.entries[id];
+			if (entry.m_lengthBytes == lengthBytes && memcmp(entry.m_pdata, data, lengthBytes) == 0)
+			{
+				return id;
+			}
+			if (entry.m_nextWithSameHash == INTERNAL::STRING_ID_NO_NEXT)
+			{
+				break;
+			}
+			id = entry.m_nextWithSameHash;
+		}
+	}
+
+	const uint32_t newId = static_cast<uint32_t>(table.entries.getLength());
+	table.entries.add(INTERNAL::StringIdEntry{ table.storeText(data, lengthBytes), lengthBytes, _hash, INTERNAL::STRING_ID_NO_NEXT });
+	if (first != nullptr)
+	{
+		//Collisions are rare enough that walking to the end of the chain is fine.
+		uint32_t id = *first;
+		while (table.entries[id].m_nextWithSameHash != INTERNAL::STRING_ID_NO_NEXT)
+		{
+			id = table.entries[id].m_nextWithSameHash;
+		}
+		table.entries[id].m_nextWithSameHash = newId;
+	}
+	else
+	{
+		table.firstEntryByHash.add(_hash, newId);
+	}
+	return newId;
+}
+
+bbe::StringId::StringId(const char* string)
+	: StringId(Utf8StringView(string))
+{
+	//do nothing
+}
+
+bbe::StringId::StringId(const Utf8StringView& string)
+	: m_id(intern(string.getRaw(), string.getLengthBytes(), INTERNAL::stringIdHash(string.getRaw(), string.getLengthBytes())))
+{
+	//do nothing
+}
+
+bbe::StringId::StringId(const Utf8String& string)
+	: StringId(Utf8StringView(string))
+{
+	//do nothing
+}
+
+bbe::StringId::StringId(const StringIdLiteral& literal)
+	: m_id(intern(literal.getRaw(), literal.getLengthBytes(), literal.getHash()))
+{
+	//do nothing
+}
+
+const char* bbe::StringId::getRaw() const
+{
+	INTERNAL::StringIdTable& table = INTERNAL::getStringIdTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	return table.entries[m_id].m_pdata;
+}
+
+bbe::Utf8StringView bbe::StringId::getView() const
+{
+	INTERNAL::StringIdTable& table = INTERNAL::getStringIdTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	const INTERNAL::StringIdEntry& entry = table.entries[m_id];
+	return Utf8StringView(entry.m_pdata, entry.m_lengthBytes);
+}
+
+bbe::Utf8String bbe::StringId::toString() const
+{
+	return Utf8String(getView());
+}
+
+std::size_t bbe::StringId::getAmountOfInternedStrings()
+{
+	INTERNAL::StringIdTable& table = INTERNAL::getStringIdTable();
+	std::lock_guard<std::mutex> lock(table.mutex);
+	return table.entries.getLength();
+}
+
+std::ostream& bbe::operator<<(std::ostream& os, const bbe::StringId& id)
+{
+	return os << id.getView();
+}
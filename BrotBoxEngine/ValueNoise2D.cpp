@@ -15,24 +15,23 @@ static int m_frequencyChange = 2;
 
 void bbe::ValueNoise2D::standardize()
 {
-	if (m_pdata == nullptr)
+	if (m_precalculated.getRaw() == nullptr)
 	{
 		throw IllegalStateException();
 	}
 	min = 100000000.0f;
 	max = -100000000.0f;
-	for (int i = 0; i < m_width * m_height; i++)
+	m_precalculated.forEach([&](int32_t /*x*/, int32_t /*y*/, float& val)
 	{
-		float val = m_pdata[i];
 		if (val < min) min = val;
 		if (val > max) max = val;
-	}
+	});
 
 	float maxMin = max - min;
-	for (int i = 0; i < m_width * m_height; i++)
+	m_precalculated.forEach([&](int32_t /*x*/, int32_t /*y*/, float& val)
 	{
-		m_pdata[i] = (m_pdata[i] - min) / maxMin;
-	}
+		val = (val - min) / maxMin;
+	});
 
 	wasStandardized = true;
 }
@@ -110,11 +109,7 @@ void bbe::ValueNoise2D::destroy()
 
 void bbe::ValueNoise2D::unload()
 {
-	if (m_pdata != nullptr)
-	{
-		delete[] m_pdata;
-		m_pdata = nullptr;
-	}
+	m_precalculated = Grid2D<float>();
 }
 
 float bbe::ValueNoise2D::get(int x, int y) const
@@ -128,9 +123,9 @@ float bbe::ValueNoise2D::get(int x, int y) const
 	if (x >= m_width) x = m_width - 1;
 	if (y >= m_height) y = m_height - 1;
 
-	if (m_pdata != nullptr)
+	if (m_precalculated.getRaw() != nullptr)
 	{
-		return m_pdata[y * m_width + x];
+		return m_precalculated.get(x, y);
 	}
 
 
@@ -178,27 +173,28 @@ float bbe::ValueNoise2D::get(int x, int y) const
 
 void bbe::ValueNoise2D::preCalculate()
 {
-	if (m_pdata != nullptr)
+	if (m_precalculated.getRaw() != nullptr)
 	{
 		throw IllegalStateException();
 	}
 
-	float *data = new float[m_width * m_height];
-
-	for (int i = 0; i < m_width; i++)
+	//Filled row by row, every thread writes its own band of rows.
+	Grid2D<float> data(m_width, m_height);
+	data.parallelForRows([&](int32_t y)
 	{
-		for (int k = 0; k < m_height; k++)
+		Span<float> row = data.getRow(y);
+		for (int32_t x = 0; x < m_width; x++)
 		{
-			data[k * m_width + i] = get(i, k);
+			row[x] = get(x, y);
 		}
-	}
+	});
 
-	m_pdata = data;
+	m_precalculated = std::move(data);
 }
 
 void bbe::ValueNoise2D::set(int x, int y, float val)
 {
-	if (m_pdata == nullptr)
+	if (m_precalculated.getRaw() == nullptr)
 	{
 		throw IllegalStateException();
 	}
@@ -206,14 +202,14 @@ void bbe::ValueNoise2D::set(int x, int y, float val)
 	{
 		throw NotInitializedException();
 	}
-	m_pdata[x + y * m_width] = val;
+	m_precalculated.get(x, y) = val;
 }
 
 float * bbe::ValueNoise2D::getRaw()
 {
-	if (m_pdata == nullptr)
+	if (m_precalculated.getRaw() == nullptr)
 	{
 		throw IllegalStateException();
 	}
-	return m_pdata;
+	return m_precalculated.getRaw();
 }
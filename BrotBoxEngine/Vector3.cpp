@@ -587,3 +587,9 @@ bbe::Vector3 bbe::Vector3::zzz() const
 {
 	return Vector3(z, z, z);
 }
+
+template<>
+uint32_t bbe::hash(const bbe::Vector3 & t)
+{
+	return bbe::hashCombine(bbe::hashCombine(bbe::hash(t.x), bbe::hash(t.y)), bbe::hash(t.z));
+}
@@ -5,28 +5,6 @@
 #include "BBE/Vector4.h"
 #include "BBE/Math.h"
 
-bbe::Vector4::Vector4()
-	: x(0), y(0), z(0), w(0)
-{
-	//UNTESTED
-}
-
-bbe::Vector4::Vector4(float xyzw)
-	: x(xyzw), y(xyzw), z(xyzw), w(xyzw)
-{
-}
-
-bbe::Vector4::Vector4(float xyz, float w)
-	: x(xyz), y(xyz), z(xyz), w(w)
-{
-}
-
-bbe::Vector4::Vector4(float x, float y, float z, float w)
-	: x(x), y(y), z(z), w(w)
-{
-	//UNTESTED
-}
-
 bbe::Vector4::Vector4(float x, float y, const bbe::Vector2 &zw)
 	: x(x), y(y), z(zw.x), w(zw.y)
 {
@@ -63,75 +41,6 @@ bbe::Vector4::Vector4(float x, const bbe::Vector3 &yzw)
 	//UNTESTED
 }
 
-bbe::Vector4 & bbe::Vector4::operator+=(const Vector4 & other)
-{
-	//UNTESTED
-	this->x += other.x;
-	this->y += other.y;
-	this->z += other.z;
-	this->w += other.w;
-	return *this;
-}
-
-bbe::Vector4 & bbe::Vector4::operator-=(const Vector4 & other)
-{
-	//UNTESTED
-	this->x -= other.x;
-	this->y -= other.y;
-	this->z -= other.z;
-	this->w -= other.w;
-	return *this;
-}
-
-bbe::Vector4 & bbe::Vector4::operator*=(const Vector4 & other)
-{
-	//UNTESTED
-	this->x *= other.x;
-	this->y *= other.y;
-	this->z *= other.z;
-	this->w *= other.w;
-	return *this;
-}
-
-bbe::Vector4 & bbe::Vector4::operator/=(const Vector4 & other)
-{
-	//UNTESTED
-	this->x /= other.x;
-	this->y /= other.y;
-	this->z /= other.z;
-	this->w /= other.w;
-	return *this;
-}
-
-bbe::Vector4 bbe::Vector4::operator+(const bbe::Vector4 & other) const
-{
-	//UNTESTED
-	return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
-}
-
-bbe::Vector4 bbe::Vector4::operator-(const Vector4 & other) const
-{
-	//UNTESTED
-	return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
-}
-
-bbe::Vector4 bbe::Vector4::operator-() const
-{
-	return Vector4(-x, -y, -z, -w);
-}
-
-bbe::Vector4 bbe::Vector4::operator*(float scalar) const
-{
-	//UNTESTED
-	return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
-}
-
-bbe::Vector4 bbe::Vector4::operator/(float scalar) const
-{
-	//UNTESTED
-	return Vector4(x / scalar, y / scalar, z / scalar, w / scalar);
-}
-
 float& bbe::Vector4::operator[](int index)
 {
 	//UNTESTED
@@ -0,0 +1,691 @@
+#include "BBE/VectorBatch.h"
+#include "BBE/Simd.h"
+#include "BBE/Exceptions.h"
+#include "BBE/UtilDebug.h"
+#include <cmath>
+
+#ifdef BBE_CAN_DISPATCH_AVX2
+#include <immintrin.h>
+#endif
+
+//The kernels work on the raw floats of the vectors. Each returns how many elements it processed,
+//the remaining ones (less than one SIMD register worth) are done by the scalar operators.
+//All of them do the same multiplications and additions in the same order as the scalar operators.
+
+static_assert(sizeof(bbe::Vector2) == sizeof(float) * 2, "Vector2 must be tightly packed!");
+static_assert(sizeof(bbe::Vector3) == sizeof(float) * 3, "Vector3 must be tightly packed!");
+
+namespace bbe
+{
+	namespace INTERNAL
+	{
+		static constexpr std::size_t BATCH_CHUNK_SIZE = 256;
+
+		static void checkBatchLengths(std::size_t inputLength, std::size_t outputLength)
+		{
+			if (outputLength < inputLength)
+			{
+				debugBreak();
+				throw IllegalArgumentException();
+			}
+		}
+
+#ifdef BBE_USE_SSE2
+		//[x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] <-> [x0 x1 x2 x3] [y0 y1 y2 y3] [z0 z1 z2 z3]
+		static inline void deinterleave3Sse2(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+		{
+			x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		static inline void interleave3Sse2(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+		{
+			a = _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+			b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		struct MatrixSse2
+		{
+			__m128 m[4][4]; //m[col][row], every lane holds the same value.
+
+			explicit MatrixSse2(const Matrix4& matrix)
+			{
+				for (int col = 0; col < 4; col++)
+				{
+					const Vector4 column = matrix.getColumn(col);
+					m[col][0] = _mm_set1_ps(column.x);
+					m[col][1] = _mm_set1_ps(column.y);
+					m[col][2] = _mm_set1_ps(column.z);
+					m[col][3] = _mm_set1_ps(column.w);
+				}
+			}
+
+			//Same as Matrix4 * Vector4(x, y, z, 1) followed by the division by w, for four points at once.
+			void transform(__m128& x, __m128& y, __m128& z) const
+			{
+				__m128 result[4];
+				for (int row = 0; row < 4; row++)
+				{
+					result[row] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][row], x), _mm_mul_ps(m[1][row], y)), _mm_mul_ps(m[2][row], z)), m[3][row]);
+				}
+				x = _mm_div_ps(result[0], result[3]);
+				y = _mm_div_ps(result[1], result[3]);
+				z = _mm_div_ps(result[2], result[3]);
+			}
+		};
+
+		static std::size_t dot2Sse2(const float* vectors, std::size_t length, const Vector2& other, float* out)
+		{
+			const __m128 ox = _mm_set1_ps(other.x);
+			const __m128 oy = _mm_set1_ps(other.y);
+			std::size_t i = 0;
+			for (; i + 4 <= length; i += 4)
+			{
+				const __m128 a = _mm_loadu_ps(vectors + i * 2);
+				const __m128 b = _mm_loadu_ps(vectors + i * 2 + 4);
+				const __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(x, ox), _mm_mul_ps(y, oy)));
+			}
+			return i;
+		}
+
+		static std::size_t dot3Sse2(const float* vectors, std::size_t length, const Vector3& other, float* out)
+		{
+			const __m128 ox = _mm_set1_ps(other.x);
+			const __m128 oy = _mm_set1_ps(other.y);
+			const __m128 oz = _mm_set1_ps(other.z);
+			std::size_t i = 0;
+			for (; i + 4 <= length; i += 4)
+			{
+				const float* p = vectors + i * 3;
+				__m128 x, y, z;
+				deinterleave3Sse2(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, ox), _mm_mul_ps(y, oy)), _mm_mul_ps(z, oz)));
+			}
+			return i;
+		}
+
+		static std::size_t transform2Sse2(const Matrix4& matrix, const float* points, std::size_t length, float* out)
+		{
+			const MatrixSse2 m(matrix);
+			std::size_t i = 0;
+			for (; i + 4 <= length; i += 4)
+			{
+				const __m128 a = _mm_loadu_ps(points + i * 2);
+				const __m128 b = _mm_loadu_ps(points + i * 2 + 4);
+				__m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+				__m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+				__m128 z = _mm_setzero_ps();
+				m.transform(x, y, z);
+				_mm_storeu_ps(out + i * 2,     _mm_unpacklo_ps(x, y));
+				_mm_storeu_ps(out + i * 2 + 4, _mm_unpackhi_ps(x, y));
+			}
+			return i;
+		}
+
+		static std::size_t transform3Sse2(const Matrix4& matrix, const float* points, std::size_t length, float* out)
+		{
+			const MatrixSse2 m(matrix);
+			std::size_t i = 0;
+			for (; i + 4 <= length; i += 4)
+			{
+				const float* p = points + i * 3;
+				__m128 x, y, z;
+				deinterleave3Sse2(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+				m.transform(x, y, z);
+				__m128 a, b, c;
+				interleave3Sse2(x, y, z, a, b, c);
+				_mm_storeu_ps(out + i * 3,     a);
+				_mm_storeu_ps(out + i * 3 + 4, b);
+				_mm_storeu_ps(out + i * 3 + 8, c);
+			}
+			return i;
+		}
+		//Lanes whose bit is set in slowLanes are beyond Math::INTERNAL::TRIG_FAST_REDUCTION_LIMIT. They are
+		//recomputed like the scalar functions do. values is a copy, the input may alias the outputs.
+		static void sincosSlowLanes(const float* values, int slowLanes, float* outSin, float* outCos)
+		{
+			for (int lane = 0; slowLanes != 0; lane++, slowLanes >>= 1)
+			{
+				if (slowLanes & 1)
+				{
+					if (outSin != nullptr)
+					{
+						outSin[lane] = std::sin(values[lane]);
+					}
+					if (outCos != nullptr)
+					{
+						outCos[lane] = std::cos(values[lane]);
+					}
+				}
+			}
+		}
+
+		static inline __m128 selectSse2(__m128 mask, __m128 ifSet, __m128 ifNotSet)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, ifSet), _mm_andnot_ps(mask, ifNotSet));
+		}
+
+		//Math::sincos for four values at once, see Math.cpp. Either output may be nullptr.
+		static std::size_t sincosSse2(const float* values, std::size_t length, float* outSin, float* outCos)
+		{
+			const __m128 twoOverPi = _mm_set1_ps(Math::INTERNAL::TRIG_TWO_OVER_PI);
+			const __m128 magic     = _mm_set1_ps(Math::INTERNAL::TRIG_ROUND_MAGIC);
+			const __m128 part1     = _mm_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART1);
+			const __m128 part2     = _mm_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART2);
+			const __m128 part3     = _mm_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART3);
+			const __m128 s1        = _mm_set1_ps(Math::INTERNAL::TRIG_SIN_1);
+			const __m128 s2        = _mm_set1_ps(Math::INTERNAL::TRIG_SIN_2);
+			const __m128 s3        = _mm_set1_ps(Math::INTERNAL::TRIG_SIN_3);
+			const __m128 c1        = _mm_set1_ps(Math::INTERNAL::TRIG_COS_1);
+			const __m128 c2        = _mm_set1_ps(Math::INTERNAL::TRIG_COS_2);
+			const __m128 c3        = _mm_set1_ps(Math::INTERNAL::TRIG_COS_3);
+			const __m128 half      = _mm_set1_ps(0.5f);
+			const __m128 one       = _mm_set1_ps(1.0f);
+			const __m128i bit0     = _mm_set1_epi32(1);
+			const __m128i bit1     = _mm_set1_epi32(2);
+			const __m128 absMask   = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+			const __m128 limit     = _mm_set1_ps(Math::INTERNAL::TRIG_FAST_REDUCTION_LIMIT);
+			std::size_t i = 0;
+			for (; i + 4 <= length; i += 4)
+			{
+				const __m128 v = _mm_loadu_ps(values + i);
+				const int slowLanes = _mm_movemask_ps(_mm_cmpnle_ps(_mm_and_ps(v, absMask), limit));
+				float slowValues[4];
+				if (slowLanes != 0)
+				{
+					_mm_storeu_ps(slowValues, v);
+				}
+				const __m128 shifted = _mm_add_ps(_mm_mul_ps(v, twoOverPi), magic);
+				const __m128 quadrant = _mm_sub_ps(shifted, magic);
+				const __m128i quadrantBits = _mm_castps_si128(shifted);
+				const __m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(v, _mm_mul_ps(quadrant, part1)), _mm_mul_ps(quadrant, part2)), _mm_mul_ps(quadrant, part3));
+				const __m128 r2 = _mm_mul_ps(r, r);
+				const __m128 sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(s3, r2), s2), r2), s1), r2), r), r);
+				const __m128 cosPoly = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3, r2), c2), r2), c1), r2), r2), _mm_mul_ps(half, r2)), one);
+				const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrantBits, bit0), bit0));
+				if (outSin != nullptr)
+				{
+					const __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrantBits, bit1), 30));
+					_mm_storeu_ps(outSin + i, _mm_xor_ps(selectSse2(swap, cosPoly, sinPoly), sign));
+				}
+				if (outCos != nullptr)
+				{
+					const __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrantBits, bit0), bit1), 30));
+					_mm_storeu_ps(outCos + i, _mm_xor_ps(selectSse2(swap, sinPoly, cosPoly), sign));
+				}
+				if (slowLanes != 0)
+				{
+					sincosSlowLanes(slowValues, slowLanes, outSin == nullptr ? nullptr : outSin + i, outCos == nullptr ? nullptr : outCos + i);
+				}
+			}
+			return i;
+		}
+#endif
+
+#ifdef BBE_CAN_DISPATCH_AVX2
+		//The 256 bit shuffles work on two independent 128 bit halves. The Vector3 kernels therefore load
+		//four points into each half and reuse the SSE2 shuffle pattern, the Vector2 kernels fix the
+		//order with a cross lane permute where it matters.
+		BBE_TARGET_AVX2 static inline __m256 load2x128Avx2(const float* low, const float* high)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+		}
+
+		BBE_TARGET_AVX2 static inline void store2x128Avx2(float* low, float* high, __m256 value)
+		{
+			_mm_storeu_ps(low, _mm256_castps256_ps128(value));
+			_mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+		}
+
+		BBE_TARGET_AVX2 static inline void deinterleave3Avx2(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z)
+		{
+			x = _mm256_shuffle_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		BBE_TARGET_AVX2 static inline void interleave3Avx2(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c)
+		{
+			a = _mm256_shuffle_ps(_mm256_unpacklo_ps(x, y), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+			b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		//Loads points 0-3 into the low and points 4-7 into the high half.
+		BBE_TARGET_AVX2 static inline void load8Vector3Avx2(const float* p, __m256& x, __m256& y, __m256& z)
+		{
+			deinterleave3Avx2(load2x128Avx2(p, p + 12), load2x128Avx2(p + 4, p + 16), load2x128Avx2(p + 8, p + 20), x, y, z);
+		}
+
+		struct MatrixAvx2
+		{
+			__m256 m[4][4]; //m[col][row], every lane holds the same value.
+
+			BBE_TARGET_AVX2 explicit MatrixAvx2(const Matrix4& matrix)
+			{
+				for (int col = 0; col < 4; col++)
+				{
+					const Vector4 column = matrix.getColumn(col);
+					m[col][0] = _mm256_set1_ps(column.x);
+					m[col][1] = _mm256_set1_ps(column.y);
+					m[col][2] = _mm256_set1_ps(column.z);
+					m[col][3] = _mm256_set1_ps(column.w);
+				}
+			}
+
+			BBE_TARGET_AVX2 void transform(__m256& x, __m256& y, __m256& z) const
+			{
+				__m256 result[4];
+				for (int row = 0; row < 4; row++)
+				{
+					result[row] = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[0][row], x), _mm256_mul_ps(m[1][row], y)), _mm256_mul_ps(m[2][row], z)), m[3][row]);
+				}
+				x = _mm256_div_ps(result[0], result[3]);
+				y = _mm256_div_ps(result[1], result[3]);
+				z = _mm256_div_ps(result[2], result[3]);
+			}
+		};
+
+		BBE_TARGET_AVX2 static std::size_t dot2Avx2(const float* vectors, std::size_t length, const Vector2& other, float* out)
+		{
+			const __m256 ox = _mm256_set1_ps(other.x);
+			const __m256 oy = _mm256_set1_ps(other.y);
+			std::size_t i = 0;
+			for (; i + 8 <= length; i += 8)
+			{
+				const __m256 a = _mm256_loadu_ps(vectors + i * 2);
+				const __m256 b = _mm256_loadu_ps(vectors + i * 2 + 8);
+				//Elements in the order 0 1 4 5 | 2 3 6 7
+				const __m256 x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m256 y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+				const __m256 dots = _mm256_add_ps(_mm256_mul_ps(x, ox), _mm256_mul_ps(y, oy));
+				_mm256_storeu_ps(out + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(dots), _MM_SHUFFLE(3, 1, 2, 0))));
+			}
+			return i;
+		}
+
+		BBE_TARGET_AVX2 static std::size_t dot3Avx2(const float* vectors, std::size_t length, const Vector3& other, float* out)
+		{
+			const __m256 ox = _mm256_set1_ps(other.x);
+			const __m256 oy = _mm256_set1_ps(other.y);
+			const __m256 oz = _mm256_set1_ps(other.z);
+			std::size_t i = 0;
+			for (; i + 8 <= length; i += 8)
+			{
+				__m256 x, y, z;
+				load8Vector3Avx2(vectors + i * 3, x, y, z);
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, ox), _mm256_mul_ps(y, oy)), _mm256_mul_ps(z, oz)));
+			}
+			return i;
+		}
+
+		BBE_TARGET_AVX2 static std::size_t transform2Avx2(const Matrix4& matrix, const float* points, std::size_t length, float* out)
+		{
+			const MatrixAvx2 m(matrix);
+			std::size_t i = 0;
+			for (; i + 8 <= length; i += 8)
+			{
+				const __m256 a = _mm256_loadu_ps(points + i * 2);
+				const __m256 b = _mm256_loadu_ps(points + i * 2 + 8);
+				//The unpacks below undo the order of the shuffles, no cross lane permute is needed.
+				__m256 x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+				__m256 y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+				__m256 z = _mm256_setzero_ps();
+				m.transform(x, y, z);
+				_mm256_storeu_ps(out + i * 2,     _mm256_unpacklo_ps(x, y));
+				_mm256_storeu_ps(out + i * 2 + 8, _mm256_unpackhi_ps(x, y));
+			}
+			return i;
+		}
+
+		BBE_TARGET_AVX2 static std::size_t transform3Avx2(const Matrix4& matrix, const float* points, std::size_t length, float* out)
+		{
+			const MatrixAvx2 m(matrix);
+			std::size_t i = 0;
+			for (; i + 8 <= length; i += 8)
+			{
+				__m256 x, y, z;
+				load8Vector3Avx2(points + i * 3, x, y, z);
+				m.transform(x, y, z);
+				__m256 a, b, c;
+				interleave3Avx2(x, y, z, a, b, c);
+				float* p = out + i * 3;
+				store2x128Avx2(p,     p + 12, a);
+				store2x128Avx2(p + 4, p + 16, b);
+				store2x128Avx2(p + 8, p + 20, c);
+			}
+			return i;
+		}
+
+		BBE_TARGET_AVX2 static std::size_t sincosAvx2(const float* values, std::size_t length, float* outSin, float* outCos)
+		{
+			const __m256 twoOverPi = _mm256_set1_ps(Math::INTERNAL::TRIG_TWO_OVER_PI);
+			const __m256 magic     = _mm256_set1_ps(Math::INTERNAL::TRIG_ROUND_MAGIC);
+			const __m256 part1     = _mm256_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART1);
+			const __m256 part2     = _mm256_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART2);
+			const __m256 part3     = _mm256_set1_ps(Math::INTERNAL::TRIG_PI_OVER_2_PART3);
+			const __m256 s1        = _mm256_set1_ps(Math::INTERNAL::TRIG_SIN_1);
+			const __m256 s2        = _mm256_set1_ps(Math::INTERNAL::TRIG_SIN_2);
+			const __m256 s3        = _mm256_set1_ps(Math::INTERNAL::TRIG_SIN_3);
+			const __m256 c1        = _mm256_set1_ps(Math::INTERNAL::TRIG_COS_1);
+			const __m256 c2        = _mm256_set1_ps(Math::INTERNAL::TRIG_COS_2);
+			const __m256 c3        = _mm256_set1_ps(Math::INTERNAL::TRIG_COS_3);
+			const __m256 half      = _mm256_set1_ps(0.5f);
+			const __m256 one       = _mm256_set1_ps(1.0f);
+			const __m256i bit0     = _mm256_set1_epi32(1);
+			const __m256i bit1     = _mm256_set1_epi32(2);
+			const __m256 absMask   = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+			const __m256 limit     = _mm256_set1_ps(Math::INTERNAL::TRIG_FAST_REDUCTION_LIMIT);
+			std::size_t i = 0;
+			for (; i + 8 <= length; i += 8)
+			{
+				const __m256 v = _mm256_loadu_ps(values + i);
+				const int slowLanes = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(v, absMask), limit, _CMP_NLE_UQ));
+				float slowValues[8];
+				if (slowLanes != 0)
+				{
+					_mm256_storeu_ps(slowValues, v);
+				}
+				const __m256 shifted = _mm256_add_ps(_mm256_mul_ps(v, twoOverPi), magic);
+				const __m256 quadrant = _mm256_sub_ps(shifted, magic);
+				const __m256i quadrantBits = _mm256_castps_si256(shifted);
+				const __m256 r = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(v, _mm256_mul_ps(quadrant, part1)), _mm256_mul_ps(quadrant, part2)), _mm256_mul_ps(quadrant, part3));
+				const __m256 r2 = _mm256_mul_ps(r, r);
+				const __m256 sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(s3, r2), s2), r2), s1), r2), r), r);
+				const __m256 cosPoly = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(c3, r2), c2), r2), c1), r2), r2), _mm256_mul_ps(half, r2)), one);
+				const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrantBits, bit0), bit0));
+				if (outSin != nullptr)
+				{
+					const __m256 sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrantBits, bit1), 30));
+					_mm256_storeu_ps(outSin + i, _mm256_xor_ps(_mm256_blendv_ps(sinPoly, cosPoly, swap), sign));
+				}
+				if (outCos != nullptr)
+				{
+					const __m256 sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrantBits, bit0), bit1), 30));
+					_mm256_storeu_ps(outCos + i, _mm256_xor_ps(_mm256_blendv_ps(cosPoly, sinPoly, swap), sign));
+				}
+				if (slowLanes != 0)
+				{
+					sincosSlowLanes(slowValues, slowLanes, outSin == nullptr ? nullptr : outSin + i, outCos == nullptr ? nullptr : outCos + i);
+				}
+			}
+			return i;
+		}
+#endif
+
+		static std::size_t dotSimd(const Vector2* vectors, std::size_t length, const Vector2& other, float* out)
+		{
+			switch (getSimdLevel())
+			{
+#ifdef BBE_CAN_DISPATCH_AVX2
+			case SimdLevel::AVX2:
+				return dot2Avx2(&vectors->x, length, other, out);
+#endif
+#ifdef BBE_USE_SSE2
+			case SimdLevel::SSE2:
+				return dot2Sse2(&vectors->x, length, other, out);
+#endif
+			default:
+				return 0;
+			}
+		}
+
+		static std::size_t dotSimd(const Vector3* vectors, std::size_t length, const Vector3& other, float* out)
+		{
+			switch (getSimdLevel())
+			{
+#ifdef BBE_CAN_DISPATCH_AVX2
+			case SimdLevel::AVX2:
+				return dot3Avx2(&vectors->x, length, other, out);
+#endif
+#ifdef BBE_USE_SSE2
+			case SimdLevel::SSE2:
+				return dot3Sse2(&vectors->x, length, other, out);
+#endif
+			default:
+				return 0;
+			}
+		}
+
+		static std::size_t transformSimd(const Matrix4& matrix, const Vector2* points, std::size_t length, Vector2* out)
+		{
+			switch (getSimdLevel())
+			{
+#ifdef BBE_CAN_DISPATCH_AVX2
+			case SimdLevel::AVX2:
+				return transform2Avx2(matrix, &points->x, length, &out->x);
+#endif
+#ifdef BBE_USE_SSE2
+			case SimdLevel::SSE2:
+				return transform2Sse2(matrix, &points->x, length, &out->x);
+#endif
+			default:
+				return 0;
+			}
+		}
+
+		static std::size_t transformSimd(const Matrix4& matrix, const Vector3* points, std::size_t length, Vector3* out)
+		{
+			switch (getSimdLevel())
+			{
+#ifdef BBE_CAN_DISPATCH_AVX2
+			case SimdLevel::AVX2:
+				return transform3Avx2(matrix, &points->x, length, &out->x);
+#endif
+#ifdef BBE_USE_SSE2
+			case SimdLevel::SSE2:
+				return transform3Sse2(matrix, &points->x, length, &out->x);
+#endif
+			default:
+				return 0;
+			}
+		}
+
+		static std::size_t sincosSimd(const float* values, std::size_t length, float* outSin, float* outCos)
+		{
+			switch (getSimdLevel())
+			{
+#ifdef BBE_CAN_DISPATCH_AVX2
+			case SimdLevel::AVX2:
+				return sincosAvx2(values, length, outSin, outCos);
+#endif
+#ifdef BBE_USE_SSE2
+			case SimdLevel::SSE2:
+				return sincosSse2(values, length, outSin, outCos);
+#endif
+			default:
+				return 0;
+			}
+		}
+
+		static void accumulateMinMax(const float* values, std::size_t length, Math::ProjectionRange& range)
+		{
+			std::size_t i = 0;
+#ifdef BBE_USE_SSE2
+			if (getSimdLevel() != SimdLevel::SCALAR && length >= 4)
+			{
+				__m128 min = _mm_set1_ps(range.min);
+				__m128 max = _mm_set1_ps(range.max);
+				for (; i + 4 <= length; i += 4)
+				{
+					//minps/maxps return their second operand if either is NaN, in this order they skip a NaN
+					//value exactly like the scalar comparisons below and keep a NaN start value.
+					const __m128 v = _mm_loadu_ps(values + i);
+					min = _mm_min_ps(v, min);
+					max = _mm_max_ps(v, max);
+				}
+				min = _mm_min_ps(min, _mm_shuffle_ps(min, min, _MM_SHUFFLE(1, 0, 3, 2)));
+				max = _mm_max_ps(max, _mm_shuffle_ps(max, max, _MM_SHUFFLE(1, 0, 3, 2)));
+				range.min = _mm_cvtss_f32(_mm_min_ss(min, _mm_shuffle_ps(min, min, _MM_SHUFFLE(2, 3, 0, 1))));
+				range.max = _mm_cvtss_f32(_mm_max_ss(max, _mm_shuffle_ps(max, max, _MM_SHUFFLE(2, 3, 0, 1))));
+			}
+#endif
+			for (; i < length; i++)
+			{
+				range.min = values[i] < range.min ? values[i] : range.min;
+				range.max = values[i] > range.max ? values[i] : range.max;
+			}
+		}
+
+		template <typename Vec>
+		static void batchDot(Span<const Vec> vectors, const Vec& other, Span<float> out)
+		{
+			checkBatchLengths(vectors.getLength(), out.getLength());
+			const std::size_t done = vectors.isEmpty() ? 0 : dotSimd(vectors.getRaw(), vectors.getLength(), other, out.getRaw());
+			for (std::size_t i = done; i < vectors.getLength(); i++)
+			{
+				out[i] = vectors[i] * other;
+			}
+		}
+
+		template <typename Vec>
+		static Math::ProjectionRange batchProjectRange(Span<const Vec> points, const Vec& axis)
+		{
+			if (points.isEmpty())
+			{
+				debugBreak();
+				throw ContainerEmptyException();
+			}
+			float dots[BATCH_CHUNK_SIZE];
+			Math::ProjectionRange retVal{ points[0] * axis, points[0] * axis };
+			for (std::size_t start = 0; start < points.getLength(); start += BATCH_CHUNK_SIZE)
+			{
+				const std::size_t length = (Math::min)(BATCH_CHUNK_SIZE, points.getLength() - start);
+				batchDot(Span<const Vec>(points.getRaw() + start, length), axis, Span<float>(dots, length));
+				accumulateMinMax(dots, length, retVal);
+			}
+			return retVal;
+		}
+
+		template <typename Vec>
+		static void batchProject(Span<const Vec> points, const Vec& projection, Span<Vec> out)
+		{
+			checkBatchLengths(points.getLength(), out.getLength());
+			const float lengthSq = projection.getLengthSq();
+			float dots[BATCH_CHUNK_SIZE];
+			for (std::size_t start = 0; start < points.getLength(); start += BATCH_CHUNK_SIZE)
+			{
+				const std::size_t length = (Math::min)(BATCH_CHUNK_SIZE, points.getLength() - start);
+				batchDot(Span<const Vec>(points.getRaw() + start, length), projection, Span<float>(dots, length));
+				for (std::size_t i = 0; i < length; i++)
+				{
+					out[start + i] = projection * (dots[i] / lengthSq);
+				}
+			}
+		}
+
+		template <typename Vec>
+		static bbe::List<Vec> batchProject(const bbe::List<Vec>& points, const Vec& projection)
+		{
+			bbe::List<Vec> retVal;
+			retVal.resizeCapacityAndLength(points.getLength());
+			batchProject(Span<const Vec>(points.getRaw(), points.getLength()), projection, Span<Vec>(retVal.getRaw(), retVal.getLength()));
+			return retVal;
+		}
+
+		//Either output may be nullptr. Their lengths must already be checked.
+		static void batchSincos(Span<const float> values, float* outSin, float* outCos)
+		{
+			const std::size_t done = values.isEmpty() ? 0 : sincosSimd(values.getRaw(), values.getLength(), outSin, outCos);
+			for (std::size_t i = done; i < values.getLength(); i++)
+			{
+				if (outCos == nullptr)
+				{
+					outSin[i] = Math::sin(values[i]);
+				}
+				else if (outSin == nullptr)
+				{
+					outCos[i] = Math::cos(values[i]);
+				}
+				else
+				{
+					Math::sincos(values[i], outSin[i], outCos[i]);
+				}
+			}
+		}
+	}
+}
+
+void bbe::Math::dot(Span<const Vector2> vectors, const Vector2& other, Span<float> out)
+{
+	bbe::INTERNAL::batchDot(vectors, other, out);
+}
+
+void bbe::Math::dot(Span<const Vector3> vectors, const Vector3& other, Span<float> out)
+{
+	bbe::INTERNAL::batchDot(vectors, other, out);
+}
+
+bbe::Math::ProjectionRange bbe::Math::projectRange(Span<const Vector2> points, const Vector2& axis)
+{
+	return bbe::INTERNAL::batchProjectRange(points, axis);
+}
+
+bbe::Math::ProjectionRange bbe::Math::projectRange(Span<const Vector3> points, const Vector3& axis)
+{
+	return bbe::INTERNAL::batchProjectRange(points, axis);
+}
+
+void bbe::Math::project(Span<const Vector2> points, const Vector2& projection, Span<Vector2> out)
+{
+	bbe::INTERNAL::batchProject(points, projection, out);
+}
+
+void bbe::Math::project(Span<const Vector3> points, const Vector3& projection, Span<Vector3> out)
+{
+	bbe::INTERNAL::batchProject(points, projection, out);
+}
+
+bbe::List<bbe::Vector2> bbe::Math::project(const bbe::List<Vector2>& points, const Vector2& projection)
+{
+	return bbe::INTERNAL::batchProject(points, projection);
+}
+
+bbe::List<bbe::Vector3> bbe::Math::project(const bbe::List<Vector3>& points, const Vector3& projection)
+{
+	return bbe::INTERNAL::batchProject(points, projection);
+}
+
+void bbe::Math::transformPoints(const Matrix4& matrix, Span<const Vector2> points, Span<Vector2> out)
+{
+	bbe::INTERNAL::checkBatchLengths(points.getLength(), out.getLength());
+	const std::size_t done = points.isEmpty() ? 0 : bbe::INTERNAL::transformSimd(matrix, points.getRaw(), points.getLength(), out.getRaw());
+	for (std::size_t i = done; i < points.getLength(); i++)
+	{
+		const Vector3 transformed = matrix * Vector3(points[i].x, points[i].y, 0);
+		out[i] = Vector2(transformed.x, transformed.y);
+	}
+}
+
+void bbe::Math::transformPoints(const Matrix4& matrix, Span<const Vector3> points, Span<Vector3> out)
+{
+	bbe::INTERNAL::checkBatchLengths(points.getLength(), out.getLength());
+	const std::size_t done = points.isEmpty() ? 0 : bbe::INTERNAL::transformSimd(matrix, points.getRaw(), points.getLength(), out.getRaw());
+	for (std::size_t i = done; i < points.getLength(); i++)
+	{
+		out[i] = matrix * points[i];
+	}
+}
+
+void bbe::Math::sin(Span<const float> values, Span<float> out)
+{
+	bbe::INTERNAL::checkBatchLengths(values.getLength(), out.getLength());
+	bbe::INTERNAL::batchSincos(values, out.getRaw(), nullptr);
+}
+
+void bbe::Math::cos(Span<const float> values, Span<float> out)
+{
+	bbe::INTERNAL::checkBatchLengths(values.getLength(), out.getLength());
+	bbe::INTERNAL::batchSincos(values, nullptr, out.getRaw());
+}
+
+void bbe::Math::sincos(Span<const float> values, Span<float> outSin, Span<float> outCos)
+{
+	bbe::INTERNAL::checkBatchLengths(values.getLength(), outSin.getLength());
+	bbe::INTERNAL::checkBatchLengths(values.getLength(), outCos.getLength());
+	bbe::INTERNAL::batchSincos(values, outSin.getRaw(), outCos.getRaw());
+}
@@ -841,3 +841,161 @@ TEST(List, CombineOrderedLists)
 	ASSERT_EQ(list1[11].getLength(), 1337);
 	ASSERT_EQ(list1.getLength(), 12);
 }
+
+TEST(List, TriviallyRelocatableGrowth)
+{
+	bbe::List<bbe::Vector2> list;
+	for (int i = 0; i < 1000; i++)
+	{
+		list.add(bbe::Vector2((float)i, (float)-i));
+	}
+	ASSERT_EQ(list.getLength(), 1000);
+	for (size_t i = 0; i < list.getLength(); i++)
+	{
+		ASSERT_EQ(list[i].x, (float)i);
+		ASSERT_EQ(list[i].y, -(float)i);
+	}
+
+	bbe::List<bbe::Vector2> copy(list);
+	ASSERT_EQ(copy.getLength(), 1000);
+	ASSERT_EQ(copy[999].x, 999.f);
+	copy[999].x = 0;
+	ASSERT_EQ(list[999].x, 999.f);
+
+	copy = list;
+	ASSERT_EQ(copy[999].x, 999.f);
+
+	list.removeIndex(0);
+	list.removeIndex(500);
+	list.removeIndex(list.getLength() - 1);
+	ASSERT_EQ(list.getLength(), 997);
+	ASSERT_EQ(list[0].x, 1.f);
+	ASSERT_EQ(list[499].x, 500.f);
+	ASSERT_EQ(list[500].x, 502.f);
+	ASSERT_EQ(list[996].x, 998.f);
+}
+
+TEST(List, removeIndexDestroysElements)
+{
+	bbe::test::Person::resetTestStatistics();
+	{
+		bbe::List<bbe::test::Person> list;
+		for (int i = 0; i < 5; i++)
+		{
+			list.add(bbe::test::Person("Name", "Addr", i));
+		}
+		list.removeIndex(1);
+		list.removeIndex(3);
+		ASSERT_EQ(list.getLength(), 3);
+		ASSERT_EQ(list[0].age, 0);
+		ASSERT_EQ(list[1].age, 2);
+		ASSERT_EQ(list[2].age, 3);
+	}
+	ASSERT_EQ(bbe::test::Person::s_amountOfPersons, 0);
+}
+
+TEST(List, reserve)
+{
+	bbe::List<SomeClass<int>> list(3, 7);
+	list.reserve(100);
+	ASSERT_EQ(list.getCapacity(), 100);
+	ASSERT_EQ(list.getLength(), 3);
+	ASSERT_EQ(list[2].getLength(), 7);
+	list.reserve(10);
+	ASSERT_EQ(list.getCapacity(), 100);
+	ASSERT_EQ(list.getLength(), 3);
+}
+
+TEST(List, resizeUninitialized)
+{
+	bbe::List<uint32_t> list;
+	list.resizeUninitialized(64);
+	ASSERT_EQ(list.getLength(), 64);
+	ASSERT_GE(list.getCapacity(), 64);
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		list[i] = i * 3;
+	}
+	list.resizeUninitialized(16);
+	ASSERT_EQ(list.getLength(), 16);
+	ASSERT_GE(list.getCapacity(), 64);
+	ASSERT_EQ(list[15], 45);
+}
+
+TEST(List, removeAllByPredicateDestroysElements)
+{
+	bbe::test::Person::resetTestStatistics();
+	{
+		bbe::List<bbe::test::Person> list;
+		for (int i = 0; i < 10; i++)
+		{
+			list.add(bbe::test::Person("Name", "Addr", i));
+		}
+		ASSERT_EQ(list.removeAll([](const bbe::test::Person& p) { return p.age % 3 == 0; }), 4);
+		ASSERT_EQ(list.getLength(), 6);
+		ASSERT_EQ(list[0].age, 1);
+		ASSERT_EQ(list[1].age, 2);
+		ASSERT_EQ(list[2].age, 4);
+		ASSERT_EQ(list[5].age, 8);
+		ASSERT_EQ(bbe::test::Person::s_amountOfPersons, 6);
+	}
+	ASSERT_EQ(bbe::test::Person::s_amountOfPersons, 0);
+}
+
+TEST(List, removeAllUnordered)
+{
+	bbe::List<int> list = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	ASSERT_EQ(list.removeAllUnordered([](int i) { return i % 2 == 0; }), 5);
+	ASSERT_EQ(list.getLength(), 5);
+	for (int i = 1; i < 10; i += 2)
+	{
+		ASSERT_TRUE(list.contains(i));
+	}
+	ASSERT_FALSE(list.contains([](int i) { return i % 2 == 0; }));
+
+	ASSERT_EQ(list.removeAllUnordered(7), 1);
+	ASSERT_EQ(list.getLength(), 4);
+	ASSERT_FALSE(list.contains(7));
+	ASSERT_EQ(list.removeAllUnordered(7), 0);
+}
+
+TEST(List, removeIndexUnordered)
+{
+	bbe::List<SomeClass<int>> list = { SomeClass<int>(1), SomeClass<int>(2), SomeClass<int>(3), SomeClass<int>(4) };
+	ASSERT_TRUE(list.removeIndexUnordered(1));
+	ASSERT_EQ(list.getLength(), 3);
+	ASSERT_EQ(list[0].getLength(), 1);
+	ASSERT_EQ(list[1].getLength(), 4);
+	ASSERT_EQ(list[2].getLength(), 3);
+	ASSERT_TRUE(list.removeIndexUnordered(2));
+	ASSERT_EQ(list.getLength(), 2);
+	ASSERT_EQ(list[1].getLength(), 4);
+	ASSERT_FALSE(list.removeIndexUnordered(2));
+}
+
+TEST(List, templatedAndStdFunctionPredicates)
+{
+	bbe::List<int> list = { 5, 1, 4, 2, 3 };
+	const std::function<bool(const int&)> isEven = [](const int& i) { return i % 2 == 0; };
+	auto isEvenLambda = [](const int& i) { return i % 2 == 0; };
+
+	ASSERT_EQ(list.containsAmount(isEven), 2);
+	ASSERT_EQ(list.containsAmount(isEvenLambda), 2);
+	ASSERT_EQ(*list.find(isEven), 4);
+	ASSERT_EQ(*list.find(isEvenLambda), 4);
+	ASSERT_EQ(*list.findLast(isEven), 2);
+	ASSERT_EQ(*list.findLast(isEvenLambda), 2);
+	ASSERT_FALSE(list.containsUnique(isEvenLambda));
+
+	list.sort([](const int& a, const int& b) { return a > b; });
+	ASSERT_EQ(list[0], 5);
+	ASSERT_EQ(list[4], 1);
+	list.sort(std::function<bool(const int&, const int&)>([](const int& a, const int& b) { return a < b; }));
+	ASSERT_EQ(list[0], 1);
+	ASSERT_EQ(list[4], 5);
+
+	ASSERT_TRUE(list.removeSingle(isEvenLambda));
+	ASSERT_TRUE(list.removeSingle(isEven));
+	ASSERT_FALSE(list.removeSingle(isEven));
+	ASSERT_EQ(list.getLength(), 3);
+}
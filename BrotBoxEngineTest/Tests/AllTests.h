@@ -3,12 +3,25 @@
 
 #include "PoolAllocatorTest.h"
 #include "StackAllocatorTest.h"
+#include "FrameArenaTest.h"
 #include "GeneralPurposeAllocatorTest.h"
 #include "DefragmentationAllocatorTest.h"
+#include "AllocatorTelemetryTest.h"
+#include "MemoryResourceTest.h"
 #include "StringTest.h"
+#include "StringBuilderTest.h"
+#include "HashTest.h"
+#include "StringIdTest.h"
 #include "DataStructures/ListTest.h"
+#include "DataStructures/SmallListTest.h"
+#include "DataStructures/SoAListTest.h"
+#include "DataStructures/Grid2DTest.h"
 #include "DataStructures/HashMapTest.h"
+#include "DataStructures/SortedMapTest.h"
 #include "DataStructures/StackTest.h"
+#include "DataStructures/SPSCRingTest.h"
+#include "DataStructures/MPMCQueueTest.h"
+#include "EntityRegistryTest.h"
 #include "DataStructures/ArrayTest.h"
 #include "DataStructures/DynamicArrayTest.h"
 #include "BBE/UtilTest.h"
@@ -17,7 +30,11 @@
 #include "MathTest.h"
 #include "Vector2Test.h"
 #include "Vector3Test.h"
+#include "Vector4Test.h"
+#include "VectorBatchTest.h"
 #include "LinearCongruentialGeneratorTest.h"
+#include "RandomTest.h"
+#include "PhiloxTest.h"
 #include "ImageTest.h"
 
 namespace bbe {
@@ -35,6 +52,10 @@ namespace bbe {
 			bbe::test::testStackAllocator();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing FrameArena" << std::endl;
+			bbe::test::testFrameArena();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing GeneralPurposeAllocator" << std::endl;
 			bbe::test::testGeneralPurposeAllocator();
 			Person::checkIfAllPersonsWereDestroyed();
@@ -43,22 +64,74 @@ namespace bbe {
 			bbe::test::testDefragmentationAllocator();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing AllocatorTelemetry" << std::endl;
+			bbe::test::testAllocatorTelemetry();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing MemoryResource" << std::endl;
+			bbe::test::testMemoryResource();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing String" << std::endl;
 			bbe::test::testString();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing StringBuilder" << std::endl;
+			bbe::test::testStringBuilder();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing Hash" << std::endl;
+			bbe::test::testHash();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing StringId" << std::endl;
+			bbe::test::testStringId();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing List" << std::endl;
 			bbe::test::testList();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing SmallList" << std::endl;
+			bbe::test::testSmallList();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing SoAList" << std::endl;
+			bbe::test::testSoAList();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing Grid2D" << std::endl;
+			bbe::test::testGrid2D();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing HashMap" << std::endl;
 			bbe::test::testHashMap();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing SortedMap" << std::endl;
+			bbe::test::testSortedMap();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing SortedSet" << std::endl;
+			bbe::test::testSortedSet();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing Stack" << std::endl;
 			bbe::test::testStack();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing SPSCRing" << std::endl;
+			bbe::test::testSPSCRing();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing MPMCQueue" << std::endl;
+			bbe::test::testMPMCQueue();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing EntityRegistry" << std::endl;
+			bbe::test::testEntityRegistry();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing UniquePointer" << std::endl;
 			bbe::test::testUniquePointer();
 			Person::checkIfAllPersonsWereDestroyed();
@@ -87,10 +160,26 @@ namespace bbe {
 			bbe::test::testVector3();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing Vector4" << std::endl;
+			bbe::test::testVector4();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing VectorBatch" << std::endl;
+			bbe::test::testVectorBatch();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing LinearCongruentialGenerator" << std::endl;
 			bbe::test::testLinearCongruentailGenerators();
 			Person::checkIfAllPersonsWereDestroyed();
 
+			std::cout << "Testing Random" << std::endl;
+			bbe::test::testRandom();
+			Person::checkIfAllPersonsWereDestroyed();
+
+			std::cout << "Testing Philox" << std::endl;
+			bbe::test::testPhilox();
+			Person::checkIfAllPersonsWereDestroyed();
+
 			std::cout << "Testing Image" << std::endl;
 			bbe::test::testImage();
 			Person::checkIfAllPersonsWereDestroyed();
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "BBE/AllocatorTelemetry.h"
+#include "BBE/Profiler.h"
+#include "BBE/PoolAllocator.h"
+#include "BBE/StackAllocator.h"
+#include "BBE/GeneralPurposeAllocator.h"
+#include "BBE/DefragmentationAllocator.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe {
+	namespace test {
+		const bbe::Profiler::AllocatorStatistics* findAllocatorStatistics(const bbe::List<bbe::Profiler::AllocatorStatistics>& statistics, const char* name)
+		{
+			for (const bbe::Profiler::AllocatorStatistics& s : statistics)
+			{
+				if (s.name == name)
+				{
+					return &s;
+				}
+			}
+			return nullptr;
+		}
+
+		void testAllocatorTelemetry() {
+			{
+				bbe::PoolAllocator<int> pa(16);
+				pa.getTelemetry().setName("TelemetryTestPool");
+				assertEquals(pa.getTelemetry().getCapacityBytes(), 16 * sizeof(int));
+				int* a = pa.allocateObject(1);
+				int* b = pa.allocateObject(2);
+				assertEquals(pa.getTelemetry().getLiveBytes(), 2 * sizeof(int));
+				pa.deallocate(a);
+				assertEquals(pa.getTelemetry().getLiveBytes(), sizeof(int));
+				assertEquals(pa.getTelemetry().getPeakBytes(), 2 * sizeof(int));
+				assertEquals(pa.getTelemetry().getAmountOfAllocations(), 2);
+				assertEquals(pa.getTelemetry().getAmountOfDeallocations(), 1);
+
+				bbe::INTERNAL::endAllocatorTelemetryFrame();
+				assertEquals(pa.getTelemetry().getAmountOfAllocationsLastFrame(), 2);
+				int* c = pa.allocateObject(3);
+				bbe::INTERNAL::endAllocatorTelemetryFrame();
+				assertEquals(pa.getTelemetry().getAmountOfAllocationsLastFrame(), 1);
+
+				const bbe::List<bbe::Profiler::AllocatorStatistics> statistics = bbe::Profiler::getAllocatorStatistics();
+				const bbe::Profiler::AllocatorStatistics* s = findAllocatorStatistics(statistics, "TelemetryTestPool");
+				assertUnequals(s, nullptr);
+				assertEquals(s->liveBytes, 2 * sizeof(int));
+				assertEquals(s->peakBytes, 2 * sizeof(int));
+				assertEquals(s->capacityBytes, 16 * sizeof(int));
+				assertEquals(s->amountOfAllocations, 3);
+				assertEquals(s->amountOfDeallocations, 1);
+				assertEquals(s->amountOfFailedAllocations, 0);
+				assertEquals(s->amountOfAllocationsLastFrame, 1);
+
+				pa.deallocate(b);
+				pa.deallocate(c);
+			}
+			{
+				//Destroyed allocators leave the registry.
+				const bbe::List<bbe::Profiler::AllocatorStatistics> statistics = bbe::Profiler::getAllocatorStatistics();
+				assertEquals(findAllocatorStatistics(statistics, "TelemetryTestPool"), nullptr);
+			}
+			{
+				bbe::PoolAllocator<int, bbe::PoolAllocatorThreading::THREAD_SAFE> pa(64);
+				pa.getTelemetry().setName("TelemetryTestThreadSafePool");
+				int* a = pa.allocateObject(1);
+				int* b = pa.allocateObject(2);
+				pa.deallocate(a);
+
+				const bbe::List<bbe::Profiler::AllocatorStatistics> statistics = bbe::Profiler::getAllocatorStatistics();
+				const bbe::Profiler::AllocatorStatistics* s = findAllocatorStatistics(statistics, "TelemetryTestThreadSafePool");
+				assertUnequals(s, nullptr);
+				assertEquals(s->liveBytes, sizeof(int));
+				assertEquals(s->amountOfAllocations, 2);
+				assertEquals(s->amountOfDeallocations, 1);
+
+				pa.deallocate(b);
+			}
+			{
+				bbe::StackAllocator<> sa(128);
+				assertEquals(bbe::String(sa.getTelemetry().getName()), "StackAllocator");
+				auto marker = sa.getMarker();
+				sa.allocate(32);
+				sa.allocate(32);
+				assertEquals(sa.getTelemetry().getLiveBytes(), 64);
+				try
+				{
+					sa.allocate(1024);
+					debugBreak();
+				}
+				catch (bbe::AllocatorOutOfMemoryException e)
+				{
+					//expected
+				}
+				assertEquals(sa.getTelemetry().getAmountOfFailedAllocations(), 1);
+				sa.deallocateToMarker(marker);
+				assertEquals(sa.getTelemetry().getLiveBytes(), 0);
+				assertEquals(sa.getTelemetry().getPeakBytes(), 64);
+			}
+			{
+				bbe::GeneralPurposeAllocator gpa(1024, bbe::GeneralPurposeAllocatorMode::SEGREGATED_FIT);
+				auto p = gpa.allocateObjects<float>(10);
+				assertEquals(gpa.getTelemetry().getLiveBytes(), 10 * sizeof(float));
+				assertEquals(gpa.getTelemetry().getCapacityBytes(), 1024);
+				gpa.deallocate(p);
+				assertEquals(gpa.getTelemetry().getLiveBytes(), 0);
+				assertEquals(gpa.getTelemetry().getAmountOfDeallocations(), 1);
+			}
+			{
+				bbe::DefragmentationAllocator da(1024);
+				auto p = da.allocateObjects<float>(10);
+				assertEquals(da.getTelemetry().getLiveBytes(), 10 * sizeof(float));
+				da.deallocate(p);
+				assertEquals(da.getTelemetry().getLiveBytes(), 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "BBE/Grid2D.h"
+#include "BBE/UtilTest.h"
+#include <atomic>
+
+namespace bbe
+{
+	namespace test
+	{
+		template <typename Layout>
+		void testGrid2DLayout(int32_t width, int32_t height)
+		{
+			Grid2D<int32_t, Layout> grid(width, height, -1);
+			assertEquals(grid.getWidth(), width);
+			assertEquals(grid.getHeight(), height);
+			assertGreaterEquals(grid.getStorageLength(), static_cast<size_t>(width) * static_cast<size_t>(height));
+
+			//Every cell has its own storage and forEach visits each of them exactly once in storage order.
+			for (int32_t y = 0; y < height; y++)
+			{
+				for (int32_t x = 0; x < width; x++)
+				{
+					assertEquals(grid.get(x, y), -1);
+					grid.get(x, y) = x + y * width;
+				}
+			}
+			int32_t amountOfVisits = 0;
+			const int32_t* previous = nullptr;
+			grid.forEach([&](int32_t x, int32_t y, int32_t& cell)
+			{
+				assertEquals(cell, x + y * width);
+				if (previous != nullptr)
+				{
+					assertGreaterThan(&cell, previous);
+				}
+				previous = &cell;
+				amountOfVisits++;
+			});
+			assertEquals(amountOfVisits, width * height);
+
+			assertEquals(grid.getClamped(-5, -5), 0);
+			assertEquals(grid.getClamped(width + 3, -1), width - 1);
+			assertEquals(grid.getClamped(0, height + 100), (height - 1) * width);
+			assertEquals(grid[Vector2i(0, 2)], 2 * width);
+
+			Grid2D<int32_t, Layout> copy = grid;
+			copy.get(0, 0) = 1000;
+			assertEquals(grid.get(0, 0), 0);
+			Grid2D<int32_t, Layout> moved = std::move(copy);
+			assertEquals(moved.get(0, 0), 1000);
+			assertEquals(copy.getRaw(), nullptr);
+		}
+
+		void testGrid2D()
+		{
+			testGrid2DLayout<GridRowMajor>(13, 7);
+			testGrid2DLayout<GridTiled<>>(13, 7);
+			testGrid2DLayout<GridTiled<2>>(16, 16);
+			testGrid2DLayout<GridMorton>(13, 7);
+			testGrid2DLayout<GridMorton>(1, 40);
+
+			{
+				Grid2D<int32_t> grid(4, 3);
+				assertEquals(grid.isInBounds(0, 0), true);
+				assertEquals(grid.isInBounds(3, 2), true);
+				assertEquals(grid.isInBounds(4, 2), false);
+				assertEquals(grid.isInBounds(-1, 0), false);
+
+				Span<int32_t> row = grid.getRow(1);
+				assertEquals(row.getLength(), 4);
+				row[2] = 5;
+				assertEquals(grid.get(2, 1), 5);
+				assertEquals(grid.getRaw() + 4, row.getRaw());
+
+				int32_t amountOfNeighbours = 0;
+				grid.forEachNeighbour4(0, 0, [&](int32_t x, int32_t y, int32_t&) { amountOfNeighbours++; assertEquals(grid.isInBounds(x, y), true); });
+				assertEquals(amountOfNeighbours, 2);
+				amountOfNeighbours = 0;
+				grid.forEachNeighbour4(1, 1, [&](int32_t /*x*/, int32_t /*y*/, int32_t&) { amountOfNeighbours++; });
+				assertEquals(amountOfNeighbours, 4);
+				amountOfNeighbours = 0;
+				grid.forEachNeighbour8(3, 2, [&](int32_t x, int32_t y, int32_t&) { amountOfNeighbours++; assertEquals(grid.isInBounds(x, y), true); });
+				assertEquals(amountOfNeighbours, 3);
+				amountOfNeighbours = 0;
+				int32_t neighbourSum = 0;
+				grid.forEachNeighbour8(1, 1, [&](int32_t /*x*/, int32_t /*y*/, int32_t& cell) { amountOfNeighbours++; neighbourSum += cell; });
+				assertEquals(amountOfNeighbours, 8);
+				assertEquals(neighbourSum, 5);
+			}
+
+			{
+				//Big enough to actually be split over several threads.
+				Grid2D<int32_t> grid(300, 301);
+				std::atomic<int32_t> amountOfRows(0);
+				grid.parallelForRows([&](int32_t y)
+				{
+					Span<int32_t> row = grid.getRow(y);
+					for (int32_t x = 0; x < grid.getWidth(); x++)
+					{
+						row[x] += x * y;
+					}
+					amountOfRows++;
+				}, 4);
+				assertEquals(amountOfRows.load(), 301);
+				for (int32_t y = 0; y < grid.getHeight(); y++)
+				{
+					for (int32_t x = 0; x < grid.getWidth(); x++)
+					{
+						assertEquals(grid.get(x, y), x * y);
+					}
+				}
+			}
+
+			{
+				//An exception on the calling thread or on a worker reaches the caller after all threads joined.
+				Grid2D<int32_t> grid(300, 301);
+				for (int32_t throwingRow : { 300, 0 })
+				{
+					std::atomic<int32_t> amountOfRows(0);
+					bool threw = false;
+					try
+					{
+						grid.parallelForRows([&](int32_t y)
+						{
+							if (y == throwingRow)
+							{
+								throw IllegalArgumentException();
+							}
+							amountOfRows++;
+						}, 4);
+					}
+					catch (IllegalArgumentException)
+					{
+						threw = true;
+					}
+					assertEquals(threw, true);
+					if (throwingRow == 300)
+					{
+						assertEquals(amountOfRows.load(), 300);
+					}
+				}
+			}
+
+			{
+				Grid2D<int32_t> empty;
+				assertEquals(empty.getWidth(), 0);
+				assertEquals(empty.getStorageLength(), 0);
+				empty.forEach([](int32_t, int32_t, int32_t&) { debugBreak(); });
+				empty.parallelForRows([](int32_t) { debugBreak(); });
+			}
+		}
+	}
+}
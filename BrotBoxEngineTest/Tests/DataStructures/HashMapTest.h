@@ -13,7 +13,6 @@ namespace bbe
 	{
 		void testHashMap()
 		{
-			//TODO add more tests
 			{
 				HashMap<int, Person> hashMap;
 
@@ -52,7 +51,147 @@ namespace bbe
 					}
 				}
 			}
-			
+
+			{
+				HashMap<int, Person> hashMap;
+				assertEquals(hashMap.remove(5), false);
+
+				for (int i = 0; i < 1000; i++)
+				{
+					hashMap.add(i, Person("Name", "Addr", i));
+				}
+				assertEquals(hashMap.getLength(), 1000);
+
+				for (int i = 0; i < 1000; i += 2)
+				{
+					assertEquals(hashMap.remove(i), true);
+					assertEquals(hashMap.remove(i), false);
+				}
+				assertEquals(hashMap.getLength(), 500);
+
+				for (int i = 0; i < 1000; i++)
+				{
+					if (i % 2 == 0)
+					{
+						assertEquals(hashMap.get(i), nullptr);
+						assertEquals(hashMap.contains(i), false);
+					}
+					else
+					{
+						assertEquals(hashMap.get(i)->age, i);
+						assertEquals(hashMap.contains(i), true);
+					}
+				}
+
+				for (int i = 0; i < 1000; i += 2)
+				{
+					hashMap.add(i, Person("Readded", "Addr", i + 5000));
+				}
+				for (int i = 0; i < 1000; i++)
+				{
+					assertEquals(hashMap.get(i)->age, i % 2 == 0 ? i + 5000 : i);
+				}
+
+				bool threw = false;
+				try
+				{
+					hashMap.add(7, Person("Duplicate", "Addr", 7));
+				}
+				catch (KeyAlreadyUsedException)
+				{
+					threw = true;
+				}
+				assertEquals(threw, true);
+				assertEquals(hashMap.get(7)->name, "Name");
+			}
+
+			{
+				//Keys that share their lower bits must not pile up in a single probe sequence.
+				HashMap<int, int> hashMap;
+				hashMap.reserve(4096);
+				const size_t capacity = hashMap.getCapacity();
+				assertGreaterEquals(capacity, 4096);
+				for (int i = 0; i < 4096; i++)
+				{
+					hashMap.add(i * 1024, i);
+				}
+				assertEquals(hashMap.getCapacity(), capacity);
+				for (int i = 0; i < 4096; i++)
+				{
+					assertEquals(*hashMap.get(i * 1024), i);
+				}
+				for (int i = 0; i < 4096; i++)
+				{
+					assertEquals(hashMap.remove(i * 1024), true);
+				}
+				assertEquals(hashMap.isEmpty(), true);
+				assertEquals(hashMap.begin() == hashMap.end(), true);
+			}
+
+			{
+				HashMap<int, Person> hashMap;
+				Person& p = hashMap.emplace(3, "Emplaced", "EStr", 33);
+				assertEquals(p.name, "Emplaced");
+				assertEquals(hashMap.get(3)->age, 33);
+				assertEquals(hashMap.getOrEmplace(3, "Other", "OStr", 1).age, 33);
+				assertEquals(hashMap.getOrEmplace(4, "Other", "OStr", 1).age, 1);
+
+				for (int i = 10; i < 110; i++)
+				{
+					hashMap.add(i, Person("Iter", "IStr", i + 1000));
+				}
+
+				int sum = 0;
+				size_t amount = 0;
+				for (HashMap<int, Person>::HashMapNode& node : hashMap)
+				{
+					if (node.getValue().name == "Iter")
+					{
+						assertEquals(node.getKey() + 1000, node.getValue().age);
+					}
+					sum += node.getKey();
+					amount++;
+				}
+				assertEquals(amount, 102);
+				assertEquals(sum, 3 + 4 + (10 + 109) * 100 / 2);
+
+				HashMap<int, Person> copy(hashMap);
+				assertEquals(copy.getLength(), 102);
+				copy.get(3)->age = 1000;
+				assertEquals(hashMap.get(3)->age, 33);
+				assertEquals(copy.get(3)->age, 1000);
+
+				HashMap<int, Person> moved(std::move(copy));
+				assertEquals(copy.getLength(), 0);
+				assertEquals(copy.get(3), nullptr);
+				assertEquals(moved.get(3)->age, 1000);
+
+				copy = moved;
+				assertEquals(copy.get(50)->age, 1050);
+				moved = std::move(hashMap);
+				assertEquals(moved.get(3)->age, 33);
+
+				moved.clear();
+				assertEquals(moved.getLength(), 0);
+				assertEquals(moved.get(50), nullptr);
+			}
+
+			{
+				HashMap<int, int> hashMap;
+				hashMap.setMaxLoadFactor(0.5f);
+				assertEquals(hashMap.getMaxLoadFactor(), 0.5f);
+				for (int i = 0; i < 100; i++)
+				{
+					hashMap.add(i, i);
+				}
+				assertGreaterEquals(hashMap.getCapacity(), 200);
+				hashMap.setMaxLoadFactor(0.25f);
+				assertGreaterEquals(hashMap.getCapacity(), 400);
+				for (int i = 0; i < 100; i++)
+				{
+					assertEquals(*hashMap.get(i), i);
+				}
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -1369,6 +1369,34 @@ namespace bbe
 			Person::checkIfAllPersonsWereDestroyed();
 			Person::resetTestStatistics();
 
+			{
+				List<Person> emplaceList;
+				const int64_t movesBefore = Person::s_amountOfMoveConstructorCalls;
+				Person& first = emplaceList.emplace("Emplaced", "EStr", 21);
+				assertEquals(first.age, 21);
+				assertEquals(Person::s_amountOfMoveConstructorCalls, movesBefore);
+				for (int i = 0; i < 20; i++)
+				{
+					//Copies an element of the list itself while the list grows.
+					emplaceList.emplace(emplaceList[0]);
+				}
+				assertEquals(emplaceList.getLength(), 21);
+				assertEquals(emplaceList.last().name, "Emplaced");
+				assertEquals(emplaceList.last().age, 21);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+
+			{
+				//The default allocator must survive the rebind to the storage type and back.
+				List<int> allocatorList;
+				allocatorList.add(3);
+				const STLAllocator<int> allocator = allocatorList.getAllocator();
+				assertEquals(allocator == STLAllocator<int>(), true);
+				List<int> copiedAllocatorList(allocator);
+				copiedAllocatorList.add(4);
+				assertEquals(copiedAllocatorList[0], 4);
+			}
+
 			{
 				List<int> containsList;
 				containsList.addAll(1, 9, 9, 2, 6, 1, 7, 3, 2, 9, 5);
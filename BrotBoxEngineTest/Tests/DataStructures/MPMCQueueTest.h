@@ -0,0 +1,134 @@
+#pragma once
+
+#include "BBE/MPMCQueue.h"
+#include "BBE/UtilTest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace bbe
+{
+	namespace test
+	{
+		void testMPMCQueue()
+		{
+			{
+				MPMCQueue<Person> queue(6);
+				assertEquals(queue.getCapacity(), 8);
+				assertEquals(queue.isEmpty(), true);
+
+				for (int i = 0; i < 8; i++)
+				{
+					assertEquals(queue.tryEmplace("Queue", "QStr", i), true);
+				}
+				assertEquals(queue.tryPush(Person("Full", "FStr", 100)), false);
+				assertEquals(queue.getLength(), 8);
+
+				Person out[16];
+				assertEquals(queue.tryPopBatch(out, 3), 3);
+				assertEquals(out[2].age, 2);
+
+				Person batch[4] = { Person("B0", "", 10), Person("B1", "", 11), Person("B2", "", 12), Person("B3", "", 13) };
+				assertEquals(queue.tryPushBatch(batch, 4), 3);
+				assertEquals(queue.tryPushBatch(batch, 4), 0);
+
+				Person p;
+				for (int i = 3; i < 8; i++)
+				{
+					assertEquals(queue.tryPop(p), true);
+					assertEquals(p.age, i);
+				}
+				assertEquals(queue.tryPopBatch(out, 16), 3);
+				assertEquals(out[0].age, 10);
+				assertEquals(out[2].age, 12);
+				assertEquals(queue.tryPop(p), false);
+				assertEquals(queue.isEmpty(), true);
+
+				queue.tryEmplace("Left", "LStr", 1);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+			{
+				//Every value is pushed exactly once by one of the producers and must be
+				//popped exactly once by one of the consumers.
+				constexpr std::size_t amountOfProducers = 4;
+				constexpr std::size_t amountOfConsumers = 4;
+				constexpr std::size_t valuesPerProducer = 50000;
+				constexpr std::size_t amountOfValues = amountOfProducers * valuesPerProducer;
+				MPMCQueue<std::size_t> queue(128);
+				std::vector<std::atomic<unsigned char>> seen(amountOfValues);
+				std::atomic<std::size_t> amountOfPoppedValues{ 0 };
+
+				std::vector<std::thread> threads;
+				for (std::size_t t = 0; t < amountOfProducers; t++)
+				{
+					threads.emplace_back([&, t]()
+					{
+						std::size_t batch[4];
+						std::size_t next = t * valuesPerProducer;
+						const std::size_t end = next + valuesPerProducer;
+						while (next < end)
+						{
+							if (t % 2 == 0)
+							{
+								if (queue.tryPush(next))
+								{
+									next++;
+								}
+								else
+								{
+									std::this_thread::yield();
+								}
+								continue;
+							}
+							std::size_t amount = 0;
+							while (amount < 4 && next + amount < end)
+							{
+								batch[amount] = next + amount;
+								amount++;
+							}
+							const std::size_t pushed = queue.tryPushBatch(batch, amount);
+							if (pushed == 0)
+							{
+								std::this_thread::yield();
+							}
+							next += pushed;
+						}
+					});
+				}
+				for (std::size_t t = 0; t < amountOfConsumers; t++)
+				{
+					threads.emplace_back([&, t]()
+					{
+						std::size_t out[8];
+						while (amountOfPoppedValues.load(std::memory_order_relaxed) < amountOfValues)
+						{
+							const std::size_t amount = queue.tryPopBatch(out, t % 2 == 0 ? 1 : 8);
+							if (amount == 0)
+							{
+								std::this_thread::yield();
+							}
+							for (std::size_t i = 0; i < amount; i++)
+							{
+								seen[out[i]].fetch_add(1, std::memory_order_relaxed);
+							}
+							amountOfPoppedValues.fetch_add(amount, std::memory_order_relaxed);
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+
+				bool allSeenOnce = true;
+				for (std::size_t i = 0; i < amountOfValues; i++)
+				{
+					allSeenOnce &= seen[i].load(std::memory_order_relaxed) == 1;
+				}
+				assertEquals(allSeenOnce, true);
+				assertEquals(amountOfPoppedValues.load(), amountOfValues);
+				assertEquals(queue.isEmpty(), true);
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "BBE/SPSCRing.h"
+#include "BBE/UtilTest.h"
+#include <thread>
+
+namespace bbe
+{
+	namespace test
+	{
+		void testSPSCRing()
+		{
+			{
+				SPSCRing<Person> ring(5);
+				assertEquals(ring.getCapacity(), 8);
+				assertEquals(ring.isEmpty(), true);
+
+				for (int i = 0; i < 8; i++)
+				{
+					assertEquals(ring.tryEmplace("Ring", "RStr", i), true);
+				}
+				assertEquals(ring.tryPush(Person("Full", "FStr", 100)), false);
+				assertEquals(ring.getLength(), 8);
+
+				Person p;
+				for (int i = 0; i < 3; i++)
+				{
+					assertEquals(ring.tryPop(p), true);
+					assertEquals(p.age, i);
+				}
+				assertEquals(ring.getLength(), 5);
+
+				//Wraps around the end of the buffer.
+				Person batch[4] = { Person("B0", "", 10), Person("B1", "", 11), Person("B2", "", 12), Person("B3", "", 13) };
+				assertEquals(ring.tryPushBatch(batch, 4), 3);
+				assertEquals(ring.getLength(), 8);
+
+				Person out[16];
+				assertEquals(ring.tryPopBatch(out, 16), 8);
+				assertEquals(out[0].age, 3);
+				assertEquals(out[4].age, 7);
+				assertEquals(out[5].age, 10);
+				assertEquals(out[7].age, 12);
+				assertEquals(ring.tryPop(p), false);
+				assertEquals(ring.tryPopBatch(out, 16), 0);
+
+				//Left over elements are destroyed with the ring.
+				ring.tryEmplace("Left", "LStr", 1);
+				ring.tryEmplace("Over", "OStr", 2);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+			{
+				//Person counts its instances in unsynchronized statics, so the threads use a plain type.
+				constexpr std::size_t amountOfValues = 200000;
+				SPSCRing<std::size_t> ring(256);
+				std::thread producer([&]()
+				{
+					std::size_t batch[7];
+					std::size_t next = 0;
+					while (next < amountOfValues)
+					{
+						if (next % 3 == 0)
+						{
+							if (ring.tryPush(next))
+							{
+								next++;
+							}
+							else
+							{
+								std::this_thread::yield();
+							}
+							continue;
+						}
+						std::size_t amount = 0;
+						while (amount < 7 && next + amount < amountOfValues)
+						{
+							batch[amount] = next + amount;
+							amount++;
+						}
+						const std::size_t pushed = ring.tryPushBatch(batch, amount);
+						if (pushed == 0)
+						{
+							std::this_thread::yield();
+						}
+						next += pushed;
+					}
+				});
+
+				std::size_t expected = 0;
+				std::size_t sum = 0;
+				bool inOrder = true;
+				std::size_t out[5];
+				while (expected < amountOfValues)
+				{
+					const std::size_t amount = ring.tryPopBatch(out, expected % 2 == 0 ? 1 : 5);
+					if (amount == 0)
+					{
+						std::this_thread::yield();
+					}
+					for (std::size_t i = 0; i < amount; i++)
+					{
+						inOrder &= out[i] == expected;
+						sum += out[i];
+						expected++;
+					}
+				}
+				producer.join();
+				assertEquals(inOrder, true);
+				assertEquals(sum, amountOfValues * (amountOfValues - 1) / 2);
+				assertEquals(ring.isEmpty(), true);
+			}
+		}
+	}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "BBE/SmallList.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		void testSmallList()
+		{
+			{
+				SmallList<int, 4> list;
+				assertEquals(list.getLength(), 0);
+				assertEquals(list.getCapacity(), 4);
+				assertEquals(list.isEmpty(), true);
+				assertEquals(list.isSmall(), true);
+
+				for (int i = 0; i < 4; i++)
+				{
+					list.add(i);
+				}
+				assertEquals(list.getLength(), 4);
+				assertEquals(list.isSmall(), true);
+
+				list.add(4);
+				assertEquals(list.getLength(), 5);
+				assertEquals(list.isSmall(), false);
+				for (int i = 0; i < 5; i++)
+				{
+					assertEquals(list[i], i);
+				}
+
+				list.popBack(2);
+				assertEquals(list.shrink(), true);
+				assertEquals(list.isSmall(), true);
+				assertEquals(list.getCapacity(), 4);
+				assertEquals(list.getLength(), 3);
+				assertEquals(list[2], 2);
+
+				int sum = 0;
+				for (int i : list)
+				{
+					sum += i;
+				}
+				assertEquals(sum, 3);
+			}
+
+			{
+				SmallList<Person, 3> list;
+				list.add(Person("A", "AStr", 1));
+				list.emplace("B", "BStr", 2);
+				list.add(Person("C", "CStr", 3));
+
+				SmallList<Person, 3> copy(list);
+				assertEquals(copy.isSmall(), true);
+				assertEquals(copy.getLength(), 3);
+				assertEquals(copy[1].name, "B");
+
+				SmallList<Person, 3> moved(std::move(copy));
+				assertEquals(copy.getLength(), 0);
+				assertEquals(moved.getLength(), 3);
+				assertEquals(moved[2].name, "C");
+
+				moved.add(Person("D", "DStr", 4));
+				moved.add(Person("E", "EStr", 5));
+				assertEquals(moved.isSmall(), false);
+
+				SmallList<Person, 3> movedHeap(std::move(moved));
+				assertEquals(moved.getLength(), 0);
+				assertEquals(moved.isSmall(), true);
+				assertEquals(movedHeap.getLength(), 5);
+				assertEquals(movedHeap[4].name, "E");
+
+				assertEquals(movedHeap.removeIndex(0), true);
+				assertEquals(movedHeap[0].name, "B");
+				assertEquals(movedHeap.removeSingle(Person("D", "DStr", 4)), true);
+				assertEquals(movedHeap.getLength(), 3);
+				assertEquals(movedHeap.contains(Person("D", "DStr", 4)), false);
+				assertEquals(movedHeap.contains(Person("E", "EStr", 5)), true);
+
+				assertEquals(movedHeap.removeAll([](const Person& p) { return p.age >= 3; }), 2);
+				assertEquals(movedHeap.getLength(), 1);
+				assertEquals(movedHeap.last().name, "B");
+
+				list = movedHeap;
+				assertEquals(list.getLength(), 1);
+				assertEquals(list.first().name, "B");
+
+				list = SmallList<Person, 3>();
+				assertEquals(list.getLength(), 0);
+			}
+
+			{
+				SmallList<int, 8> list = { 5, 3, 8, 1 };
+				list.sort();
+				assertEquals(list[0], 1);
+				assertEquals(list[3], 8);
+				assertEquals(list.containsAmount(3), 1);
+				assertEquals(*list.find(5), 5);
+				assertEquals(list.find(17), nullptr);
+
+				List<int> asList = list.toList();
+				assertEquals(asList.getLength(), 4);
+				assertEquals(asList[1], 3);
+
+				SmallList<int, 8> fromList(asList);
+				assertEquals(fromList == list, true);
+				fromList.resizeCapacityAndLength(10);
+				assertEquals(fromList.getLength(), 10);
+				assertEquals(fromList[9], 0);
+				assertEquals(fromList.isSmall(), false);
+			}
+
+			{
+				//The same predicate overloads as List, lambdas and std::function.
+				SmallList<int, 8> list = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+				assertEquals(list.containsAmount([](int i) { return i % 2 == 0; }), 4);
+				assertEquals(list.contains([](int i) { return i > 8; }), true);
+				assertEquals(list.containsUnique([](int i) { return i > 8; }), true);
+				assertEquals(*list.find([](int i) { return i > 4; }), 5);
+				assertEquals(*list.findLast([](int i) { return i < 4; }), 3);
+				assertEquals(list.findLast([](int i) { return i > 100; }), nullptr);
+				const std::function<bool(const int&)> isSeven = [](const int& i) { return i == 7; };
+				assertEquals(list.removeSingle(isSeven), true);
+				assertEquals(list.removeSingle(isSeven), false);
+				assertEquals(list.removeAll([](int i) { return i % 3 == 0; }), 3);
+				assertEquals(list.getLength(), 5);
+				assertEquals(list[0], 1);
+				assertEquals(list[4], 8);
+				list.sort([](int a, int b) { return a > b; });
+				assertEquals(list[0], 8);
+				assertEquals(list[4], 1);
+
+				assertEquals(list.removeIndexUnordered(0), true);
+				assertEquals(list[0], 1);
+				assertEquals(list.removeIndexUnordered(10), false);
+				assertEquals(list.removeAllUnordered([](int i) { return i < 3; }), 2);
+				assertEquals(list.getLength(), 2);
+				assertEquals(list.containsAmount(4) + list.containsAmount(5), 2);
+			}
+		}
+	}
+}
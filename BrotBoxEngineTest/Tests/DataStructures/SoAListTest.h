@@ -0,0 +1,96 @@
+#pragma once
+
+#include "BBE/SoAList.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		void testSoAList()
+		{
+			{
+				SoAList<float, Person, int> list;
+				assertEquals(list.getLength(), 0);
+				assertEquals(list.isEmpty(), true);
+
+				for (int i = 0; i < 100; i++)
+				{
+					list.add(i * 0.5f, Person("SoA", "SStr", i), i * 2);
+				}
+				assertEquals(list.getLength(), 100);
+				assertGreaterEquals(list.getCapacity(), 100);
+				assertEquals(list.get<0>(10), 5.f);
+				assertEquals(list.get<1>(10).age, 10);
+				assertEquals(list.get<2>(10), 20);
+
+				//Columns are contiguous and cache line aligned.
+				Span<float> floats = list.getColumn<0>();
+				Span<int> ints = list.getColumn<2>();
+				assertEquals(floats.getLength(), 100);
+				assertEquals(reinterpret_cast<std::size_t>(floats.getRaw()) % 64, 0);
+				assertEquals(reinterpret_cast<std::size_t>(ints.getRaw()) % 64, 0);
+				assertEquals(&floats[1] - &floats[0], 1);
+				int sum = 0;
+				for (int value : ints)
+				{
+					sum += value;
+				}
+				assertEquals(sum, 9900);
+
+				for (auto [f, person, i] : list)
+				{
+					f += 1.f;
+					person.age++;
+					i = -i;
+				}
+				assertEquals(list.get<0>(0), 1.f);
+				assertEquals(list.get<1>(99).age, 100);
+				assertEquals(list.get<2>(99), -198);
+
+				auto [f, person, i] = list[50];
+				assertEquals(f, 26.f);
+				assertEquals(person.age, 51);
+				assertEquals(i, -100);
+
+				list.removeIndexUnordered(0);
+				assertEquals(list.getLength(), 99);
+				assertEquals(list.get<1>(0).age, 100);
+				assertEquals(list.get<2>(0), -198);
+				list.removeIndexUnordered(98);
+				assertEquals(list.getLength(), 98);
+				assertEquals(list.get<1>(97).age, 98);
+
+				SoAList<float, Person, int> copy(list);
+				assertEquals(copy.getLength(), 98);
+				assertEquals(copy.get<1>(0).age, 100);
+				copy.get<1>(0).age = 5;
+				assertEquals(list.get<1>(0).age, 100);
+
+				SoAList<float, Person, int> moved(std::move(copy));
+				assertEquals(moved.getLength(), 98);
+				assertEquals(moved.get<1>(0).age, 5);
+				assertEquals(copy.getLength(), 0);
+
+				copy = moved;
+				assertEquals(copy.getLength(), 98);
+				moved = std::move(list);
+				assertEquals(moved.get<1>(0).age, 100);
+				assertEquals(list.getLength(), 0);
+
+				const SoAList<float, Person, int>& constList = moved;
+				int count = 0;
+				for (auto [cf, cperson, ci] : constList)
+				{
+					count += cperson.age > 0 ? 1 : 0;
+				}
+				assertEquals(count, 98);
+				assertEquals(constList.getColumn<1>()[0].age, 100);
+
+				moved.clear();
+				assertEquals(moved.getLength(), 0);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+		}
+	}
+}
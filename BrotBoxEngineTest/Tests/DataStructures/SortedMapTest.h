@@ -0,0 +1,297 @@
+#pragma once
+
+#include "BBE/SortedMap.h"
+#include "BBE/SortedSet.h"
+#include "BBE/UtilTest.h"
+#include "BBE/UtilDebug.h"
+#include <map>
+
+
+namespace bbe
+{
+	namespace test
+	{
+		//Big enough that inner nodes only get the minimal capacity of 4 keys.
+		struct SortedMapTestKey64
+		{
+			uint64_t value;
+			uint64_t padding[7];
+
+			SortedMapTestKey64(uint64_t value)
+				: value(value), padding{}
+			{
+				//do nothing
+			}
+
+			bool operator<(const SortedMapTestKey64& other) const
+			{
+				return value < other.value;
+			}
+		};
+
+		void testSortedMap()
+		{
+			{
+				SortedMap<int, Person> map;
+				assertEquals(map.isEmpty(), true);
+				assertEquals(map.get(1), nullptr);
+				assertEquals(map.remove(1), false);
+				assertEquals(map.begin() == map.end(), true);
+
+				//Reversed insertion order, Persons are big enough to get the minimal node size.
+				for (int i = 999; i >= 0; i--)
+				{
+					map.add(i, Person("Name", "Addr", i));
+				}
+				assertEquals(map.getLength(), 1000);
+				int expected = 0;
+				for (auto entry : map)
+				{
+					assertEquals(entry.getKey(), expected);
+					assertEquals(entry.getValue().age, expected);
+					expected++;
+				}
+				assertEquals(expected, 1000);
+
+				try
+				{
+					map.add(5, Person("Dup", "Dup", 0));
+					debugBreak();
+				}
+				catch (KeyAlreadyUsedException e)
+				{
+					//expected
+				}
+				assertEquals(map.getOrEmplace(5).age, 5);
+				assertEquals(map.emplace(1000, "New", "NStr", 1000).age, 1000);
+
+				for (int i = 0; i <= 1000; i += 2)
+				{
+					assertEquals(map.remove(i), true);
+				}
+				assertEquals(map.remove(0), false);
+				assertEquals(map.getLength(), 500);
+				for (int i = 0; i < 1000; i++)
+				{
+					assertEquals(map.contains(i), i % 2 == 1);
+				}
+
+				assertEquals(map.lowerBound(10).getKey(), 11);
+				assertEquals(map.lowerBound(11).getKey(), 11);
+				assertEquals(map.upperBound(11).getKey(), 13);
+				assertEquals(map.lowerBound(-5).getKey(), 1);
+				assertEquals(map.lowerBound(999) == map.end(), false);
+				assertEquals(map.upperBound(999) == map.end(), true);
+
+				assertEquals(map.removeRange(100, 200), 50);
+				assertEquals(map.getLength(), 450);
+				assertEquals(map.lowerBound(100).getKey(), 201);
+				assertEquals(map.upperBound(99).getKey(), 201);
+
+				SortedMap<int, Person> copy = map;
+				SortedMap<int, Person> moved = std::move(copy);
+				assertEquals(moved.getLength(), 450);
+				assertEquals(moved.get(201)->age, 201);
+				map.clear();
+				assertEquals(map.getLength(), 0);
+				assertEquals(moved.get(201)->age, 201);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+			{
+				//Random operations against std::map, so every split, borrow and merge path runs.
+				SortedMap<uint32_t, uint32_t> map;
+				std::map<uint32_t, uint32_t> reference;
+				uint32_t seed = 12345;
+				for (int i = 0; i < 200000; i++)
+				{
+					seed = seed * 1664525u + 1013904223u;
+					const uint32_t key = (seed >> 8) % 5000;
+					if ((seed >> 4) % 3 == 0)
+					{
+						assertEquals(map.remove(key), reference.erase(key) == 1);
+					}
+					else
+					{
+						map.getOrEmplace(key, key * 2);
+						reference.emplace(key, key * 2);
+					}
+					if (i % 20000 == 0)
+					{
+						assertEquals(map.removeRange(key, key + 100), (size_t)std::distance(reference.lower_bound(key), reference.lower_bound(key + 100)));
+						reference.erase(reference.lower_bound(key), reference.lower_bound(key + 100));
+					}
+				}
+				assertEquals(map.getLength(), reference.size());
+				assertEquals(map.isWellFormed(), true);
+				auto it = reference.begin();
+				for (auto entry : map)
+				{
+					assertEquals(entry.getKey(), it->first);
+					assertEquals(entry.getValue(), it->second);
+					++it;
+				}
+				for (uint32_t key = 0; key < 5000; key += 7)
+				{
+					auto lower = map.lowerBound(key);
+					auto upper = map.upperBound(key);
+					assertEquals(lower == map.end(), reference.lower_bound(key) == reference.end());
+					assertEquals(upper == map.end(), reference.upper_bound(key) == reference.end());
+					if (lower != map.end())
+					{
+						assertEquals(lower.getKey(), reference.lower_bound(key)->first);
+					}
+					if (upper != map.end())
+					{
+						assertEquals(upper.getKey(), reference.upper_bound(key)->first);
+					}
+				}
+				map.removeRange(0, 5000);
+				assertEquals(map.isEmpty(), true);
+				assertEquals(map.begin() == map.end(), true);
+			}
+			{
+				//Ranges from a few entries to most of the map, followed by single operations that rely on
+				//removeRange having left every node at least half full.
+				SortedMap<uint32_t, uint32_t> map;
+				std::map<uint32_t, uint32_t> reference;
+				uint32_t seed = 777;
+				for (int round = 0; round < 300; round++)
+				{
+					for (int i = 0; i < 2000; i++)
+					{
+						seed = seed * 1664525u + 1013904223u;
+						const uint32_t key = (seed >> 8) % 20000;
+						if ((seed >> 4) % 4 == 0)
+						{
+							assertEquals(map.remove(key), reference.erase(key) == 1);
+						}
+						else
+						{
+							map.getOrEmplace(key, key + 1);
+							reference.emplace(key, key + 1);
+						}
+					}
+					seed = seed * 1664525u + 1013904223u;
+					const uint32_t from = (seed >> 8) % 20000;
+					const uint32_t to = from + (1u << (round % 15));
+					assertEquals(map.removeRange(from, to), (size_t)std::distance(reference.lower_bound(from), reference.lower_bound(to)));
+					reference.erase(reference.lower_bound(from), reference.lower_bound(to));
+
+					assertEquals(map.getLength(), reference.size());
+					assertEquals(map.isWellFormed(), true);
+					auto it = reference.begin();
+					for (auto entry : map)
+					{
+						assertEquals(entry.getKey(), it->first);
+						assertEquals(entry.getValue(), it->second);
+						++it;
+					}
+				}
+				assertEquals(map.removeRange(5, 5), 0);
+				assertEquals(map.removeRange(10, 5), 0);
+			}
+			{
+				//8 byte keys like the pointers of the GeneralPurposeAllocator free list give inner nodes an
+				//even capacity. Splitting those must still leave both halves at least half full.
+				SortedMap<uint64_t, uint64_t> map;
+				std::map<uint64_t, uint64_t> reference;
+				uint32_t seed = 4242;
+				for (int i = 0; i < 100000; i++)
+				{
+					seed = seed * 1664525u + 1013904223u;
+					const uint64_t key = ((uint64_t)((seed >> 8) % 30000) << 4) | 0x100000000ull;
+					if ((seed >> 4) % 3 == 0)
+					{
+						assertEquals(map.remove(key), reference.erase(key) == 1);
+					}
+					else
+					{
+						map.getOrEmplace(key, key);
+						reference.emplace(key, key);
+					}
+					if (i % 5000 == 0)
+					{
+						assertEquals(map.isWellFormed(), true);
+						assertEquals(map.removeRange(key, key + 1600), (size_t)std::distance(reference.lower_bound(key), reference.lower_bound(key + 1600)));
+						reference.erase(reference.lower_bound(key), reference.lower_bound(key + 1600));
+						assertEquals(map.isWellFormed(), true);
+					}
+				}
+				assertEquals(map.getLength(), reference.size());
+				assertEquals(map.isWellFormed(), true);
+				for (auto entry : map)
+				{
+					assertEquals(entry.getValue(), entry.getKey());
+				}
+			}
+			for (uint32_t seed = 0; seed < 8; seed++)
+			{
+				//Nodes with only 4 keys need several rounds of borrows and merges after a removeRange.
+				SortedMap<SortedMapTestKey64, int> map;
+				std::map<uint64_t, int> reference;
+				uint32_t state = seed;
+				for (int i = 0; i < 20000; i++)
+				{
+					state = state * 1664525u + 1013904223u;
+					const uint64_t key = (state >> 8) % 3000;
+					const uint32_t operation = (state >> 4) % 16;
+					if (operation < 9)
+					{
+						map.getOrEmplace(key, (int)key);
+						reference.emplace(key, (int)key);
+					}
+					else if (operation < 15)
+					{
+						assertEquals(map.remove(key), reference.erase(key) == 1);
+					}
+					else
+					{
+						const uint64_t to = key + (state >> 20) % 600;
+						assertEquals(map.removeRange(key, to), (size_t)std::distance(reference.lower_bound(key), reference.lower_bound(to)));
+						reference.erase(reference.lower_bound(key), reference.lower_bound(to));
+						assertEquals(map.isWellFormed(), true);
+						assertEquals(map.getLength(), reference.size());
+						auto it = reference.begin();
+						for (auto entry : map)
+						{
+							assertEquals(entry.getKey().value, it->first);
+							assertEquals(entry.getValue(), it->second);
+							++it;
+						}
+						assertEquals(it == reference.end(), true);
+					}
+				}
+			}
+		}
+
+		void testSortedSet()
+		{
+			SortedSet<int> set;
+			assertEquals(set.add(5), true);
+			assertEquals(set.add(3), true);
+			assertEquals(set.add(5), false);
+			assertEquals(set.add(9), true);
+			assertEquals(set.getLength(), 3);
+			assertEquals(set.contains(3), true);
+			assertEquals(set.contains(4), false);
+			assertEquals(*set.lowerBound(4), 5);
+			assertEquals(*set.upperBound(5), 9);
+			assertEquals(set.upperBound(9) == set.end(), true);
+
+			int sum = 0;
+			int last = -1;
+			for (int key : set)
+			{
+				assertEquals(key > last, true);
+				last = key;
+				sum += key;
+			}
+			assertEquals(sum, 17);
+
+			assertEquals(set.removeRange(4, 10), 2);
+			assertEquals(set.remove(3), true);
+			assertEquals(set.remove(3), false);
+			assertEquals(set.isEmpty(), true);
+		}
+	}
+}
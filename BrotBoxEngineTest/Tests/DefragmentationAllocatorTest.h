@@ -235,6 +235,53 @@ namespace bbe {
 				assertEquals(da.needsDefragmentation(), false);
 			}
 
+			{
+				DefragmentationAllocator da(100000);
+				assertEquals(da.getAmountOfFreeChunks(), 1);
+				assertEquals(da.getWastedBytes(), 0);
+				assertEquals(da.getFragmentation(), 0.f);
+
+				//Tiny blocks between the person arrays leave gaps smaller than a Person,
+				//so relocating the arrays has to deal with overlapping memory.
+				List<DefragmentationAllocator::DefragmentationAllocatorPointer<byte>> gaps;
+				List<DefragmentationAllocator::DefragmentationAllocatorPointer<Person>> persons;
+				for (int i = 0; i < 20; i++)
+				{
+					gaps.add(da.allocateObject<byte>());
+					persons.add(da.allocateObjects<Person>(3, "Defrag", "DStr", i));
+				}
+				const size_t freeBytesBefore = da.getFreeBytes();
+				for (size_t i = 0; i < gaps.getLength(); i++)
+				{
+					da.deallocate(gaps[i]);
+				}
+				assertEquals(da.needsDefragmentation(), true);
+				assertGreaterThan(da.getAmountOfFreeChunks(), 1);
+				assertGreaterThan(da.getWastedBytes(), 0);
+				assertGreaterThan(da.getFragmentation(), 0.f);
+				assertEquals(da.getLargestFreeBlock() + da.getWastedBytes(), da.getFreeBytes());
+				assertGreaterThan(da.getFreeBytes(), freeBytesBefore);
+
+				assertEquals(da.defragment(1000000, 1), 1);
+				assertEquals(da.defragment(0), 0);
+				const size_t moves = da.defragment(1000000);
+				assertGreaterThan(moves, 0);
+				assertEquals(da.needsDefragmentation(), false);
+				assertEquals(da.getAmountOfFreeChunks(), 1);
+				assertEquals(da.getWastedBytes(), 0);
+				assertEquals(da.defragment(1000000), 0);
+
+				for (size_t i = 0; i < persons.getLength(); i++)
+				{
+					for (int k = 0; k < 3; k++)
+					{
+						assertEquals(persons[i][k].name, "Defrag");
+						assertEquals(persons[i][k].age, (int)i);
+					}
+					da.deallocate(persons[i]);
+				}
+			}
+
 		}
 	}
 }
\ No newline at end of file
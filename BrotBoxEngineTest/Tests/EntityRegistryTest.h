@@ -0,0 +1,147 @@
+#pragma once
+
+#include "BBE/EntityRegistry.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		struct EntityRegistryTestPosition
+		{
+			float x = 0;
+			float y = 0;
+		};
+
+		struct EntityRegistryTestVelocity
+		{
+			float x = 0;
+			float y = 0;
+		};
+
+		void testEntityRegistry()
+		{
+			typedef EntityRegistryTestPosition Position;
+			typedef EntityRegistryTestVelocity Velocity;
+			{
+				EntityRegistry registry;
+				Entity a = registry.create();
+				Entity b = registry.create();
+				Entity c = registry.create();
+				assertEquals(registry.getAmountOfEntities(), 3);
+				assertEquals(registry.isAlive(a), true);
+				assertEquals(Entity().isNull(), true);
+				assertEquals(a.isNull(), false);
+				assertUnequals(a, b);
+
+				registry.addComponent<Position>(a, Position{ 1, 2 });
+				registry.addComponent<Position>(b, Position{ 3, 4 });
+				registry.addComponent<Position>(c, Position{ 5, 6 });
+				registry.addComponent<Velocity>(b, Velocity{ 10, 10 });
+				const int64_t movesBeforeAdd = Person::s_amountOfMoveConstructorCalls;
+				registry.addComponent<Person>(c, "Entity", "EStr", 33);
+				//Constructed in place, no temporary is moved into the pool.
+				assertEquals(Person::s_amountOfMoveConstructorCalls, movesBeforeAdd);
+
+				assertEquals(registry.hasComponent<Position>(a), true);
+				assertEquals(registry.hasComponent<Velocity>(a), false);
+				assertEquals(registry.tryGetComponent<Velocity>(a), nullptr);
+				assertEquals(registry.getComponent<Position>(b).x, 3.f);
+				assertEquals(registry.getComponent<Person>(c).age, 33);
+				assertEquals(registry.getAmountOfComponents<Position>(), 3);
+
+				try
+				{
+					registry.addComponent<Velocity>(b);
+					debugBreak();
+				}
+				catch (KeyAlreadyUsedException e)
+				{
+					//expected
+				}
+
+				//Only b has both, and the velocity set is the smaller one that gets walked.
+				auto view = registry.view<Position, Velocity>();
+				assertEquals(view.getSizeHint(), 1);
+				int visited = 0;
+				view.forEach([&](Entity entity, Position& pos, Velocity& vel)
+				{
+					assertEquals(entity, b);
+					pos.x += vel.x;
+					pos.y += vel.y;
+					visited++;
+				});
+				assertEquals(visited, 1);
+				assertEquals(registry.getComponent<Position>(b).x, 13.f);
+
+				float sum = 0;
+				registry.view<Position>().forEach([&](Entity /*entity*/, Position& pos)
+				{
+					sum += pos.x;
+				});
+				assertEquals(sum, 19.f);
+
+				//Swap and pop keeps the remaining components reachable.
+				registry.removeComponent<Position>(a);
+				assertEquals(registry.hasComponent<Position>(a), false);
+				assertEquals(registry.getComponent<Position>(c).y, 6.f);
+				assertEquals(registry.getComponent<Position>(b).y, 14.f);
+				assertEquals(registry.getAmountOfComponents<Position>(), 2);
+				registry.removeComponent<Position>(a);
+
+				//Destroying invalidates old handles, the index gets reused with a new generation.
+				registry.destroy(c);
+				assertEquals(registry.isAlive(c), false);
+				assertEquals(registry.hasComponent<Position>(c), false);
+				assertEquals(registry.tryGetComponent<Person>(c), nullptr);
+				assertEquals(registry.getAmountOfComponents<Person>(), 0);
+				Person::checkIfAllPersonsWereDestroyed();
+				Entity d = registry.create();
+				assertEquals(d.m_index, c.m_index);
+				assertUnequals(d, c);
+				assertEquals(registry.hasComponent<Position>(d), false);
+				assertEquals(registry.getAmountOfEntities(), 3);
+
+				try
+				{
+					registry.addComponent<Position>(c);
+					debugBreak();
+				}
+				catch (IllegalArgumentException e)
+				{
+					//expected
+				}
+
+				registry.addComponent<Person>(d, "Left", "LStr", 1);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+			{
+				EntityRegistry registry;
+				List<Entity> entities;
+				for (int i = 0; i < 1000; i++)
+				{
+					Entity e = registry.create();
+					entities.add(e);
+					registry.addComponent<Position>(e, Position{ (float)i, 0 });
+					if (i % 3 == 0)
+					{
+						registry.addComponent<Velocity>(e, Velocity{ 1, 0 });
+					}
+				}
+				for (int i = 0; i < 1000; i += 2)
+				{
+					registry.destroy(entities[i]);
+				}
+				int amount = 0;
+				registry.view<Velocity, Position>().forEach([&](Entity entity, Velocity& /*vel*/, Position& pos)
+				{
+					assertEquals((int)pos.x % 2, 1);
+					assertEquals((int)pos.x % 3, 0);
+					assertEquals(registry.isAlive(entity), true);
+					amount++;
+				});
+				assertEquals(amount, 167);
+			}
+		}
+	}
+}
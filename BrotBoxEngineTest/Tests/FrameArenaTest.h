@@ -0,0 +1,82 @@
+#pragma once
+
+#include "BBE/FrameArena.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe {
+	namespace test {
+		void testFrameArena() {
+			{
+				bbe::FrameArena arena(256);
+				assertEquals(arena.getUsedBytes(), 0);
+				assertEquals(arena.getCapacity(), 256);
+
+				double* d = static_cast<double*>(arena.allocate(sizeof(double) * 4, alignof(double)));
+				assertEquals(reinterpret_cast<std::size_t>(d) % alignof(double), 0);
+				d[3] = 3.5;
+				assertEquals(arena.getUsedBytes(), sizeof(double) * 4);
+
+				Person* p = arena.allocateObjects<Person>(3, "Frame", "FStr", 7);
+				assertEquals(p[2].name, "Frame");
+				assertEquals(p[2].age, 7);
+
+				//Does not fit into the first block, so a second one is chained.
+				byte* big = static_cast<byte*>(arena.allocate(1000));
+				big[999] = 1;
+				assertGreaterEquals(arena.getCapacity(), 1256);
+				assertEquals(d[3], 3.5);
+
+				//The memory of the last frame survives one more frame.
+				arena.endFrame();
+				assertEquals(arena.getUsedBytes(), 0);
+				assertEquals(p[0].name, "Frame");
+				assertEquals(d[3], 3.5);
+
+				//The persons get destroyed and both blocks are merged into one.
+				arena.endFrame();
+				Person::checkIfAllPersonsWereDestroyed();
+				assertEquals(arena.getUsedBytes(), 0);
+				assertGreaterEquals(arena.getCapacity(), 1256);
+				assertGreaterEquals(arena.getPeakUsedBytes(), 1000 + sizeof(double) * 4 + sizeof(Person) * 3);
+			}
+
+			{
+				bbe::FrameArena arena(1024);
+				bbe::FrameList<int> list{ bbe::FrameAllocator<int>(arena) };
+				for (int i = 0; i < 100; i++)
+				{
+					list.add(i);
+				}
+				assertEquals(list.getLength(), 100);
+				assertEquals(list[99], 99);
+				assertGreaterEquals(arena.getUsedBytes(), 100 * sizeof(int));
+
+				bbe::FrameList<Person> persons{ bbe::FrameAllocator<Person>(arena) };
+				persons.add(Person("A", "AStr", 1));
+				persons.add(Person("B", "BStr", 2));
+				bbe::FrameList<Person> moved(std::move(persons));
+				assertEquals(moved.getLength(), 2);
+				assertEquals(moved[1].name, "B");
+				assertEquals(moved.getAllocator().getParentArena(), &arena);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+
+			{
+				//Without a running game there is no current arena and the heap is used.
+				assertEquals(bbe::FrameArena::getCurrent(), nullptr);
+				bbe::FrameList<int> list;
+				list.add(1);
+				list.add(2);
+				assertEquals(list[1], 2);
+
+				bbe::FrameArena arena;
+				arena.makeCurrent();
+				assertEquals(bbe::FrameArena::getCurrent(), &arena);
+				bbe::FrameList<int> current;
+				current.add(5);
+				assertEquals(arena.getUsedBytes() > 0, true);
+			}
+			assertEquals(bbe::FrameArena::getCurrent(), nullptr);
+		}
+	}
+}
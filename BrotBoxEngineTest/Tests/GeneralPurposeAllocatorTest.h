@@ -134,6 +134,65 @@ namespace bbe {
 				gpa.deallocate(f1);
 			}
 
+			{
+				GeneralPurposeAllocator gpa(1024 * 1024, GeneralPurposeAllocatorMode::SEGREGATED_FIT);
+				assertEquals(gpa.getMode(), GeneralPurposeAllocatorMode::SEGREGATED_FIT);
+
+				auto persons = gpa.allocateObjects<Person>(10, "Seg", "SStr", 3);
+				auto floats = gpa.allocateObjects<float>(1000);
+				auto aligned = gpa.allocateObjectsAligned<float, 128>(3);
+				auto small = gpa.allocateObject<byte>();
+				assertEquals(reinterpret_cast<size_t>(aligned.getRaw()) % 128, 0);
+				assertEquals(reinterpret_cast<size_t>(floats.getRaw()) % alignof(float), 0);
+				for (int i = 0; i < 1000; i++)
+				{
+					floats[i] = (float)i;
+				}
+				*small.getRaw() = 17;
+				aligned[2] = 5.f;
+				assertEquals(persons[9].name, "Seg");
+				assertEquals(floats[999], 999);
+				assertEquals(*small.getRaw(), 17);
+
+				gpa.deallocate(floats);
+				gpa.deallocate(persons);
+				assertEquals(aligned[2], 5.f);
+				gpa.deallocate(aligned);
+				gpa.deallocate(small);
+			}
+
+			{
+				//Random allocations of very different sizes. Everything has to be
+				//coalesced again at the end, which the destructor checks.
+				GeneralPurposeAllocator gpa(4 * 1024 * 1024, GeneralPurposeAllocatorMode::SEGREGATED_FIT);
+				List<GeneralPurposeAllocator::GeneralPurposeAllocatorPointer<int>> list;
+				List<int> expected;
+				Random rand;
+				for (int i = 0; i < 20000; i++)
+				{
+					if (rand.randomBool() && list.getLength() < 256)
+					{
+						const int amount = rand.randomInt(2) == 0 ? rand.randomInt(16) + 1 : rand.randomInt(4096) + 1;
+						auto p = gpa.allocateObjects<int>(amount, i);
+						list.add(p);
+						expected.add(i);
+					}
+					else if (list.getLength() > 0)
+					{
+						size_t index = (size_t)rand.randomInt((int)list.getLength());
+						assertEquals(list[index][0], expected[index]);
+						gpa.deallocate(list[index]);
+						list.removeIndex(index);
+						expected.removeIndex(index);
+					}
+				}
+				while (list.getLength() > 0)
+				{
+					gpa.deallocate(list.last());
+					list.popBack();
+				}
+			}
+
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "BBE/Hash.h"
+#include "BBE/String.h"
+#include "BBE/Vector2.h"
+#include "BBE/Vector3.h"
+#include "BBE/List.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		void testHash()
+		{
+			{
+				//Test vectors of the reference implementation, the seed is the index of the vector.
+				assertEquals(hashBytes("", 0, 0), 0x93228a4de0eec5a2ull);
+				assertEquals(hashBytes("a", 1, 1), 0xc5bac3db178713c4ull);
+				assertEquals(hashBytes("abc", 3, 2), 0xa97f2f7b1d9b3314ull);
+				assertEquals(hashBytes("message digest", 14, 3), 0x786d1f1df3801df4ull);
+				assertEquals(hashBytes("abcdefghijklmnopqrstuvwxyz", 26, 4), 0xdca5a8138ad37c87ull);
+				assertEquals(hashBytes("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 62, 5), 0xb9e734f117cfaf70ull);
+				assertEquals(hashBytes("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6), 0x6cc5eab49a92d617ull);
+
+				assertUnequals(hashBytes("abc", 3, 0), hashBytes("abc", 3, 1));
+			}
+
+			{
+				//Equal values hash equal, no matter where they come from.
+				assertEquals(hash(0.0f), hash(-0.0f));
+				assertEquals(hash(0.0), hash(-0.0));
+				assertEquals(hash(bbe::String("Hello World")), hash(Utf8StringView("Hello World")));
+				assertEquals(hash(bbe::String("Hello World")), hash(bbe::String("Say Hello World!").substringView(4, 15)));
+				assertEquals(hash(Vector2(1.f, 2.f)), hash(Vector2(1.f, 2.f)));
+				assertEquals(hash(Vector3(1.f, 2.f, 3.f)), hash(Vector3(1.f, 2.f, 3.f)));
+
+				//Long strings use every byte, not only a prefix.
+				bbe::String longA = "01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789A";
+				bbe::String longB = "01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789B";
+				assertUnequals(hash(longA), hash(longB));
+			}
+
+			{
+				//Combining is order dependent, so swapped coordinates get different hashes.
+				assertUnequals(hash(Vector2i(1, 2)), hash(Vector2i(2, 1)));
+				assertUnequals(hash(Vector3(1.f, 2.f, 3.f)), hash(Vector3(3.f, 2.f, 1.f)));
+				assertUnequals(hashCombine(1, 2), hashCombine(2, 1));
+
+				List<int> a;
+				a.add(1);
+				a.add(2);
+				List<int> b;
+				b.add(2);
+				b.add(1);
+				assertUnequals(hash(a), hash(b));
+			}
+
+			{
+				//Keys that only differ in high bits must still spread over the low bits that a power of two table uses.
+				constexpr uint32_t BUCKETS = 256;
+				constexpr uint32_t KEYS = 4096;
+				List<uint32_t> bucketSizes;
+				for (uint32_t i = 0; i < BUCKETS; i++)
+				{
+					bucketSizes.add(0);
+				}
+				for (uint32_t i = 0; i < KEYS; i++)
+				{
+					bucketSizes[hash(i * 4096) & (BUCKETS - 1)]++;
+				}
+				for (uint32_t i = 0; i < BUCKETS; i++)
+				{
+					assertGreaterThan(bucketSizes[i], 0u);
+					assertLessThan(bucketSizes[i], 3 * KEYS / BUCKETS);
+				}
+
+				for (uint32_t i = 0; i < BUCKETS; i++)
+				{
+					bucketSizes[i] = 0;
+				}
+				for (int32_t x = 0; x < 64; x++)
+				{
+					for (int32_t y = 0; y < 64; y++)
+					{
+						bucketSizes[hash(Vector2i(x, y)) & (BUCKETS - 1)]++;
+					}
+				}
+				for (uint32_t i = 0; i < BUCKETS; i++)
+				{
+					assertGreaterThan(bucketSizes[i], 0u);
+					assertLessThan(bucketSizes[i], 3 * KEYS / BUCKETS);
+				}
+			}
+		}
+	}
+}
@@ -1,5 +1,6 @@
 #include "BBE/Math.h"
 #include "BBE/UtilTest.h"
+#include <cmath>
 
 namespace bbe
 {
@@ -7,8 +8,6 @@ namespace bbe
 	{
 		void testMath()
 		{
-			bbe::Math::INTERNAL::startMath();
-
 			assertEqualsFloat(Math::cos(0               ), 1);
 			assertEqualsFloat(Math::cos(Math::PI / 2    ), 0);
 			assertEqualsFloat(Math::cos(Math::PI        ), -1);
@@ -33,6 +32,70 @@ namespace bbe
 			assertEqualsFloat(Math::asin(0), 0);
 			assertEqualsFloat(Math::asin(1), Math::PI / 2);
 
+			{
+				//The documented error bounds, measured against the double precision versions.
+				double maxErrorSmall = 0;
+				double maxErrorBig = 0;
+				for (int32_t i = -200000; i <= 200000; i++)
+				{
+					const float small = i * (8192.f / 200000);
+					const float big = i * (100000.f / 200000);
+					maxErrorSmall = Math::max(maxErrorSmall, Math::abs(Math::sin(small) - std::sin((double)small)));
+					maxErrorSmall = Math::max(maxErrorSmall, Math::abs(Math::cos(small) - std::cos((double)small)));
+					maxErrorBig = Math::max(maxErrorBig, Math::abs(Math::sin(big) - std::sin((double)big)));
+					maxErrorBig = Math::max(maxErrorBig, Math::abs(Math::cos(big) - std::cos((double)big)));
+
+					float sin;
+					float cos;
+					Math::sincos(small, sin, cos);
+					assertEquals(sin, Math::sin(small));
+					assertEquals(cos, Math::cos(small));
+				}
+				assertLessThan(maxErrorSmall, 8e-8);
+				assertLessThan(maxErrorBig, 1e-6);
+
+				assertEquals(Math::sin(-0.0f), 0.0f);
+				assertEqualsFloat(Math::tan(Math::PI / 4), 1.0f);
+				assertEqualsFloat(Math::tan(-Math::PI / 4), -1.0f);
+				assertEquals(Math::isNaN(Math::sin(Math::INFINITY_POSITIVE)), true);
+				assertEquals(Math::isNaN(Math::cos(Math::INFINITY_NEGATIVE)), true);
+				assertEquals(Math::isNaN(Math::sin(Math::NaN)), true);
+
+				//Beyond the fast argument reduction the results must still be proper sines and cosines.
+				const float hugeValues[] = { 1e5f, 100001.f, 1e6f, 1e9f, 1e10f, -1e12f, 1e20f, 3.4e38f, -3.4e38f };
+				for (const float huge : hugeValues)
+				{
+					assertLessEquals(Math::abs(Math::sin(huge)), 1.0f);
+					assertLessEquals(Math::abs(Math::cos(huge)), 1.0f);
+					assertLessThan(Math::abs(Math::sin(huge) - std::sin((double)huge)), 1e-6);
+					assertLessThan(Math::abs(Math::cos(huge) - std::cos((double)huge)), 1e-6);
+					float sin;
+					float cos;
+					Math::sincos(huge, sin, cos);
+					assertEquals(sin, Math::sin(huge));
+					assertEquals(cos, Math::cos(huge));
+				}
+			}
+
+			{
+				List<Vector2> points = { Vector2(0, 0), Vector2(2, 0), Vector2(1, 1), Vector2(2, 2), Vector2(0, 2), Vector2(0.5f, 1.5f) };
+				List<Vector2> hull = Math::getConvexHull(points);
+				assertEquals(hull.getLength(), 4);
+				assertEquals(hull.contains(Vector2(0, 0)), true);
+				assertEquals(hull.contains(Vector2(2, 0)), true);
+				assertEquals(hull.contains(Vector2(2, 2)), true);
+				assertEquals(hull.contains(Vector2(0, 2)), true);
+
+				//More points than fit inline.
+				List<Vector2> circle;
+				for (int i = 0; i < 100; i++)
+				{
+					circle.add(Vector2(Math::cos(i * 0.0628318f), Math::sin(i * 0.0628318f)) * 10.f);
+					circle.add(Vector2(Math::cos(i * 0.0628318f), Math::sin(i * 0.0628318f)));
+				}
+				assertEquals(Math::getConvexHull(circle).getLength(), 100);
+			}
+
 			assertEqualsFloat(Math::sqrt(0), 0);
 			assertEqualsFloat(Math::sqrt(1), 1);
 			assertEqualsFloat(Math::sqrt(100), 10);
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "BBE/Matrix4.h"
+#include "BBE/Math.h"
 #include "BBE/UtilTest.h"
+#include "Vector4Test.h"
 
 namespace bbe
 {
@@ -222,6 +224,49 @@ namespace bbe
 				assertEquals(m4.get(2, 3), 4);
 				assertEquals(m4.get(3, 3), 1);
 			}
+
+			{
+				//The products must give exactly the same bits as the plain scalar formula they replaced.
+				const List<float> values = createVector4TestValues();
+				const size_t n = values.getLength();
+				for (size_t i = 0; i < n; i++)
+				{
+					Matrix4 a;
+					Matrix4 b;
+					for (int k = 0; k < 16; k++)
+					{
+						a[k] = values[(i + k) % n];
+						b[k] = values[(i * 7 + k * 3 + 1) % n];
+					}
+					const Vector4 v(values[(i + 2) % n], values[(i + 9) % n], values[(i + 4) % n], values[(i + 6) % n]);
+
+					const Vector4 av = a * v;
+					assertBitEquals(av,
+						a.get(0, 0) * v.x + a.get(0, 1) * v.y + a.get(0, 2) * v.z + a.get(0, 3) * v.w,
+						a.get(1, 0) * v.x + a.get(1, 1) * v.y + a.get(1, 2) * v.z + a.get(1, 3) * v.w,
+						a.get(2, 0) * v.x + a.get(2, 1) * v.y + a.get(2, 2) * v.z + a.get(2, 3) * v.w,
+						a.get(3, 0) * v.x + a.get(3, 1) * v.y + a.get(3, 2) * v.z + a.get(3, 3) * v.w);
+
+					const Matrix4 ab = a * b;
+					for (int col = 0; col < 4; col++)
+					{
+						for (int row = 0; row < 4; row++)
+						{
+							const float expected = a.get(row, 0) * b.get(0, col) + a.get(row, 1) * b.get(1, col) + a.get(row, 2) * b.get(2, col) + a.get(row, 3) * b.get(3, col);
+							assertEquals(floatBits(ab.get(row, col)), floatBits(expected));
+						}
+					}
+				}
+			}
+
+			{
+				const Matrix4 transform = Matrix4::createTransform(Vector3(1, 2, 3), Vector3(2, 2, 2), Vector3(0, 0, 1), Math::PI / 2);
+				const Vector3 transformed = transform * Vector3(1, 0, 0);
+				assertEqualsFloat(transformed.x, 1);
+				assertEqualsFloat(transformed.y, 4);
+				assertEqualsFloat(transformed.z, 3);
+				assertEquals(reinterpret_cast<uintptr_t>(&transform) % 16, 0);
+			}
 		}
 	}
-}
\ No newline at end of file
+}
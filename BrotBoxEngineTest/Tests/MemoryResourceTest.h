@@ -0,0 +1,88 @@
+#pragma once
+
+#include "BBE/MemoryResource.h"
+#include "BBE/UtilTest.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+namespace bbe {
+	namespace test {
+		void testMemoryResource() {
+			{
+				bbe::StackAllocator<> sa(1024 * 64);
+				{
+					bbe::StackAllocatorMemoryResource resource(sa);
+					std::pmr::vector<int> vec(&resource);
+					for (int i = 0; i < 1000; i++)
+					{
+						vec.push_back(i);
+					}
+					assertEquals(vec[999], 999);
+					assertGreaterEquals(sa.getUsedBytes(), 1000 * sizeof(int));
+					assertGreaterEquals(sa.getTelemetry().getAmountOfAllocations(), 2);
+
+					double* d = static_cast<double*>(resource.allocate(sizeof(double), 64));
+					assertEquals(reinterpret_cast<std::size_t>(d) % 64, 0);
+					assertEquals(&resource.getParentAllocator(), &sa);
+				}
+				sa.deallocateAll();
+				assertEquals(sa.getUsedBytes(), 0);
+			}
+			{
+				//Leaves room for the links of a list node.
+				typedef bbe::MemoryResourceChunk<sizeof(Person) + 32> Chunk;
+				bbe::PoolAllocator<Chunk> pa(128);
+				bbe::PoolAllocatorMemoryResource<Chunk> resource(pa);
+				{
+					std::pmr::list<Person> list(&resource);
+					for (int i = 0; i < 200; i++)
+					{
+						list.emplace_back("Pooled", "PStr", i);
+					}
+					assertEquals(list.back().age, 199);
+					assertEquals(pa.getAmountOfUsedChunks(), 200);
+
+					//Too big for a chunk, goes upstream.
+					void* big = resource.allocate(1024);
+					assertEquals(pa.getAmountOfUsedChunks(), 200);
+					resource.deallocate(big, 1024);
+
+					list.pop_front();
+					assertEquals(pa.getAmountOfUsedChunks(), 199);
+				}
+				assertEquals(pa.getAmountOfUsedChunks(), 0);
+				assertEquals(resource.getUpstream(), std::pmr::get_default_resource());
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+			for (bbe::GeneralPurposeAllocatorMode mode : { bbe::GeneralPurposeAllocatorMode::FIRST_FIT, bbe::GeneralPurposeAllocatorMode::SEGREGATED_FIT })
+			{
+				bbe::GeneralPurposeAllocator gpa(1024 * 256, mode);
+				{
+					bbe::GeneralPurposeAllocatorMemoryResource resource(gpa);
+					std::pmr::unordered_map<int, int> map(&resource);
+					for (int i = 0; i < 1000; i++)
+					{
+						map[i] = i * 2;
+					}
+					for (int i = 0; i < 1000; i += 2)
+					{
+						map.erase(i);
+					}
+					assertEquals(map.size(), 500);
+					assertEquals(map[501], 1002);
+					assertGreaterEquals(gpa.getTelemetry().getLiveBytes(), 500 * sizeof(int) * 2);
+
+					void* aligned = resource.allocate(100, 128);
+					assertEquals(reinterpret_cast<std::size_t>(aligned) % 128, 0);
+					resource.deallocate(aligned, 100, 128);
+
+					std::pmr::vector<char> vec(&resource);
+					vec.resize(333, 'a');
+					assertEquals(vec[332], 'a');
+				}
+				assertEquals(gpa.getTelemetry().getLiveBytes(), 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "BBE/Philox.h"
+#include "BBE/Simd.h"
+#include "BBE/List.h"
+#include "BBE/UtilTest.h"
+#include "Vector4Test.h"
+#include <thread>
+#include <vector>
+
+namespace bbe
+{
+	namespace test
+	{
+		void testPhiloxAtLevel(SimdLevel level)
+		{
+			setSimdLevel(level);
+
+			const Philox4x32 philox(0x0123456789ABCDEFull, 77);
+			//Start indices on and off block boundaries, lengths around every SIMD width.
+			for (uint64_t firstIndex : { 0ull, 1ull, 3ull, 4ull, 6ull, 1000001ull, 0xFFFFFFFFull - 5, 0xFFFFFFFFFFFFFF00ull })
+			{
+				for (size_t length : { 0, 1, 3, 4, 5, 15, 16, 17, 31, 32, 33, 63, 64, 65, 200 })
+				{
+					List<uint32_t> bits;
+					List<float> floats;
+					bits.resizeCapacityAndLength(length);
+					floats.resizeCapacityAndLength(length);
+					philox.fill(firstIndex, Span<uint32_t>(bits.getRaw(), length));
+					philox.fill(firstIndex, Span<float>(floats.getRaw(), length));
+					for (size_t i = 0; i < length; i++)
+					{
+						assertEquals(bits[i], philox.getUInt(firstIndex + i));
+						assertEquals(floatBits(floats[i]), floatBits(philox.getFloat(firstIndex + i)));
+					}
+				}
+			}
+		}
+
+		void testPhilox()
+		{
+			{
+				//Known answers of Philox4x32-10 from the reference implementation (Random123).
+				uint32_t block[4];
+				Philox4x32(0).getBlock(0, block);
+				assertEquals(block[0], 0x6627E8D5u);
+				assertEquals(block[1], 0xE169C58Du);
+				assertEquals(block[2], 0xBC57AC4Cu);
+				assertEquals(block[3], 0x9B00DBD8u);
+
+				Philox4x32(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull).getBlock(0xFFFFFFFFFFFFFFFFull, block);
+				assertEquals(block[0], 0x408F276Du);
+				assertEquals(block[1], 0x41C83B0Eu);
+				assertEquals(block[2], 0xA20BC7C6u);
+				assertEquals(block[3], 0x6D5451FDu);
+
+				Philox4x32(0x299F31D0A4093822ull, 0x0370734413198A2Eull).getBlock(0x85A308D3243F6A88ull, block);
+				assertEquals(block[0], 0xD16CFE09u);
+				assertEquals(block[1], 0x94FDCCEBu);
+				assertEquals(block[2], 0x5001E420u);
+				assertEquals(block[3], 0x24126EA1u);
+
+				assertEquals(Philox4x32(0).getUInt(2), 0xBC57AC4Cu);
+				assertEquals(Philox4x32(0).getUInt(3), 0x9B00DBD8u);
+			}
+
+			{
+				const Philox4x32 a(1, 0);
+				const Philox4x32 b(1, 1);
+				const Philox4x32 c(2, 0);
+				int sameStream = 0;
+				int sameSeed = 0;
+				double sum = 0;
+				for (uint64_t i = 0; i < 10000; i++)
+				{
+					if (a.getUInt(i) == b.getUInt(i)) sameStream++;
+					if (a.getUInt(i) == c.getUInt(i)) sameSeed++;
+					const float f = a.getFloat(i);
+					assertGreaterEquals(f, 0.0f);
+					assertLessThan(f, 1.0f);
+					sum += f;
+				}
+				assertLessThan(sameStream, 2);
+				assertLessThan(sameSeed, 2);
+				assertEqualsFloat(sum / 10000, 0.5, 0.02);
+			}
+
+			const SimdLevel supported = getSimdLevel();
+			testPhiloxAtLevel(SimdLevel::SCALAR);
+			testPhiloxAtLevel(SimdLevel::SSE2);
+			testPhiloxAtLevel(SimdLevel::AVX2);
+			setSimdLevel(supported);
+
+			{
+				//Worker threads that fill parts of one range produce exactly what a single fill does.
+				constexpr size_t AMOUNT_OF_THREADS = 4;
+				constexpr size_t VALUES_PER_THREAD = 1001;
+				const Philox4x32 philox(42, 3);
+				List<float> expected;
+				expected.resizeCapacityAndLength(AMOUNT_OF_THREADS * VALUES_PER_THREAD);
+				philox.fill(500, Span<float>(expected.getRaw(), expected.getLength()));
+
+				List<float> parallel;
+				parallel.resizeCapacityAndLength(AMOUNT_OF_THREADS * VALUES_PER_THREAD);
+				std::vector<std::thread> threads;
+				for (size_t t = 0; t < AMOUNT_OF_THREADS; t++)
+				{
+					threads.emplace_back([&philox, &parallel, t]()
+					{
+						philox.fill(500 + t * VALUES_PER_THREAD, Span<float>(parallel.getRaw() + t * VALUES_PER_THREAD, VALUES_PER_THREAD));
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				for (size_t i = 0; i < expected.getLength(); i++)
+				{
+					assertEquals(floatBits(parallel[i]), floatBits(expected[i]));
+				}
+			}
+		}
+	}
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <string>
 #include "BBE/UtilTest.h"
+#include <thread>
+#include <vector>
 
 namespace bbe {
 	namespace test {
@@ -170,6 +172,152 @@ namespace bbe {
 			charAllocator.deallocate(c3);
 			charAllocator.deallocate(c4);
 			charAllocator.deallocate(c5);
+
+			{
+				bbe::PoolAllocator<Person> growingAllocator(16);
+				assertEquals(growingAllocator.getAmountOfSlabs(), 1);
+				assertEquals(growingAllocator.getCapacity(), 16);
+
+				Person* grownPersons[100];
+				for (int i = 0; i < 100; i++)
+				{
+					grownPersons[i] = growingAllocator.allocateObject("Grown", "GStr", i);
+				}
+				assertGreaterThan(growingAllocator.getAmountOfSlabs(), 1);
+				assertGreaterEquals(growingAllocator.getCapacity(), 100);
+				assertEquals(growingAllocator.getAmountOfUsedChunks(), 100);
+				assertEquals(growingAllocator.getAmountOfFreeChunks(), growingAllocator.getCapacity() - 100);
+				for (int i = 0; i < 100; i++)
+				{
+					assertEquals(grownPersons[i]->age, i);
+				}
+
+				Person outsider;
+				bool threw = false;
+				try
+				{
+					growingAllocator.deallocate(&outsider);
+				}
+				catch (MalformedPointerException)
+				{
+					threw = true;
+				}
+				assertEquals(threw, true);
+
+				for (int i = 0; i < 100; i += 2)
+				{
+					growingAllocator.deallocate(grownPersons[i]);
+				}
+				assertEquals(growingAllocator.getAmountOfUsedChunks(), 50);
+				assertEquals(growingAllocator.getPeakAmountOfUsedChunks(), 100);
+				assertEqualsFloat(growingAllocator.getOccupancy(), 50.f / growingAllocator.getCapacity());
+				for (int i = 1; i < 100; i += 2)
+				{
+					growingAllocator.deallocate(grownPersons[i]);
+				}
+				assertEquals(growingAllocator.getAmountOfUsedChunks(), 0);
+			}
+			Person::checkIfAllPersonsWereDestroyed();
+
+			{
+				struct Particle
+				{
+					int id;
+					float lifeTime;
+					Particle(int id, float lifeTime) : id(id), lifeTime(lifeTime) {}
+				};
+				//Person counts its instances in unsynchronized statics, so the threads use a plain type.
+				bbe::PoolAllocator<Particle, bbe::PoolAllocatorThreading::THREAD_SAFE> threadSafeAllocator(64);
+				assertEquals(threadSafeAllocator.getThreading(), bbe::PoolAllocatorThreading::THREAD_SAFE);
+				//Only thread safe pools pay for the batch link.
+				static_assert(sizeof(bbe::INTERNAL::PoolChunk<Particle, bbe::PoolAllocatorThreading::SINGLE_THREADED>) == sizeof(Particle), "Single threaded chunks must not grow.");
+				static_assert(sizeof(bbe::INTERNAL::PoolChunk<Particle, bbe::PoolAllocatorThreading::THREAD_SAFE>) == 2 * sizeof(void*), "Thread safe chunks need two links.");
+
+				constexpr int amountOfThreads = 4;
+				constexpr int allocationsPerThread = 2000;
+				//Every thread frees the particles of its neighbour, so chunks constantly move between caches.
+				std::vector<Particle*> allocated[amountOfThreads];
+				std::vector<std::thread> threads;
+				for (int t = 0; t < amountOfThreads; t++)
+				{
+					threads.emplace_back([&, t]()
+					{
+						for (int i = 0; i < allocationsPerThread; i++)
+						{
+							allocated[t].push_back(threadSafeAllocator.allocateObject(t * allocationsPerThread + i, 1.f));
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				threads.clear();
+				assertEquals(threadSafeAllocator.getAmountOfUsedChunks(), amountOfThreads * allocationsPerThread);
+				assertGreaterEquals(threadSafeAllocator.getCapacity(), amountOfThreads * allocationsPerThread);
+
+				for (int t = 0; t < amountOfThreads; t++)
+				{
+					threads.emplace_back([&, t]()
+					{
+						const std::vector<Particle*>& others = allocated[(t + 1) % amountOfThreads];
+						for (int i = 0; i < allocationsPerThread; i++)
+						{
+							if (others[i]->id != ((t + 1) % amountOfThreads) * allocationsPerThread + i)
+							{
+								debugBreak();
+							}
+							threadSafeAllocator.deallocate(others[i]);
+							if (i % 3 == 0)
+							{
+								threadSafeAllocator.deallocate(threadSafeAllocator.allocateObject(i, 0.f));
+							}
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				assertEquals(threadSafeAllocator.getAmountOfUsedChunks(), 0);
+				assertEquals(threadSafeAllocator.getAmountOfFreeChunks(), threadSafeAllocator.getCapacity());
+			}
+
+			{
+				//Steady churn with a bounded amount of live objects must not keep growing the pool.
+				bbe::PoolAllocator<int, bbe::PoolAllocatorThreading::THREAD_SAFE> churnAllocator(64);
+				constexpr int amountOfThreads = 4;
+				constexpr int liveObjectsPerThread = 64;
+				constexpr int iterations = 2000;
+				std::vector<std::thread> threads;
+				for (int t = 0; t < amountOfThreads; t++)
+				{
+					threads.emplace_back([&]()
+					{
+						int* live[liveObjectsPerThread];
+						for (int i = 0; i < iterations; i++)
+						{
+							for (int k = 0; k < liveObjectsPerThread; k++)
+							{
+								live[k] = churnAllocator.allocateObject(k);
+							}
+							for (int k = 0; k < liveObjectsPerThread; k++)
+							{
+								churnAllocator.deallocate(live[k]);
+							}
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				assertEquals(churnAllocator.getAmountOfUsedChunks(), 0);
+				assertGreaterEquals(churnAllocator.getPeakAmountOfUsedChunks(), liveObjectsPerThread);
+				assertLessEquals(churnAllocator.getPeakAmountOfUsedChunks(), amountOfThreads * liveObjectsPerThread);
+				//Every thread cache holds less than two batches of 32 chunks, slabs at most double the capacity.
+				assertLessEquals(churnAllocator.getCapacity(), 2 * amountOfThreads * (liveObjectsPerThread + 64) + 64);
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "BBE/Random.h"
+#include "BBE/Xoshiro256.h"
+#include "BBE/UtilTest.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		//Hands out 32 bits per call, to test the path of RandomBase for such generators.
+		class RandomTest32BitGenerator
+		{
+		private:
+			Xoshiro256StarStar m_generator;
+
+		public:
+			explicit RandomTest32BitGenerator(uint64_t seed)
+				: m_generator(seed)
+			{
+				//do nothing
+			}
+
+			uint32_t next()
+			{
+				return (uint32_t)(m_generator.next() >> 32);
+			}
+
+			void setSeed(uint64_t seed)
+			{
+				m_generator.setSeed(seed);
+			}
+		};
+
+		template<typename Generator>
+		void testRandomBase()
+		{
+			{
+				RandomBase<Generator> a(1234);
+				RandomBase<Generator> b(1234);
+				for (int i = 0; i < 100; i++)
+				{
+					assertEquals(a.randomInt(1000), b.randomInt(1000));
+					assertEquals(a.randomULong(), b.randomULong());
+					assertEquals(a.randomUInt64(), b.randomUInt64());
+					assertEquals(a.randomFloat(), b.randomFloat());
+				}
+				b.setSeed(1234);
+				RandomBase<Generator> c(1234);
+				assertEquals(b.randomULong(), c.randomULong());
+			}
+
+			{
+				//Bounded integers stay in range and hit every value about equally often.
+				RandomBase<Generator> rand(7);
+				int counts[10] = {};
+				for (int i = 0; i < 100000; i++)
+				{
+					const int value = rand.randomInt(10);
+					assertGreaterEquals(value, 0);
+					assertLessThan(value, 10);
+					counts[value]++;
+				}
+				for (int i = 0; i < 10; i++)
+				{
+					assertGreaterThan(counts[i], 9500);
+					assertLessThan(counts[i], 10500);
+				}
+
+				for (int i = 0; i < 1000; i++)
+				{
+					assertEquals(rand.randomInt(1), 0);
+					assertLessThan(rand.randomUInt(0xFFFFFFFFu), 0xFFFFFFFFu);
+					assertLessThan(rand.randomULong(3000000000ul), 3000000000ul);
+					assertLessThan(rand.randomShort(3), 3);
+					assertLessThan(rand.randomByte(200), 200);
+				}
+
+				//A range just above half of all 64 bit values is where a plain modulo would be most biased.
+				const uint64_t bigRange = (1ull << 63) + 1;
+				int belowHalf = 0;
+				for (int i = 0; i < 10000; i++)
+				{
+					const uint64_t value = rand.randomUInt64(bigRange);
+					assertLessThan(value, bigRange);
+					if (value < bigRange / 2)
+					{
+						belowHalf++;
+					}
+				}
+				assertGreaterThan(belowHalf, 4700);
+				assertLessThan(belowHalf, 5300);
+			}
+
+			{
+				RandomBase<Generator> rand(99);
+				double sum = 0;
+				int trues = 0;
+				for (int i = 0; i < 10000; i++)
+				{
+					const float f = rand.randomFloat();
+					assertGreaterEquals(f, 0.0f);
+					assertLessThan(f, 1.0f);
+					sum += f;
+
+					const double d = rand.randomDouble(5.0);
+					assertGreaterEquals(d, 0.0);
+					assertLessThan(d, 5.0);
+
+					if (rand.randomBool())
+					{
+						trues++;
+					}
+				}
+				assertEqualsFloat(sum / 10000, 0.5, 0.02);
+				assertGreaterThan(trues, 4700);
+				assertLessThan(trues, 5300);
+			}
+		}
+
+		void testRandom()
+		{
+			{
+				//Reference output of the original C implementation, seeded through splitmix64 with 42.
+				Xoshiro256StarStar xoshiro(42);
+				assertEquals(xoshiro.next(), 0x15780B2E0C2EC716ull);
+				assertEquals(xoshiro.next(), 0x6104D9866D113A7Eull);
+				assertEquals(xoshiro.next(), 0xAE17533239E499A1ull);
+				assertEquals(xoshiro.next(), 0xECB8AD4703B360A1ull);
+				xoshiro.jump();
+				assertEquals(xoshiro.next(), 0x77369F9F12449A8Bull);
+				assertEquals(xoshiro.next(), 0x1EAB92F3C9460792ull);
+
+				xoshiro.setSeed(42);
+				assertEquals(xoshiro(), 0x15780B2E0C2EC716ull);
+			}
+
+			testRandomBase<Xoshiro256StarStar>();
+			testRandomBase<RandomTest32BitGenerator>();
+
+			{
+				//The seed is handed to the generator's constructor, not applied on top of a default seeding.
+				RandomMersenneTwister rand(5);
+				mt19937 mt(5);
+				assertEquals(rand.randomUInt(), mt.next());
+				assertEquals(rand.randomUInt(), mt.next());
+			}
+		}
+	}
+}
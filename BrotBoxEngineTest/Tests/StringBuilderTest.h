@@ -0,0 +1,127 @@
+#pragma once
+
+#include "BBE/StringBuilder.h"
+#include "BBE/UtilTest.h"
+#include <cstdio>
+#include <limits>
+
+namespace bbe
+{
+	namespace test
+	{
+		void testStringBuilder()
+		{
+			{
+				StringBuilder builder;
+				assertEquals(builder.isEmpty(), true);
+				assertEquals(bbe::String(builder.getRaw()), "");
+
+				builder.append("Frame ").append(42).append(' ').append(-7).append(" ").append(true);
+				assertEquals(bbe::String(builder.getRaw()), "Frame 42 -7 true");
+				assertEquals(builder.getLengthBytes(), 16);
+
+				builder.clear();
+				builder.append(18446744073709551615ull).append(' ').append(-9223372036854775807ll - 1);
+				assertEquals(builder.toString(), "18446744073709551615 -9223372036854775808");
+			}
+
+			{
+				StringBuilder builder;
+				builder.append(1.5f).append(' ').append(0.1).append(' ').append(100.0).append(' ').append(1e30);
+				assertEquals(bbe::String(builder.getRaw()), "1.5 0.1 100 1e+30");
+
+				builder.clear();
+				builder.appendFixed(3.14159, 2).append(' ').appendFixed(2.f, 3);
+				assertEquals(bbe::String(builder.getRaw()), "3.14 2.000");
+
+				//Huge values keep fixed notation and the requested decimals.
+				char expected[512];
+				builder.clear();
+				builder.appendFixed(1e300, 2);
+				std::snprintf(expected, sizeof(expected), "%.2f", 1e300);
+				assertEquals(builder.getLengthBytes(), 301 + 3);
+				assertEquals(bbe::String(builder.getRaw()), expected);
+
+				builder.clear();
+				builder.appendFixed(-std::numeric_limits<double>::max(), 5);
+				std::snprintf(expected, sizeof(expected), "%.5f", -std::numeric_limits<double>::max());
+				assertEquals(builder.getLengthBytes(), 1 + 309 + 6);
+				assertEquals(bbe::String(builder.getRaw()), expected);
+
+				builder.clear();
+				builder.appendFixed(-std::numeric_limits<float>::max(), 1);
+				std::snprintf(expected, sizeof(expected), "%.1f", (double)-std::numeric_limits<float>::max());
+				assertEquals(bbe::String(builder.getRaw()), expected);
+			}
+
+			{
+				//Once reserved, reusing the builder must not allocate again.
+				StringBuilder builder(256);
+				const char* buffer = builder.getRaw();
+				for (uint64_t frame = 0; frame < 1000; frame++)
+				{
+					builder.format("screenshots/img{}.png", frame);
+				}
+				assertEquals(builder.getRaw(), buffer);
+				assertEquals(builder.getView() == "screenshots/img999.png", true);
+
+				builder.format("{} + {} = {}", 1, 2.5f, bbe::String("3.5"));
+				assertEquals(bbe::String(builder.getRaw()), "1 + 2.5 = 3.5");
+				builder.format("{} and {}", "one");
+				assertEquals(bbe::String(builder.getRaw()), "one and {}");
+				builder.format("no placeholder", 1, 2);
+				assertEquals(bbe::String(builder.getRaw()), "no placeholder");
+				builder.appendFormat("{}", "!");
+				assertEquals(bbe::String(builder.getRaw()), "no placeholder!");
+			}
+
+			{
+				StringBuilder builder;
+				for (int i = 0; i < 1000; i++)
+				{
+					builder.append("Ä");
+				}
+				assertEquals(builder.getLengthBytes(), 2000);
+				assertEquals(builder.toString().getLength(), 1000);
+
+				StringBuilder copy = builder;
+				StringBuilder moved = std::move(builder);
+				assertEquals(copy.getView() == moved.getView(), true);
+				assertEquals(builder.isEmpty(), true);
+				copy = moved;
+				moved = std::move(copy);
+				assertEquals(moved.getLengthBytes(), 2000);
+			}
+
+			{
+				//Appending the builder to itself while it has to grow.
+				StringBuilder builder;
+				builder.append("0123456789");
+				for (int i = 0; i < 8; i++)
+				{
+					builder.append(builder.getView());
+				}
+				assertEquals(builder.getLengthBytes(), 2560);
+				for (size_t i = 0; i < builder.getLengthBytes(); i++)
+				{
+					assertEquals(builder.getRaw()[i], (char)('0' + i % 10));
+				}
+				builder.append(Utf8StringView(builder.getRaw() + 5, 3));
+				assertEquals(Utf8StringView(builder.getRaw() + 2558, 5) == "89567", true);
+
+				//Integers only take the capacity they need.
+				StringBuilder small;
+				small.append(7);
+				small.append(42);
+				assertEquals(small.getCapacity(), 64);
+				assertEquals(bbe::String(small.getRaw()), "742");
+			}
+
+			{
+				assertEquals(bbe::String(-12345), "-12345");
+				assertEquals(bbe::String(4000000000u), "4000000000");
+				assertEquals(bbe::String("img") + 7 + ".png", "img7.png");
+			}
+		}
+	}
+}
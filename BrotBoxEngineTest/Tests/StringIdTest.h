@@ -0,0 +1,115 @@
+#pragma once
+
+#include "BBE/StringId.h"
+#include "BBE/HashMap.h"
+#include "BBE/UtilTest.h"
+#include <thread>
+
+namespace bbe
+{
+	namespace test
+	{
+		void testStringId()
+		{
+			{
+				StringId empty;
+				assertEquals(empty.isEmpty(), true);
+				assertEquals(empty.getId(), 0u);
+				assertEquals(empty, StringId(""));
+				assertEquals(bbe::String(empty.getRaw()), "");
+			}
+
+			{
+				//Every way of creating an id for the same text gives the same id.
+				static constexpr StringIdLiteral literal("textures/player.png");
+				static_assert(literal.getHash() == INTERNAL::stringIdHash("textures/player.png", 19), "Literal hash must be computed at compile time.");
+				static_assert(literal.getLengthBytes() == 19, "Wrong literal length.");
+
+				StringId a("textures/player.png");
+				StringId b(bbe::String("textures/player.png"));
+				StringId c(Utf8StringView("textures/player.png.bak", 19));
+				StringId d(literal);
+				assertEquals(a, b);
+				assertEquals(a, c);
+				assertEquals(a, d);
+				assertEquals(hash(a), hash(d));
+				assertEquals(a.isEmpty(), false);
+				assertEquals(a.getView(), Utf8StringView("textures/player.png"));
+				assertEquals(a.toString(), "textures/player.png");
+
+				StringId other("textures/enemy.png");
+				assertUnequals(a, other);
+				assertEquals(other.getView(), Utf8StringView("textures/enemy.png"));
+				assertEquals(a.getView(), Utf8StringView("textures/player.png"));
+
+				//The text is copied, the source can go away.
+				bbe::String temporary = "sounds/jump.wav";
+				StringId jump(temporary);
+				temporary = "something else";
+				assertEquals(bbe::String(jump.getRaw()), "sounds/jump.wav");
+			}
+
+			{
+				//Many and long strings must survive the text blocks growing.
+				const size_t amountBefore = StringId::getAmountOfInternedStrings();
+				List<StringId> ids;
+				for (int i = 0; i < 2000; i++)
+				{
+					ids.add(StringId(bbe::String("stringIdTest") + i));
+				}
+				bbe::String longString;
+				for (int i = 0; i < 500; i++)
+				{
+					longString += "abcdefghij";
+				}
+				StringId longId(longString);
+				assertEquals(StringId::getAmountOfInternedStrings(), amountBefore + 2001);
+				for (int i = 0; i < 2000; i++)
+				{
+					assertEquals(ids[i].toString(), bbe::String("stringIdTest") + i);
+					assertEquals(ids[i], StringId(bbe::String("stringIdTest") + i));
+				}
+				assertEquals(longId.toString(), longString);
+				assertEquals(StringId::getAmountOfInternedStrings(), amountBefore + 2001);
+			}
+
+			{
+				HashMap<StringId, int> map;
+				map.add(StringId("fonts/arial.ttf"), 1);
+				map.add(StringId("fonts/consola.ttf"), 2);
+				assertEquals(*map.get(StringId("fonts/arial.ttf")), 1);
+				assertEquals(*map.get(StringId("fonts/consola.ttf")), 2);
+				assertEquals(map.get(StringId("fonts/missing.ttf")), nullptr);
+			}
+
+			{
+				//Threads interning the same strings concurrently must agree on the ids.
+				constexpr int AMOUNT_OF_THREADS = 4;
+				constexpr int AMOUNT_OF_STRINGS = 500;
+				List<StringId> results[AMOUNT_OF_THREADS];
+				List<std::thread> threads;
+				for (int t = 0; t < AMOUNT_OF_THREADS; t++)
+				{
+					threads.add(std::thread([&results, t]()
+					{
+						for (int i = 0; i < AMOUNT_OF_STRINGS; i++)
+						{
+							results[t].add(StringId(bbe::String("concurrent") + ((i * 7 + t * 13) % AMOUNT_OF_STRINGS)));
+						}
+					}));
+				}
+				for (size_t t = 0; t < threads.getLength(); t++)
+				{
+					threads[t].join();
+				}
+				for (int t = 0; t < AMOUNT_OF_THREADS; t++)
+				{
+					for (int i = 0; i < AMOUNT_OF_STRINGS; i++)
+					{
+						assertEquals(results[t][i], StringId(bbe::String("concurrent") + ((i * 7 + t * 13) % AMOUNT_OF_STRINGS)));
+					}
+				}
+			}
+		}
+	}
+}
@@ -3,6 +3,9 @@
 #include "BBE/String.h"
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
 #include "BBE/UtilTest.h"
 
 namespace bbe {
@@ -287,6 +290,147 @@ namespace bbe {
 				assertEquals(splitNotHappening.getLength(), 1);
 			}
 
+			{
+				bbe::String splitter("This string will be  splitted!");
+				const char* expected[] = { "This", "string", "will", "be", "", "splitted!" };
+				size_t amountOfTokens = 0;
+				for (bbe::Utf8StringView token : splitter.splitView(" "))
+				{
+					assertEquals(bbe::String(token), expected[amountOfTokens]);
+					assertEquals(token.getRaw() >= splitter.getRaw(), true);
+					amountOfTokens++;
+				}
+				assertEquals(amountOfTokens, 6);
+
+				amountOfTokens = 0;
+				for (bbe::Utf8StringView token : splitter.splitView("This is no part of the string"))
+				{
+					assertEquals(token == splitter, true);
+					amountOfTokens++;
+				}
+				assertEquals(amountOfTokens, 1);
+
+				amountOfTokens = 0;
+				for (bbe::Utf8StringView token : bbe::Utf8StringView("a,,b,").splitView(","))
+				{
+					assertEquals(token == "a" || token == "" || token == "b", true);
+					amountOfTokens++;
+				}
+				assertEquals(amountOfTokens, 4);
+
+				auto shortSplit = bbe::String("k=\u00C4").split("=");
+				assertEquals(shortSplit.getLength(), 2);
+				assertEquals(shortSplit[0], "k");
+				assertEquals(shortSplit[1], "\u00C4");
+				assertEquals(shortSplit[1].getLength(), 1);
+			}
+
+			{
+				//A file buffer isn't null terminated, the view must stop at its end.
+				const char buffer[] = { 'v', 'e', 'r', 't', ' ', '1', '.', '5', ' ', '\t', '-', '2', '\n', 'f', ' ', '1', '7', 'X' };
+				bbe::Utf8StringView file(buffer, sizeof(buffer) - 1);
+				bbe::Utf8StringTokenizer tokenizer(file);
+				bbe::Utf8StringView token;
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token == "vert", true);
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token.toFloat(), 1.5f);
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token.toLong(), -2);
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token == "f", true);
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token.toLong(), 17);
+				assertEquals(token.toDouble(), 17.0);
+				assertEquals(tokenizer.next(token), false);
+
+				bbe::Utf8StringTokenizer csv(bbe::Utf8StringView("1;;2; 3"), "; ");
+				long sum = 0;
+				while (csv.next(token))
+				{
+					sum += token.toLong();
+				}
+				assertEquals(sum, 6);
+			}
+
+			{
+				//Truncated or invalid sequences at the end of a buffer are single opaque bytes. The buffers are
+				//exactly as big as the views, so reading past them is caught by the address sanitizer.
+				char* truncated = new char[3]{ 'a', 'b', '\xE2' };
+				bbe::Utf8StringView truncatedView(truncated, 3);
+				bbe::Utf8StringTokenizer tokenizer(truncatedView);
+				bbe::Utf8StringView token;
+				assertEquals(tokenizer.next(token), true);
+				assertEquals(token.getRaw(), truncated);
+				assertEquals(token.getLengthBytes(), 3);
+				assertEquals(tokenizer.next(token), false);
+				assertEquals(truncatedView.trimView().getLengthBytes(), 3);
+
+				//A cut off delimiter is an opaque byte as well and matches the same byte in the string.
+				bbe::Utf8StringTokenizer truncatedDelimiters(truncatedView, bbe::Utf8StringView("\xE2\x80\xA8", 1));
+				assertEquals(truncatedDelimiters.next(token), true);
+				assertEquals(token == "ab", true);
+				assertEquals(truncatedDelimiters.next(token), false);
+
+				char* stray = new char[5]{ ' ', 'x', ' ', '\x80', '\xF0' };
+				bbe::Utf8StringView strayView(stray, 5);
+				assertEquals(strayView.trimView().getRaw(), stray + 1);
+				assertEquals(strayView.trimView().getLengthBytes(), 4);
+				bbe::Utf8StringTokenizer strayTokenizer(strayView);
+				assertEquals(strayTokenizer.next(token), true);
+				assertEquals(token == "x", true);
+				assertEquals(strayTokenizer.next(token), true);
+				assertEquals(token.getRaw(), stray + 3);
+				assertEquals(token.getLengthBytes(), 2);
+				assertEquals(strayTokenizer.next(token), false);
+
+				delete[] truncated;
+				delete[] stray;
+			}
+
+			{
+				bbe::Utf8StringView view("   \u00A0trimmed view\t ");
+				assertEquals(view.trimView() == "trimmed view", true);
+				assertEquals(bbe::Utf8StringView("   ").trimView().isEmpty(), true);
+				assertEquals(bbe::Utf8StringView("").trimView().isEmpty(), true);
+				bbe::String string(" \u00C4pfel ");
+				assertEquals(string.trimView().getLength(), 5);
+				assertEquals(string.trimView().getLengthBytes(), 6);
+
+				assertEquals(bbe::Utf8StringView("  +42 apples").toLong(), 42);
+				assertEquals(bbe::Utf8StringView("ff").toLong(16), 255);
+				assertEquals(bbe::Utf8StringView("0x1F").toLong(16), 31);
+				assertEquals(bbe::Utf8StringView("not a number").toLong(), 0);
+				assertEquals(bbe::Utf8StringView("-0x1F").toLong(16), -31);
+				assertEquals(bbe::Utf8StringView("0x1F").toLong(0), 31);
+				assertEquals(bbe::Utf8StringView(" -017").toLong(0), -15);
+				assertEquals(bbe::Utf8StringView("123").toLong(0), 123);
+				assertEquals(bbe::Utf8StringView("z").toLong(36), 35);
+				assertEquals(bbe::Utf8StringView(std::to_string(std::numeric_limits<long>::min()).c_str()).toLong(), std::numeric_limits<long>::min());
+				assertEquals(bbe::Utf8StringView(std::to_string(std::numeric_limits<long>::max()).c_str()).toLong(), std::numeric_limits<long>::max());
+				try
+				{
+					bbe::Utf8StringView("101").toLong(1); //Not a base.
+					debugBreak();
+				}
+				catch (const bbe::IllegalArgumentException&)
+				{
+					//Do nothing, everything worked as expected.
+				}
+				assertEquals(bbe::Utf8StringView("not a number").toDouble(), 0);
+				assertEquals(bbe::Utf8StringView(" 1282.5 number").toDouble(), 1282.5);
+				assertEquals(bbe::Utf8StringView("1e3").toFloat(), 1000.f);
+
+				assertEquals(bbe::Utf8StringView("key=value").searchBytes("="), 3);
+				assertEquals(bbe::Utf8StringView("key=value").searchBytes("=", 4), -1);
+				assertEquals(bbe::Utf8StringView("key=value").startsWith("key"), true);
+				assertEquals(bbe::Utf8StringView("key=value").startsWith("value"), false);
+
+				bbe::String replaced = bbe::String("a-b-c").replace("-", "+");
+				assertEquals(replaced, "a+b+c");
+				assertEquals(replaced.getLength(), 5);
+			}
+
 			{
 				bbe::String containString("This string will be analyzed if it contains various stuff");
 				assertEquals(containString.contains(" "), true);
@@ -383,6 +527,101 @@ namespace bbe {
 				assertEquals(operatorString[13], L'o');
 			}
 
+			{
+				//Long non ASCII strings are indexed through the breadcrumbs, which must be rebuilt after every change.
+				bbe::String ascii("plain ascii text");
+				assertEquals(ascii.isAscii(), true);
+				bbe::String mixed;
+				for (int i = 0; i < 100; i++)
+				{
+					mixed += (i % 3 == 0) ? u8"\u00E4" : (i % 3 == 1) ? "b" : u8"\U0001F363";
+				}
+				assertEquals(mixed.isAscii(), false);
+				assertEquals(mixed.getLength(), 100);
+				for (size_t i = 0; i < mixed.getLength(); i++)
+				{
+					const bbe::Utf8StringView expected = (i % 3 == 0) ? u8"\u00E4" : (i % 3 == 1) ? "b" : u8"\U0001F363";
+					assertEquals(mixed.substringView(i, i + 1) == expected, true);
+					assertEquals(utf8IsSameChar(&mixed[i], expected.getRaw()), true);
+				}
+				assertEquals(mixed.substringView(97, 200) == u8"b\U0001F363\u00E4", true);
+				assertEquals(mixed.substringView(80, 70).isEmpty(), true);
+
+				mixed += u8"\u00E4nd";
+				assertEquals(mixed.substringView(99, 103) == u8"\u00E4\u00E4nd", true);
+				assertEquals(mixed.search("nd"), 101);
+				assertEquals(mixed.search("b", 95), 97);
+
+				bbe::String sub = mixed.substring(64, 66);
+				assertEquals(sub, u8"b\U0001F363\u00E4");
+				mixed.substringInPlace(63, 65);
+				assertEquals(mixed, u8"\u00E4b\U0001F363");
+				assertEquals(mixed.getLength(), 3);
+				assertEquals(mixed[2], mixed.getRaw()[3]);
+
+				bbe::String moved(std::move(sub));
+				assertEquals(moved[1], mixed.getRaw()[3]);
+
+				bbe::String trimmed(u8"  \u00E4\u00F6\u00FC  ");
+				trimmed.trimInPlace();
+				assertEquals(trimmed, u8"\u00E4\u00F6\u00FC");
+			}
+
+			{
+				//Const lookups may race to build the breadcrumbs, all of them must see the same offsets.
+				bbe::String mixed;
+				for (int i = 0; i < 1000; i++)
+				{
+					mixed += (i % 2 == 0) ? u8"\u00E4" : "b";
+				}
+				for (int round = 0; round < 20; round++)
+				{
+					mixed.getRaw(); //Drops the breadcrumbs.
+					const bbe::String& shared = mixed;
+					std::vector<std::thread> threads;
+					std::atomic<int> mismatches(0);
+					for (int t = 0; t < 4; t++)
+					{
+						threads.emplace_back([&shared, &mismatches, t]()
+						{
+							for (size_t i = 999 - t; i >= 64; i -= 7)
+							{
+								const bbe::Utf8StringView expected = (i % 2 == 0) ? u8"\u00E4" : "b";
+								if (!(shared.substringView(i, i + 1) == expected))
+								{
+									mismatches++;
+								}
+							}
+						});
+					}
+					for (std::thread& thread : threads)
+					{
+						thread.join();
+					}
+					assertEquals(mismatches.load(), 0);
+				}
+			}
+
+			{
+				bbe::String longText;
+				for (int i = 0; i < 1000; i++)
+				{
+					longText += u8"ab\u00E4\u20AC\U0001F363";
+				}
+				assertEquals(bbe::utf8len(longText.getRaw()), 5000);
+				assertEquals(bbe::utf8len(longText.getRaw() + 1, 17), 8);
+				assertEquals(bbe::Utf8StringView(longText).getLength(), 5000);
+				assertEquals(bbe::utf8IsValid(longText.getRaw(), longText.getLengthBytes()), true);
+				assertEquals(bbe::utf8IsValid("", 0), true);
+				assertEquals(bbe::utf8IsValid("\xC3", 1), false);             //Truncated
+				assertEquals(bbe::utf8IsValid("\xC0\xAF", 2), false);         //Overlong
+				assertEquals(bbe::utf8IsValid("\xED\xA0\x80", 3), false);     //Surrogate
+				assertEquals(bbe::utf8IsValid("\xF4\x90\x80\x80", 4), false); //Too big
+				assertEquals(bbe::utf8IsValid("\x80", 1), false);             //Lone continuation byte
+				longText += "\xFF";
+				assertEquals(bbe::utf8IsValid(longText.getRaw(), longText.getLengthBytes()), false);
+			}
+
 			{
 				bbe::String lowerUpperShifter("ThIs stRing will swiTCH BeTWeen lowER and UPPer cAse!");
 				lowerUpperShifter.toLowerCaseInPlace();
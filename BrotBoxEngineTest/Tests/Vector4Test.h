@@ -0,0 +1,120 @@
+#pragma once
+
+#include "BBE/Vector4.h"
+#include "BBE/List.h"
+#include "BBE/UtilTest.h"
+#include <cstring>
+#include <limits>
+
+namespace bbe
+{
+	namespace test
+	{
+		uint32_t floatBits(float f)
+		{
+			uint32_t bits;
+			std::memcpy(&bits, &f, sizeof(bits));
+			return bits;
+		}
+
+		void assertBitEquals(const Vector4 &a, float x, float y, float z, float w)
+		{
+			assertEquals(floatBits(a.x), floatBits(x));
+			assertEquals(floatBits(a.y), floatBits(y));
+			assertEquals(floatBits(a.z), floatBits(z));
+			assertEquals(floatBits(a.w), floatBits(w));
+		}
+
+		//Values that make rounding, signed zeros, denormals and infinities visible.
+		List<float> createVector4TestValues()
+		{
+			List<float> values = { 0.0f, -0.0f, 1.0f, -1.0f, 0.1f, 1.0f / 3.0f, -7.25f, 1e30f, -1e-30f, 1e-40f, 16777217.0f, std::numeric_limits<float>::infinity() };
+			float f = 0.7f;
+			for (int i = 0; i < 20; i++)
+			{
+				f = f * 3.1f - (int)(f * 3.1f) - 0.5f;
+				values.add(f * (i + 1) * 13.37f);
+			}
+			return values;
+		}
+
+		void testVector4()
+		{
+			static_assert(sizeof(Vector4) == sizeof(float) * 4, "A Vector4 must be tightly packed!");
+			static_assert(alignof(Vector4) == 16, "A Vector4 must be 16 byte aligned!");
+
+			{
+				Vector4 vec;
+				assertBitEquals(vec, 0, 0, 0, 0);
+
+				Vector4 vec2(2);
+				assertBitEquals(vec2, 2, 2, 2, 2);
+
+				Vector4 vec3(3, 4);
+				assertBitEquals(vec3, 3, 3, 3, 4);
+
+				Vector4 vec4(1, 2, 3, 4);
+				assertBitEquals(vec4, 1, 2, 3, 4);
+				assertEquals(vec4[0], 1);
+				assertEquals(vec4[3], 4);
+			}
+
+			{
+				List<Vector4> vecs;
+				for (int i = 0; i < 17; i++)
+				{
+					vecs.add(Vector4((float)i));
+				}
+				for (size_t i = 0; i < vecs.getLength(); i++)
+				{
+					assertEquals(reinterpret_cast<uintptr_t>(&vecs[i]) % 16, 0);
+				}
+			}
+
+			{
+				//Every operator must give exactly the same bits as the plain scalar formula.
+				const List<float> values = createVector4TestValues();
+				const size_t n = values.getLength();
+				for (size_t i = 0; i < n; i++)
+				{
+					const float ax = values[i];
+					const float ay = values[(i + 3) % n];
+					const float az = values[(i + 5) % n];
+					const float aw = values[(i + 7) % n];
+					const float bx = values[(i + 1) % n];
+					const float by = values[(i + 2) % n];
+					const float bz = values[(i + 11) % n];
+					const float bw = values[(i + 13) % n];
+					const float s  = values[(i + 17) % n];
+					const Vector4 a(ax, ay, az, aw);
+					const Vector4 b(bx, by, bz, bw);
+
+					assertBitEquals(a + b, ax + bx, ay + by, az + bz, aw + bw);
+					assertBitEquals(a - b, ax - bx, ay - by, az - bz, aw - bw);
+					assertBitEquals(-a, -ax, -ay, -az, -aw);
+					assertBitEquals(a * s, ax * s, ay * s, az * s, aw * s);
+					if (s != 0)
+					{
+						assertBitEquals(a / s, ax / s, ay / s, az / s, aw / s);
+					}
+
+					Vector4 c = a;
+					c += b;
+					assertBitEquals(c, ax + bx, ay + by, az + bz, aw + bw);
+					c = a;
+					c -= b;
+					assertBitEquals(c, ax - bx, ay - by, az - bz, aw - bw);
+					c = a;
+					c *= b;
+					assertBitEquals(c, ax * bx, ay * by, az * bz, aw * bw);
+					if (bx != 0 && by != 0 && bz != 0 && bw != 0)
+					{
+						c = a;
+						c /= b;
+						assertBitEquals(c, ax / bx, ay / by, az / bz, aw / bw);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "BBE/VectorBatch.h"
+#include "BBE/Simd.h"
+#include "BBE/List.h"
+#include "BBE/UtilTest.h"
+#include "Vector4Test.h"
+
+namespace bbe
+{
+	namespace test
+	{
+		float vectorBatchTestValue(uint32_t& state)
+		{
+			state = state * 1664525u + 1013904223u;
+			if ((state >> 24) == 0)
+			{
+				return -0.0f;
+			}
+			return ((int32_t)(state >> 8) - (1 << 23)) / 65536.0f;
+		}
+
+		void testVectorBatchAtLevel(SimdLevel level)
+		{
+			setSimdLevel(level);
+
+			uint32_t state = 42;
+			Matrix4 matrix = Matrix4::createPerspectiveMatrix(1.f, 1.5f, 0.1f, 100.f) * Matrix4::createTransform(Vector3(1, -2, 3), Vector3(0.5f, 2, 1), Vector3(1, 1, 0), 0.5f);
+			const Vector2 axis2(0.6f, -0.8f);
+			const Vector3 axis3(0.25f, -3.f, 7.5f);
+
+			//Lengths around every SIMD width to hit all combinations of full registers and scalar tails.
+			for (size_t length : { 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 255, 256, 257, 1000 })
+			{
+				List<Vector2> points2;
+				List<Vector3> points3;
+				for (size_t i = 0; i < length; i++)
+				{
+					points2.add(Vector2(vectorBatchTestValue(state), vectorBatchTestValue(state)));
+					points3.add(Vector3(vectorBatchTestValue(state), vectorBatchTestValue(state), vectorBatchTestValue(state)));
+				}
+				const Span<const Vector2> span2(points2.getRaw(), length);
+				const Span<const Vector3> span3(points3.getRaw(), length);
+
+				List<float> dots;
+				dots.resizeCapacityAndLength(length);
+				Math::dot(span2, axis2, Span<float>(dots.getRaw(), length));
+				for (size_t i = 0; i < length; i++)
+				{
+					assertEquals(floatBits(dots[i]), floatBits(points2[i] * axis2));
+				}
+				Math::dot(span3, axis3, Span<float>(dots.getRaw(), length));
+				for (size_t i = 0; i < length; i++)
+				{
+					assertEquals(floatBits(dots[i]), floatBits(points3[i] * axis3));
+				}
+
+				if (length > 0)
+				{
+					const Math::ProjectionRange range2 = Math::projectRange(span2, axis2);
+					const Math::ProjectionRange range3 = Math::projectRange(span3, axis3);
+					float min2 = points2[0] * axis2;
+					float max2 = min2;
+					float min3 = points3[0] * axis3;
+					float max3 = min3;
+					for (size_t i = 1; i < length; i++)
+					{
+						min2 = Math::min(min2, points2[i] * axis2);
+						max2 = Math::max(max2, points2[i] * axis2);
+						min3 = Math::min(min3, points3[i] * axis3);
+						max3 = Math::max(max3, points3[i] * axis3);
+					}
+					assertEquals(range2.min, min2);
+					assertEquals(range2.max, max2);
+					assertEquals(range3.min, min3);
+					assertEquals(range3.max, max3);
+				}
+
+				const List<Vector2> projected2 = Math::project(points2, axis2);
+				const List<Vector3> projected3 = Math::project(points3, axis3);
+				assertEquals(projected2.getLength(), length);
+				assertEquals(projected3.getLength(), length);
+				for (size_t i = 0; i < length; i++)
+				{
+					const Vector2 expected2 = points2[i].project(axis2);
+					const Vector3 expected3 = points3[i].project(axis3);
+					assertEquals(floatBits(projected2[i].x), floatBits(expected2.x));
+					assertEquals(floatBits(projected2[i].y), floatBits(expected2.y));
+					assertEquals(floatBits(projected3[i].x), floatBits(expected3.x));
+					assertEquals(floatBits(projected3[i].y), floatBits(expected3.y));
+					assertEquals(floatBits(projected3[i].z), floatBits(expected3.z));
+				}
+
+				List<float> angles;
+				for (size_t i = 0; i < length; i++)
+				{
+					//Some angles go beyond the fast argument reduction, those lanes take the slow path.
+					angles.add(i % 5 == 3 ? vectorBatchTestValue(state) * 1e7f : vectorBatchTestValue(state));
+				}
+				const Span<const float> angleSpan(angles.getRaw(), length);
+				List<float> sines;
+				List<float> cosines;
+				sines.resizeCapacityAndLength(length);
+				cosines.resizeCapacityAndLength(length);
+				Math::sincos(angleSpan, Span<float>(sines.getRaw(), length), Span<float>(cosines.getRaw(), length));
+				for (size_t i = 0; i < length; i++)
+				{
+					assertEquals(floatBits(sines[i]), floatBits(Math::sin(angles[i])));
+					assertEquals(floatBits(cosines[i]), floatBits(Math::cos(angles[i])));
+				}
+				Math::cos(angleSpan, Span<float>(cosines.getRaw(), length));
+				List<float> inPlace = angles;
+				Math::sin(Span<const float>(inPlace.getRaw(), length), Span<float>(inPlace.getRaw(), length));
+				for (size_t i = 0; i < length; i++)
+				{
+					assertEquals(floatBits(inPlace[i]), floatBits(sines[i]));
+					assertEquals(floatBits(cosines[i]), floatBits(Math::cos(angles[i])));
+				}
+
+				List<Vector2> transformed2 = points2;
+				List<Vector3> transformed3 = points3;
+				//In place.
+				Math::transformPoints(matrix, Span<Vector2>(transformed2.getRaw(), length), Span<Vector2>(transformed2.getRaw(), length));
+				Math::transformPoints(matrix, Span<Vector3>(transformed3.getRaw(), length), Span<Vector3>(transformed3.getRaw(), length));
+				for (size_t i = 0; i < length; i++)
+				{
+					const Vector3 expected2 = matrix * Vector3(points2[i].x, points2[i].y, 0);
+					const Vector3 expected3 = matrix * points3[i];
+					assertEquals(floatBits(transformed2[i].x), floatBits(expected2.x));
+					assertEquals(floatBits(transformed2[i].y), floatBits(expected2.y));
+					assertEquals(floatBits(transformed3[i].x), floatBits(expected3.x));
+					assertEquals(floatBits(transformed3[i].y), floatBits(expected3.y));
+					assertEquals(floatBits(transformed3[i].z), floatBits(expected3.z));
+				}
+			}
+		}
+
+		void testVectorBatch()
+		{
+			const SimdLevel supported = getSimdLevel();
+			assertGreaterEquals((int)supported, (int)SimdLevel::SCALAR);
+
+			testVectorBatchAtLevel(SimdLevel::SCALAR);
+			assertEquals((int)getSimdLevel(), (int)SimdLevel::SCALAR);
+			testVectorBatchAtLevel(SimdLevel::SSE2);
+			testVectorBatchAtLevel(SimdLevel::AVX2);
+			assertEquals((int)getSimdLevel(), (int)supported);
+
+			setSimdLevel(supported);
+
+			{
+				//A unit square, shadows on the axes and on the diagonal.
+				const List<Vector2> square = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+				const Span<const Vector2> span(square.getRaw(), square.getLength());
+				Math::ProjectionRange range = Math::projectRange(span, Vector2(1, 0));
+				assertEquals(range.min, 0);
+				assertEquals(range.max, 1);
+				range = Math::projectRange(span, Vector2(-1, -1));
+				assertEquals(range.min, -2);
+				assertEquals(range.max, 0);
+
+				List<Vector2> translated = square;
+				Math::transformPoints(Matrix4::createTranslationMatrix(Vector3(5, 6, 7)), span, Span<Vector2>(translated.getRaw(), translated.getLength()));
+				assertEquals(translated[2].x, 6);
+				assertEquals(translated[2].y, 7);
+			}
+
+			for (SimdLevel level : { SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				//Like the scalar comparisons, a NaN point is skipped and a NaN first point stays the result.
+				setSimdLevel(level);
+				const float nan = std::numeric_limits<float>::quiet_NaN();
+				List<Vector2> points;
+				for (int i = 0; i < 13; i++)
+				{
+					points.add(Vector2((float)i, 0));
+				}
+				points[6].x = nan;
+				Math::ProjectionRange range = Math::projectRange(Span<const Vector2>(points.getRaw(), points.getLength()), Vector2(1, 0));
+				assertEquals(range.min, 0);
+				assertEquals(range.max, 12);
+
+				points[0].x = nan;
+				range = Math::projectRange(Span<const Vector2>(points.getRaw(), points.getLength()), Vector2(1, 0));
+				assertEquals(range.min != range.min, true);
+				assertEquals(range.max != range.max, true);
+			}
+			setSimdLevel(supported);
+		}
+	}
+}
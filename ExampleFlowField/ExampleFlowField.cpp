@@ -12,17 +12,11 @@ class MyGame : public bbe::Game
 		constexpr static float gridSize = 20;
 		constexpr static size_t gridWidth = WINDOW_WIDTH / gridSize + 1;
 		constexpr static size_t gridHeight = WINDOW_HEIGHT / gridSize + 1;
-		bbe::Vector2 grid[gridWidth][gridHeight];
+		bbe::Grid2D<bbe::Vector2> grid = bbe::Grid2D<bbe::Vector2>(gridWidth, gridHeight);
 
 		void reset()
 		{
-			for (size_t i = 0; i < gridWidth; i++)
-			{
-				for (size_t k = 0; k < gridHeight; k++)
-				{
-					grid[i][k] = {};
-				}
-			}
+			grid.fill(bbe::Vector2());
 		}
 
 		size_t locationToGridX(float x)
@@ -65,7 +59,7 @@ class MyGame : public bbe::Game
 						float length = startToCellCenter.getLength();
 						if (length > 10)
 						{
-							grid[i][k] += startToCellCenter / length / length;
+							grid.get(i, k) += startToCellCenter / length / length;
 						}
 					}
 				}
@@ -78,7 +72,7 @@ class MyGame : public bbe::Game
 			{
 				for (size_t k = 0; k < gridHeight; k++)
 				{
-					if (grid[i][k].x > 0)
+					if (grid.get(i, k).x > 0)
 					{
 						brush.setColorRGB(1, 0, 0);
 					}
@@ -87,7 +81,7 @@ class MyGame : public bbe::Game
 						brush.setColorRGB(0, 0, 1);
 					}
 					const bbe::Vector2 cellCenter = getCellCenter(i, k);
-					brush.fillLine(cellCenter, cellCenter + grid[i][k] * 50, 3);
+					brush.fillLine(cellCenter, cellCenter + grid.get(i, k) * 50, 3);
 				}
 			}
 		}
@@ -109,7 +103,7 @@ class MyGame : public bbe::Game
 			{
 				const bbe::Vector2 startToCellCenter = getCellCenter(i, locationY) - pos;
 				const float dot = startToCellCenter.normalize() * normDir;
-				const float dot2 = grid[i][locationY] * dir;
+				const float dot2 = grid.get(i, locationY) * dir;
 				if (dot > 0 && dot2 < 0)
 				{
 					flowFieldContradictsMovement = true;
@@ -130,7 +124,7 @@ class MyGame : public bbe::Game
 					const bbe::Vector2 startToCellCenter = getCellCenter(i, k) - pos;
 					if (startToCellCenter.isSameDirection(normDir))
 					{
-						const float dot = grid[i][k] * dir;
+						const float dot = grid.get(i, k) * dir;
 						if (dot > biggestDot)
 						{
 							biggestDot = dot;
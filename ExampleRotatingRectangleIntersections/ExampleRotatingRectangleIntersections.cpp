@@ -35,16 +35,18 @@ class MyGame : public bbe::Game
 		brush.setColorRGB(1, 1, 1);
 		brush.fillRect(rr);
 
-		auto vertices = rr.getVertices();
+		bbe::RectangleRotated::VertexList vertices;
+		rr.getVertices(vertices);
+		const bbe::Span<const bbe::Vector2> vertexSpan(vertices.getRaw(), vertices.getLength());
 		brush.setColorRGB(1, 0, 0);
-		brush.fillLineStrip(vertices, true);
+		brush.fillLineStrip(vertexSpan, true);
 
 		const bbe::RectangleRotated::ProjectionResult pr = rr.project(projectionsPoint);
 		brush.setColorRGB(0, 1, 0);
 		brush.fillLine(projectionsPoint * pr.start, projectionsPoint * pr.stop);
 
-		auto projections = bbe::Math::project(vertices, projectionsPoint);
-		assert(projections.getLength() == vertices.getLength());
+		bbe::RectangleRotated::VertexList projections(vertices.getLength());
+		bbe::Math::project(vertexSpan, projectionsPoint, bbe::Span<bbe::Vector2>(projections.getRaw(), projections.getLength()));
 		for (size_t i = 0; i < projections.getLength(); i++)
 		{
 			brush.fillLine(vertices[i], projections[i]);
@@ -43,7 +43,7 @@ public:
 class Grid
 {
 private:
-	GridCell grid[GRID_WIDTH][GRID_HEIGHT];
+	bbe::Grid2D<GridCell> grid = bbe::Grid2D<GridCell>(GRID_WIDTH, GRID_HEIGHT);
 
 	bool isCoordValid(int32_t x, int32_t y) const;
 
@@ -219,9 +219,9 @@ class SandGame : public bbe::Game
 		brush.setColorRGB(0.9, 0.9, 0.9);
 		brush.fillRect(0, 0, MENU_WIDTH, WINDOW_HEIGHT);
 
-		for (int32_t x = 0; x < GRID_WIDTH; x++)
+		for (int32_t y = 0; y < GRID_HEIGHT; y++)
 		{
-			for (int32_t y = 0; y < GRID_HEIGHT; y++)
+			for (int32_t x = 0; x < GRID_WIDTH; x++)
 			{
 				if (grid.getBehaviour(x, y) != CellBehaviour::AIR)
 				{
@@ -321,7 +321,7 @@ bool GridCell::isSlidingRight() const
 
 bool Grid::isCoordValid(int32_t x, int32_t y) const
 {
-	return x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT;
+	return grid.isInBounds(x, y);
 }
 
 void Grid::swap(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
@@ -330,17 +330,17 @@ void Grid::swap(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
 	const bool secondValid = isCoordValid(x2, y2);
 	if (firstValid && secondValid)
 	{
-		GridCell swap = grid[x1][y1];
-		grid[x1][y1] = grid[x2][y2];
-		grid[x2][y2] = swap;
+		GridCell swap = grid.get(x1, y1);
+		grid.get(x1, y1) = grid.get(x2, y2);
+		grid.get(x2, y2) = swap;
 	}
 	else if (firstValid)
 	{
-		grid[x1][y1].setBehaviour(CellBehaviour::ROCK);
+		grid.get(x1, y1).setBehaviour(CellBehaviour::ROCK);
 	}
 	else if (secondValid)
 	{
-		grid[x2][y2].setBehaviour(CellBehaviour::ROCK);
+		grid.get(x2, y2).setBehaviour(CellBehaviour::ROCK);
 	}
 	else
 	{
@@ -350,17 +350,17 @@ void Grid::swap(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
 
 Grid::Grid()
 {
-	for (int32_t x = 0; x < GRID_WIDTH; x++)
+	for (int32_t y = 0; y < GRID_HEIGHT; y++)
 	{
-		for (int32_t y = 0; y < GRID_HEIGHT; y++)
+		for (int32_t x = 0; x < GRID_WIDTH; x++)
 		{
 			if (myRand.randomFloat() < 0.25f)
 			{
-				grid[x][y].setBehaviour(CellBehaviour::SAND);
+				grid.get(x, y).setBehaviour(CellBehaviour::SAND);
 			}
 			else
 			{
-				grid[x][y].setBehaviour(CellBehaviour::AIR);
+				grid.get(x, y).setBehaviour(CellBehaviour::AIR);
 			}
 		}
 	}
@@ -368,22 +368,22 @@ Grid::Grid()
 
 void Grid::step()
 {
-	for (int32_t x = 0; x < GRID_WIDTH; x++)
+	for (int32_t y = 0; y < GRID_HEIGHT; y++)
 	{
-		for (int32_t y = 0; y < GRID_HEIGHT; y++)
+		for (int32_t x = 0; x < GRID_WIDTH; x++)
 		{
 			if (getBehaviour(x, y) == CellBehaviour::SAND)
 			{
 				if (myRand.randomFloat() < 0.9)
 				{
-					grid[x][y].slideStop();
+					grid.get(x, y).slideStop();
 				}
 			}
 		}
 	}
-	for (int32_t x = 0; x < GRID_WIDTH; x++)
+	for (int32_t y = 0; y < GRID_HEIGHT; y++)
 	{
-		for (int32_t y = 0; y < GRID_HEIGHT; y++)
+		for (int32_t x = 0; x < GRID_WIDTH; x++)
 		{
 			if (getBehaviour(x, y) == CellBehaviour::AIR && getBehaviour(x + 1, y) == CellBehaviour::SAND && getBehaviour(x + 1, y + 1) != CellBehaviour::AIR && isSlidingLeft(x + 1, y))
 			{
@@ -391,9 +391,9 @@ void Grid::step()
 			}
 		}
 	}
-	for (int32_t x = GRID_WIDTH - 1; x >= 0; x--)
+	for (int32_t y = 0; y < GRID_HEIGHT; y++)
 	{
-		for (int32_t y = 0; y < GRID_HEIGHT; y++)
+		for (int32_t x = GRID_WIDTH - 1; x >= 0; x--)
 		{
 			if (getBehaviour(x, y) == CellBehaviour::AIR && getBehaviour(x - 1, y) == CellBehaviour::SAND && getBehaviour(x - 1, y + 1) != CellBehaviour::AIR && isSlidingRight(x - 1, y))
 			{
@@ -423,7 +423,7 @@ void Grid::step()
 						if (isLeftDiagonalPathPossible)
 						{
 							swap(x, y, x - 1, y - 1);
-							grid[x][y].slideRight();
+							grid.get(x, y).slideRight();
 						}
 					}
 					// Check right
@@ -432,7 +432,7 @@ void Grid::step()
 						if (isRightDiagonalPathPossible)
 						{
 							swap(x, y, x + 1, y - 1);
-							grid[x][y].slideLeft();
+							grid.get(x, y).slideLeft();
 						}
 					}
 				}
@@ -443,29 +443,29 @@ void Grid::step()
 
 bbe::Color Grid::getColor(int32_t x, int32_t y) const
 {
-	if (!isCoordValid(x, y) || grid[x][y].getBehaviour() == CellBehaviour::AIR)
+	if (!isCoordValid(x, y) || grid.get(x, y).getBehaviour() == CellBehaviour::AIR)
 	{
 		return bbe::Color(0, 0, 0, 0);
 	}
-	return grid[x][y].getColor();
+	return grid.get(x, y).getColor();
 }
 
 CellBehaviour Grid::getBehaviour(int32_t x, int32_t y) const
 {
 	if (!isCoordValid(x, y)) return CellBehaviour::ROCK;
-	return grid[x][y].getBehaviour();
+	return grid.get(x, y).getBehaviour();
 }
 
 bool Grid::isSlidingLeft(int32_t x, int32_t y) const
 {
 	if (!isCoordValid(x, y)) return false;
-	return grid[x][y].isSlidingLeft();;
+	return grid.get(x, y).isSlidingLeft();;
 }
 
 bool Grid::isSlidingRight(int32_t x, int32_t y) const
 {
 	if (!isCoordValid(x, y)) return false;
-	return grid[x][y].isSlidingRight();
+	return grid.get(x, y).isSlidingRight();
 }
 
 void Grid::setCircleBehaviour(CellBehaviour behaviour, int32_t x_, int32_t y_, int32_t radius)
@@ -476,7 +476,7 @@ void Grid::setCircleBehaviour(CellBehaviour behaviour, int32_t x_, int32_t y_, i
 		{
 			if (isCoordValid(x, y))
 			{
-				grid[x][y].setBehaviour(behaviour);
+				grid.get(x, y).setBehaviour(behaviour);
 			}
 		}
 	}